@@ -0,0 +1,774 @@
+//! Benchmarks for the full-block `process()` call of every device in the
+//! [culsynth::devices] module, in both fixed-point and floating-point
+//! variants, at each of the supported fixed-point sample rates.  These give
+//! us hard numbers for the relative cost of the FxP and float kernels on a
+//! given host so performance regressions in the hot path are measurable.
+
+use criterion::{black_box, criterion_group, criterion_main, Criterion};
+
+use culsynth::context::{Context, ContextFxP};
+use culsynth::devices::*;
+use culsynth::voice::modulation::{ModMatrix, ModMatrixFxP, ModSection, ModSectionFxP};
+use culsynth::voice::modulation::{ModSectionParams, ModSectionParamsFxP};
+use culsynth::{EnvParamFxP, LfoFreqFxP, NoteFxP, SampleFxP, ScalarFxP, SignedNoteFxP};
+
+const NUMSAMPLES: usize = 256;
+
+fn fxp_contexts() -> [(&'static str, ContextFxP); 2] {
+    [
+        ("44k1", ContextFxP::new_441()),
+        ("48k0", ContextFxP::new_480()),
+    ]
+}
+
+fn bench_osc(c: &mut Criterion) {
+    let note = [NoteFxP::lit("69"); NUMSAMPLES];
+    let tune = [SignedNoteFxP::ZERO; NUMSAMPLES];
+    let shape = [ScalarFxP::ZERO; NUMSAMPLES];
+    for (name, ctx) in fxp_contexts() {
+        let mut osc = OscFxP::new();
+        let mut scratch = OscScratch::new();
+        c.bench_function(&format!("osc_fxp_{}", name), |b| {
+            b.iter(|| {
+                black_box(osc.process(
+                    &ctx,
+                    black_box(&note),
+                    OscParamsFxP {
+                        tune: &tune,
+                        shape: &shape,
+                        sync: OscSync::Off,
+                        waves: OscWaveforms::ALL,
+                    },
+                    &mut scratch,
+                ));
+            })
+        });
+    }
+    let note_f = [69f32; NUMSAMPLES];
+    let zero_f = [0f32; NUMSAMPLES];
+    let mut osc_f32 = Osc::<f32>::new();
+    let mut scratch_f32 = OscScratch::new();
+    let ctx_f32 = Context::<f32>::new(48000f32);
+    c.bench_function("osc_f32", |b| {
+        b.iter(|| {
+            black_box(osc_f32.process(
+                &ctx_f32,
+                black_box(&note_f),
+                OscParams {
+                    tune: &zero_f,
+                    shape: &zero_f,
+                    sync: OscSync::Off,
+                    waves: OscWaveforms::ALL,
+                },
+                &mut scratch_f32,
+            ));
+        })
+    });
+    let note_f64 = [69f64; NUMSAMPLES];
+    let zero_f64 = [0f64; NUMSAMPLES];
+    let mut osc_f64 = Osc::<f64>::new();
+    let mut scratch_f64 = OscScratch::new();
+    let ctx_f64 = Context::<f64>::new(48000f64);
+    c.bench_function("osc_f64", |b| {
+        b.iter(|| {
+            black_box(osc_f64.process(
+                &ctx_f64,
+                black_box(&note_f64),
+                OscParams {
+                    tune: &zero_f64,
+                    shape: &zero_f64,
+                    sync: OscSync::Off,
+                    waves: OscWaveforms::ALL,
+                },
+                &mut scratch_f64,
+            ));
+        })
+    });
+}
+
+fn bench_mixosc(c: &mut Criterion) {
+    let note = [NoteFxP::lit("69"); NUMSAMPLES];
+    let tune = [SignedNoteFxP::ZERO; NUMSAMPLES];
+    let zero = [ScalarFxP::ZERO; NUMSAMPLES];
+    let one = [ScalarFxP::MAX; NUMSAMPLES];
+    for (name, ctx) in fxp_contexts() {
+        let mut osc: MixOscFxP = MixOscFxP::new();
+        let mut scratch = OscScratch::new();
+        c.bench_function(&format!("mixosc_fxp_{}", name), |b| {
+            b.iter(|| {
+                black_box(osc.process(
+                    &ctx,
+                    black_box(&note),
+                    MixOscParamsFxP {
+                        tune: &tune,
+                        shape: &zero,
+                        sync: OscSync::Off,
+                        sin: &zero,
+                        sq: &zero,
+                        tri: &zero,
+                        saw: &one,
+                    },
+                    &mut scratch,
+                ));
+            })
+        });
+    }
+    let note_f = [69f32; NUMSAMPLES];
+    let zero_f = [0f32; NUMSAMPLES];
+    let one_f = [1f32; NUMSAMPLES];
+    let mut osc_f32 = MixOsc::<f32>::new();
+    let mut scratch_f32 = OscScratch::new();
+    let ctx_f32 = Context::<f32>::new(48000f32);
+    c.bench_function("mixosc_f32", |b| {
+        b.iter(|| {
+            black_box(osc_f32.process(
+                &ctx_f32,
+                black_box(&note_f),
+                MixOscParams {
+                    tune: &zero_f,
+                    shape: &zero_f,
+                    sync: OscSync::Off,
+                    sin: &zero_f,
+                    sq: &zero_f,
+                    tri: &zero_f,
+                    saw: &one_f,
+                },
+                &mut scratch_f32,
+            ));
+        })
+    });
+}
+
+fn bench_env(c: &mut Criterion) {
+    let gate = [SampleFxP::ONE; NUMSAMPLES];
+    let rise = [EnvParamFxP::lit("0.1"); NUMSAMPLES];
+    let sustain = [ScalarFxP::lit("0.5"); NUMSAMPLES];
+    for (name, ctx) in fxp_contexts() {
+        let mut env = EnvFxP::new();
+        c.bench_function(&format!("env_fxp_{}", name), |b| {
+            b.iter(|| {
+                black_box(env.process(
+                    &ctx,
+                    black_box(&gate),
+                    EnvParamsFxP {
+                        attack: &rise,
+                        decay: &rise,
+                        sustain: &sustain,
+                        release: &rise,
+                    },
+                ));
+            })
+        });
+    }
+    let gate_f = [1f32; NUMSAMPLES];
+    let rise_f = [0.1f32; NUMSAMPLES];
+    let sustain_f = [0.5f32; NUMSAMPLES];
+    let mut env_f32 = Env::<f32>::new();
+    let ctx_f32 = Context::<f32>::new(48000f32);
+    c.bench_function("env_f32", |b| {
+        b.iter(|| {
+            black_box(env_f32.process(
+                &ctx_f32,
+                black_box(&gate_f),
+                EnvParams {
+                    attack: &rise_f,
+                    decay: &rise_f,
+                    sustain: &sustain_f,
+                    release: &rise_f,
+                },
+            ));
+        })
+    });
+}
+
+fn bench_filt(c: &mut Criterion) {
+    let signal = [SampleFxP::lit("0.5"); NUMSAMPLES];
+    let cutoff = [NoteFxP::lit("69"); NUMSAMPLES];
+    let res = [ScalarFxP::lit("0.25"); NUMSAMPLES];
+    for (name, ctx) in fxp_contexts() {
+        let mut filt = FiltFxP::new();
+        c.bench_function(&format!("filt_fxp_{}", name), |b| {
+            b.iter(|| {
+                black_box(filt.process(
+                    &ctx,
+                    black_box(&signal),
+                    FiltParamsFxP {
+                        cutoff: &cutoff,
+                        resonance: &res,
+                        oversample: FiltOversample::Off,
+                    },
+                ));
+            })
+        });
+    }
+    let signal_f = [0.5f32; NUMSAMPLES];
+    let cutoff_f = [69f32; NUMSAMPLES];
+    let res_f = [0.25f32; NUMSAMPLES];
+    let mut filt_f32 = Filt::<f32>::new();
+    let ctx_f32 = Context::<f32>::new(48000f32);
+    c.bench_function("filt_f32", |b| {
+        b.iter(|| {
+            black_box(filt_f32.process(
+                &ctx_f32,
+                black_box(&signal_f),
+                FiltParams {
+                    cutoff: &cutoff_f,
+                    resonance: &res_f,
+                    oversample: FiltOversample::Off,
+                },
+            ));
+        })
+    });
+}
+
+fn bench_modfilt(c: &mut Criterion) {
+    let signal = [SampleFxP::lit("0.5"); NUMSAMPLES];
+    let env = [ScalarFxP::lit("0.5"); NUMSAMPLES];
+    let note = [NoteFxP::lit("69"); NUMSAMPLES];
+    let vel = [ScalarFxP::lit("0.75"); NUMSAMPLES];
+    let cutoff = [NoteFxP::lit("69"); NUMSAMPLES];
+    let scalar = [ScalarFxP::lit("0.25"); NUMSAMPLES];
+    let one = [ScalarFxP::MAX; NUMSAMPLES];
+    for (name, ctx) in fxp_contexts() {
+        let mut filt = ModFiltFxP::new();
+        c.bench_function(&format!("modfilt_fxp_{}", name), |b| {
+            b.iter(|| {
+                black_box(filt.process(
+                    &ctx,
+                    black_box(&signal),
+                    &env,
+                    &note,
+                    &vel,
+                    ModFiltParamsFxP {
+                        env_mod: &scalar,
+                        vel_mod: &scalar,
+                        kbd: &scalar,
+                        cutoff: &cutoff,
+                        resonance: &scalar,
+                        low_mix: &one,
+                        band_mix: &scalar,
+                        high_mix: &scalar,
+                        oversample: FiltOversample::Off,
+                    },
+                ));
+            })
+        });
+    }
+    let signal_f = [0.5f32; NUMSAMPLES];
+    let note_f = [69f32; NUMSAMPLES];
+    let scalar_f = [0.25f32; NUMSAMPLES];
+    let one_f = [1f32; NUMSAMPLES];
+    let mut filt_f32 = ModFilt::<f32>::new();
+    let ctx_f32 = Context::<f32>::new(48000f32);
+    c.bench_function("modfilt_f32", |b| {
+        b.iter(|| {
+            black_box(filt_f32.process(
+                &ctx_f32,
+                black_box(&signal_f),
+                &scalar_f,
+                &note_f,
+                &scalar_f,
+                ModFiltParams {
+                    env_mod: &scalar_f,
+                    vel_mod: &scalar_f,
+                    kbd: &scalar_f,
+                    cutoff: &note_f,
+                    resonance: &scalar_f,
+                    low_mix: &one_f,
+                    band_mix: &scalar_f,
+                    high_mix: &scalar_f,
+                    oversample: FiltOversample::Off,
+                },
+            ));
+        })
+    });
+}
+
+fn bench_ringmod(c: &mut Criterion) {
+    let a = [SampleFxP::lit("0.5"); NUMSAMPLES];
+    let b_sig = [SampleFxP::lit("0.25"); NUMSAMPLES];
+    let mix = [ScalarFxP::lit("0.5"); NUMSAMPLES];
+    for (name, ctx) in fxp_contexts() {
+        let mut ring = RingModFxP::new();
+        c.bench_function(&format!("ringmod_fxp_{}", name), |b| {
+            b.iter(|| {
+                black_box(ring.process(
+                    &ctx,
+                    black_box(&a),
+                    black_box(&b_sig),
+                    RingModParamsFxP {
+                        mix_out: &mix,
+                        mix_a: &mix,
+                        mix_b: &mix,
+                    },
+                ));
+            })
+        });
+    }
+    let a_f = [0.5f32; NUMSAMPLES];
+    let b_f = [0.25f32; NUMSAMPLES];
+    let mix_f = [0.5f32; NUMSAMPLES];
+    let mut ring_f32 = RingMod::<f32>::new();
+    let ctx_f32 = Context::<f32>::new(48000f32);
+    c.bench_function("ringmod_f32", |b| {
+        b.iter(|| {
+            black_box(ring_f32.process(
+                &ctx_f32,
+                black_box(&a_f),
+                black_box(&b_f),
+                RingModParams {
+                    mix_out: &mix_f,
+                    mix_a: &mix_f,
+                    mix_b: &mix_f,
+                },
+            ));
+        })
+    });
+}
+
+fn bench_amp(c: &mut Criterion) {
+    let signal = [SampleFxP::lit("0.5"); NUMSAMPLES];
+    let gain = [SampleFxP::lit("0.75"); NUMSAMPLES];
+    let mut amp = AmpFxP::new();
+    c.bench_function("amp_fxp", |b| {
+        b.iter(|| {
+            black_box(amp.process(black_box(&signal), black_box(&gain)));
+        })
+    });
+    let signal_f = [0.5f32; NUMSAMPLES];
+    let gain_f = [0.75f32; NUMSAMPLES];
+    let mut amp_f32 = Amp::<f32>::new();
+    c.bench_function("amp_f32", |b| {
+        b.iter(|| {
+            black_box(amp_f32.process(black_box(&signal_f), black_box(&gain_f)));
+        })
+    });
+}
+
+fn bench_lfo(c: &mut Criterion) {
+    let gate = [SampleFxP::ONE; NUMSAMPLES];
+    let freq = [LfoFreqFxP::lit("2"); NUMSAMPLES];
+    let depth = [ScalarFxP::MAX; NUMSAMPLES];
+    let opts = [LfoOptions::default(); NUMSAMPLES];
+    for (name, ctx) in fxp_contexts() {
+        let mut lfo = LfoFxP::default();
+        c.bench_function(&format!("lfo_fxp_{}", name), |b| {
+            b.iter(|| {
+                black_box(lfo.process(
+                    &ctx,
+                    black_box(&gate),
+                    LfoParamsFxP {
+                        freq: &freq,
+                        depth: &depth,
+                        opts: &opts,
+                    },
+                ));
+            })
+        });
+    }
+    let gate_f = [1f32; NUMSAMPLES];
+    let freq_f = [2f32; NUMSAMPLES];
+    let depth_f = [1f32; NUMSAMPLES];
+    let mut lfo_f32 = Lfo::<f32>::default();
+    let ctx_f32 = Context::<f32>::new(48000f32);
+    c.bench_function("lfo_f32", |b| {
+        b.iter(|| {
+            black_box(lfo_f32.process(
+                &ctx_f32,
+                black_box(&gate_f),
+                LfoParams {
+                    freq: &freq_f,
+                    depth: &depth_f,
+                    opts: &opts,
+                },
+            ));
+        })
+    });
+}
+
+fn bench_modsection(c: &mut Criterion) {
+    let gate = [SampleFxP::ONE; NUMSAMPLES];
+    let scalar = [ScalarFxP::lit("0.5"); NUMSAMPLES];
+    let rise = [EnvParamFxP::lit("0.1"); NUMSAMPLES];
+    let freq = [LfoFreqFxP::lit("2"); NUMSAMPLES];
+    let opts = [LfoOptions::default(); NUMSAMPLES];
+    let matrix = ModMatrixFxP::default();
+    for (name, ctx) in fxp_contexts() {
+        let mut section = ModSectionFxP::default();
+        let mut lfo2_freq = freq;
+        let mut lfo2_depth = scalar;
+        let mut lfo2_opts = opts;
+        let mut env2_a = rise;
+        let mut env2_d = rise;
+        let mut env2_s = scalar;
+        let mut env2_r = rise;
+        c.bench_function(&format!("modsection_fxp_{}", name), |b| {
+            b.iter(|| {
+                let params = ModSectionParamsFxP {
+                    velocity: &scalar,
+                    aftertouch: &scalar,
+                    modwheel: &scalar,
+                    lfo1_params: LfoParamsFxP {
+                        freq: &freq,
+                        depth: &scalar,
+                        opts: &opts,
+                    },
+                    lfo2_params: MutLfoParamsFxP {
+                        freq: &mut lfo2_freq,
+                        depth: &mut lfo2_depth,
+                        opts: &mut lfo2_opts,
+                    },
+                    env1_params: EnvParamsFxP {
+                        attack: &rise,
+                        decay: &rise,
+                        sustain: &scalar,
+                        release: &rise,
+                    },
+                    env2_params: MutEnvParamsFxP {
+                        attack: &mut env2_a,
+                        decay: &mut env2_d,
+                        sustain: &mut env2_s,
+                        release: &mut env2_r,
+                    },
+                };
+                black_box(section.process(&ctx, black_box(&gate), params, &matrix));
+            })
+        });
+    }
+    let gate_f = [1f32; NUMSAMPLES];
+    let scalar_f = [0.5f32; NUMSAMPLES];
+    let rise_f = [0.1f32; NUMSAMPLES];
+    let freq_f = [2f32; NUMSAMPLES];
+    let matrix_f = ModMatrix::<f32>::default();
+    let mut section_f32 = ModSection::<f32>::default();
+    let ctx_f32 = Context::<f32>::new(48000f32);
+    let mut lfo2_freq_f = freq_f;
+    let mut lfo2_depth_f = scalar_f;
+    let mut lfo2_opts_f = opts;
+    let mut env2_a_f = rise_f;
+    let mut env2_d_f = rise_f;
+    let mut env2_s_f = scalar_f;
+    let mut env2_r_f = rise_f;
+    c.bench_function("modsection_f32", |b| {
+        b.iter(|| {
+            let params = ModSectionParams::<f32> {
+                velocity: &scalar_f,
+                aftertouch: &scalar_f,
+                modwheel: &scalar_f,
+                lfo1_params: LfoParams {
+                    freq: &freq_f,
+                    depth: &scalar_f,
+                    opts: &opts,
+                },
+                lfo2_params: MutLfoParams {
+                    freq: &mut lfo2_freq_f,
+                    depth: &mut lfo2_depth_f,
+                    opts: &mut lfo2_opts_f,
+                },
+                env1_params: EnvParams {
+                    attack: &rise_f,
+                    decay: &rise_f,
+                    sustain: &scalar_f,
+                    release: &rise_f,
+                },
+                env2_params: MutEnvParams {
+                    attack: &mut env2_a_f,
+                    decay: &mut env2_d_f,
+                    sustain: &mut env2_s_f,
+                    release: &mut env2_r_f,
+                },
+            };
+            black_box(section_f32.process(&ctx_f32, black_box(&gate_f), params, &matrix_f));
+        })
+    });
+}
+
+fn bench_voice(c: &mut Criterion) {
+    use culsynth::voice::{Voice, VoiceFxP, VoiceParams, VoiceParamsFxP};
+    let note = [NoteFxP::lit("69"); NUMSAMPLES];
+    let gate = [SampleFxP::ONE; NUMSAMPLES];
+    let scalar = [ScalarFxP::lit("0.5"); NUMSAMPLES];
+    let rise = [EnvParamFxP::lit("0.1"); NUMSAMPLES];
+    let freq = [LfoFreqFxP::lit("2"); NUMSAMPLES];
+    let opts = [LfoOptions::default(); NUMSAMPLES];
+    let matrix = ModMatrixFxP::default();
+    for (name, ctx) in fxp_contexts() {
+        let mut voice: VoiceFxP = VoiceFxP::new();
+        let mut scratch = OscScratch::new();
+        // All of the mutable buffers the parameter pack borrows:
+        let mut sync = [ScalarFxP::ZERO; NUMSAMPLES];
+        let mut tune = [[SignedNoteFxP::ZERO; NUMSAMPLES]; 2];
+        let mut shape = [[ScalarFxP::ZERO; NUMSAMPLES]; 2];
+        let mut mix = [[ScalarFxP::lit("0.25"); NUMSAMPLES]; 8];
+        let mut ring = [[ScalarFxP::lit("0.5"); NUMSAMPLES]; 3];
+        let mut filt_scalar = [[ScalarFxP::lit("0.25"); NUMSAMPLES]; 7];
+        let mut cutoff = [NoteFxP::lit("69"); NUMSAMPLES];
+        let mut env_rise = [[EnvParamFxP::lit("0.1"); NUMSAMPLES]; 9];
+        let mut env_sus = [[ScalarFxP::lit("0.5"); NUMSAMPLES]; 3];
+        let mut lfo2_freq = freq;
+        let mut lfo2_depth = scalar;
+        let mut lfo2_opts = opts;
+        c.bench_function(&format!("voice_fxp_{}", name), |b| {
+            b.iter(|| {
+                let [m1_sin, m1_sq, m1_tri, m1_saw, m2_sin, m2_sq, m2_tri, m2_saw] = &mut mix;
+                let [fe_a, fe_d, fe_r, ae_a, ae_d, ae_r, e2_a, e2_d, e2_r] = &mut env_rise;
+                let [filt_sus, amp_sus, env2_sus] = &mut env_sus;
+                let [ring_out, ring_a, ring_b] = &mut ring;
+                let [tune1, tune2] = &mut tune;
+                let [shape1, shape2] = &mut shape;
+                let [f_em, f_vm, f_kbd, f_res, f_low, f_band, f_high] = &mut filt_scalar;
+                let params = VoiceParamsFxP {
+                    sync: &mut sync,
+                    osc1_p: MutMixOscParamsFxP {
+                        tune: tune1,
+                        shape: shape1,
+                        sync: OscSync::Off,
+                        sin: m1_sin,
+                        sq: m1_sq,
+                        tri: m1_tri,
+                        saw: m1_saw,
+                    },
+                    unison_voices: 1,
+                    unison_detune: &scalar,
+                    osc2_p: MutMixOscParamsFxP {
+                        tune: tune2,
+                        shape: shape2,
+                        sync: OscSync::Off,
+                        sin: m2_sin,
+                        sq: m2_sq,
+                        tri: m2_tri,
+                        saw: m2_saw,
+                    },
+                    ring_p: MutRingModParamsFxP {
+                        mix_out: ring_out,
+                        mix_a: ring_a,
+                        mix_b: ring_b,
+                    },
+                    filt_p: MutModFiltParamsFxP {
+                        env_mod: f_em,
+                        vel_mod: f_vm,
+                        kbd: f_kbd,
+                        cutoff: &mut cutoff,
+                        resonance: f_res,
+                        low_mix: f_low,
+                        band_mix: f_band,
+                        high_mix: f_high,
+                        oversample: FiltOversample::Off,
+                    },
+                    filt_env_p: MutEnvParamsFxP {
+                        attack: fe_a,
+                        decay: fe_d,
+                        sustain: filt_sus,
+                        release: fe_r,
+                    },
+                    amp_env_p: MutEnvParamsFxP {
+                        attack: ae_a,
+                        decay: ae_d,
+                        sustain: amp_sus,
+                        release: ae_r,
+                    },
+                    lfo1_p: LfoParamsFxP {
+                        freq: &freq,
+                        depth: &scalar,
+                        opts: &opts,
+                    },
+                    lfo2_p: MutLfoParamsFxP {
+                        freq: &mut lfo2_freq,
+                        depth: &mut lfo2_depth,
+                        opts: &mut lfo2_opts,
+                    },
+                    env1_p: EnvParamsFxP {
+                        attack: &rise,
+                        decay: &rise,
+                        sustain: &scalar,
+                        release: &rise,
+                    },
+                    env2_p: MutEnvParamsFxP {
+                        attack: e2_a,
+                        decay: e2_d,
+                        sustain: env2_sus,
+                        release: e2_r,
+                    },
+                };
+                black_box(voice.process(
+                    &ctx,
+                    &matrix,
+                    black_box(&note),
+                    &gate,
+                    &scalar,
+                    &scalar,
+                    &scalar,
+                    params,
+                    &mut scratch,
+                ));
+            })
+        });
+    }
+    // Floating point voice, for head-to-head comparison with the above:
+    let matrix_f = ModMatrix::<f32>::default();
+    let mut voice_f32 = Voice::<f32>::new();
+    let mut scratch_f32 = OscScratch::new();
+    let ctx_f32 = Context::<f32>::new(48000f32);
+    let note_f = [69f32; NUMSAMPLES];
+    let gate_f = [1f32; NUMSAMPLES];
+    let scalar_f = [0.5f32; NUMSAMPLES];
+    let rise_f = [0.1f32; NUMSAMPLES];
+    let freq_f = [2f32; NUMSAMPLES];
+    let mut sync_f = [0f32; NUMSAMPLES];
+    let mut bufs = [[0.25f32; NUMSAMPLES]; 40];
+    let mut opts_f = opts;
+    c.bench_function("voice_f32", |b| {
+        b.iter(|| {
+            let mut it = bufs.iter_mut();
+            let mut next = || it.next().unwrap();
+            let params = VoiceParams::<f32> {
+                sync: &mut sync_f,
+                osc1_p: MutMixOscParams {
+                    tune: next(),
+                    shape: next(),
+                    sync: OscSync::Off,
+                    sin: next(),
+                    sq: next(),
+                    tri: next(),
+                    saw: next(),
+                },
+                unison_voices: 1,
+                unison_detune: &scalar_f,
+                osc2_p: MutMixOscParams {
+                    tune: next(),
+                    shape: next(),
+                    sync: OscSync::Off,
+                    sin: next(),
+                    sq: next(),
+                    tri: next(),
+                    saw: next(),
+                },
+                ring_p: MutRingModParams {
+                    mix_out: next(),
+                    mix_a: next(),
+                    mix_b: next(),
+                },
+                filt_p: MutModFiltParams {
+                    env_mod: next(),
+                    vel_mod: next(),
+                    kbd: next(),
+                    cutoff: next(),
+                    resonance: next(),
+                    low_mix: next(),
+                    band_mix: next(),
+                    high_mix: next(),
+                    oversample: FiltOversample::Off,
+                },
+                filt_env_p: MutEnvParams {
+                    attack: next(),
+                    decay: next(),
+                    sustain: next(),
+                    release: next(),
+                },
+                amp_env_p: MutEnvParams {
+                    attack: next(),
+                    decay: next(),
+                    sustain: next(),
+                    release: next(),
+                },
+                lfo1_p: LfoParams {
+                    freq: &freq_f,
+                    depth: &scalar_f,
+                    opts: &opts,
+                },
+                lfo2_p: MutLfoParams {
+                    freq: next(),
+                    depth: next(),
+                    opts: &mut opts_f,
+                },
+                env1_p: EnvParams {
+                    attack: &rise_f,
+                    decay: &rise_f,
+                    sustain: &scalar_f,
+                    release: &rise_f,
+                },
+                env2_p: MutEnvParams {
+                    attack: next(),
+                    decay: next(),
+                    sustain: next(),
+                    release: next(),
+                },
+            };
+            black_box(voice_f32.process(
+                &ctx_f32,
+                &matrix_f,
+                black_box(&note_f),
+                &gate_f,
+                &scalar_f,
+                &scalar_f,
+                &scalar_f,
+                params,
+                &mut scratch_f32,
+            ));
+        })
+    });
+}
+
+/// End-to-end offline rendering throughput (requires the `std` feature): one
+/// second of a held note at the default patch, fixed-point and float.  These
+/// measure what the per-device benches above can't - the chunking, splat, and
+/// control-buffer overhead of the render loop itself.
+#[cfg(feature = "std")]
+fn bench_render(c: &mut Criterion) {
+    use culsynth::render::*;
+    let events = [
+        RenderEvent {
+            time: 0,
+            kind: RenderEventKind::NoteOn {
+                note: 69,
+                velocity: 100,
+            },
+        },
+        RenderEvent {
+            time: 22050,
+            kind: RenderEventKind::NoteOff(69),
+        },
+    ];
+    let job = RenderJobFxP {
+        ctx: ContextFxP::new_441(),
+        matrix: ModMatrixFxP::default(),
+        events: &events,
+        automation: &[],
+        samples: 44100,
+    };
+    let mut renderer = RendererFxP::new();
+    c.bench_function("render_1s_fxp", |b| {
+        b.iter(|| black_box(renderer.render(black_box(&job))))
+    });
+    let job_f32 = RenderJob::<f32> {
+        ctx: Context::new(44100f32),
+        matrix: ModMatrixFxP::default(),
+        events: &events,
+        automation: &[],
+        samples: 44100,
+    };
+    let mut renderer_f32 = Renderer::<f32>::new();
+    c.bench_function("render_1s_f32", |b| {
+        b.iter(|| black_box(renderer_f32.render(black_box(&job_f32))))
+    });
+}
+
+criterion_group!(
+    devices,
+    bench_osc,
+    bench_mixosc,
+    bench_env,
+    bench_filt,
+    bench_modfilt,
+    bench_ringmod,
+    bench_amp,
+    bench_lfo,
+    bench_modsection,
+    bench_voice
+);
+#[cfg(feature = "std")]
+criterion_group!(render, bench_render);
+#[cfg(feature = "std")]
+criterion_main!(devices, render);
+#[cfg(not(feature = "std"))]
+criterion_main!(devices);
@@ -0,0 +1,202 @@
+//! Microbenchmarks for the math kernels in [culsynth::fixedmath] and their
+//! floating-point counterparts in [culsynth::float_approx].  These functions
+//! sit in the inner loop of every device, so even small regressions here are
+//! multiplied by the sample rate times the voice count.
+
+use criterion::{black_box, criterion_group, criterion_main, Criterion};
+
+use culsynth::fixedmath;
+use culsynth::fixedmath::{I3F13, U0F16, U16F16};
+// The approximation functions only exist when not using libm (see
+// culsynth::float_approx), so those benches disappear with the feature:
+#[cfg(not(feature = "libm"))]
+use culsynth::float_approx;
+use culsynth::{NoteFxP, SampleFxP, ScalarFxP};
+
+/// The number of evaluations per iteration.  Sweeping the input domain
+/// instead of hammering a single constant keeps the optimizer from folding
+/// the calculation away and exercises all the branches within each kernel.
+const NUMPOINTS: usize = 256;
+
+fn bench_sin(c: &mut Criterion) {
+    let args: [SampleFxP; NUMPOINTS] = core::array::from_fn(|i| {
+        SampleFxP::from_num(
+            core::f32::consts::TAU * (i as f32) / (NUMPOINTS as f32) - core::f32::consts::PI,
+        )
+    });
+    c.bench_function("fixedmath_sin_polynomial", |b| {
+        b.iter(|| {
+            for arg in black_box(&args) {
+                black_box(fixedmath::sin_polynomial(*arg));
+            }
+        })
+    });
+    c.bench_function("fixedmath_cos_polynomial", |b| {
+        b.iter(|| {
+            for arg in black_box(&args) {
+                black_box(fixedmath::cos_polynomial(*arg));
+            }
+        })
+    });
+    c.bench_function("fixedmath_sin_lut", |b| {
+        b.iter(|| {
+            for arg in black_box(&args) {
+                black_box(fixedmath::sin_lut(*arg));
+            }
+        })
+    });
+    c.bench_function("fixedmath_cos_lut", |b| {
+        b.iter(|| {
+            for arg in black_box(&args) {
+                black_box(fixedmath::cos_lut(*arg));
+            }
+        })
+    });
+    let args_f: [f32; NUMPOINTS] = core::array::from_fn(|i| {
+        core::f32::consts::TAU * (i as f32) / (NUMPOINTS as f32) - core::f32::consts::PI
+    });
+    #[cfg(not(feature = "libm"))]
+    c.bench_function("float_approx_sin_f32", |b| {
+        b.iter(|| {
+            for arg in black_box(&args_f) {
+                black_box(float_approx::sin_approx(*arg));
+            }
+        })
+    });
+    #[cfg(not(feature = "libm"))]
+    c.bench_function("float_approx_cos_f32", |b| {
+        b.iter(|| {
+            for arg in black_box(&args_f) {
+                black_box(float_approx::cos_approx(*arg));
+            }
+        })
+    });
+    c.bench_function("libm_sin_f32", |b| {
+        b.iter(|| {
+            for arg in black_box(&args_f) {
+                black_box(arg.sin());
+            }
+        })
+    });
+}
+
+fn bench_tan(c: &mut Criterion) {
+    let args: [U0F16; NUMPOINTS] =
+        core::array::from_fn(|i| U0F16::from_num(i as f32 / NUMPOINTS as f32));
+    c.bench_function("fixedmath_tan_fixed", |b| {
+        b.iter(|| {
+            for arg in black_box(&args) {
+                black_box(fixedmath::tan_fixed(*arg));
+            }
+        })
+    });
+    #[cfg(not(feature = "libm"))]
+    {
+        let args_f: [f32; NUMPOINTS] = core::array::from_fn(|i| i as f32 / NUMPOINTS as f32);
+        c.bench_function("float_approx_tan_f32", |b| {
+            b.iter(|| {
+                for arg in black_box(&args_f) {
+                    black_box(float_approx::tan_approx(*arg));
+                }
+            })
+        });
+    }
+}
+
+fn bench_exp(c: &mut Criterion) {
+    let args: [I3F13; NUMPOINTS] =
+        core::array::from_fn(|i| I3F13::from_num(8f32 * (i as f32) / (NUMPOINTS as f32) - 4f32));
+    c.bench_function("fixedmath_exp_fixed", |b| {
+        b.iter(|| {
+            for arg in black_box(&args) {
+                black_box(fixedmath::exp_fixed(*arg));
+            }
+        })
+    });
+    let args_f: [f32; NUMPOINTS] =
+        core::array::from_fn(|i| 8f32 * (i as f32) / (NUMPOINTS as f32) - 4f32);
+    #[cfg(not(feature = "libm"))]
+    c.bench_function("float_approx_exp_f32", |b| {
+        b.iter(|| {
+            for arg in black_box(&args_f) {
+                black_box(float_approx::exp_approx(*arg));
+            }
+        })
+    });
+    c.bench_function("libm_exp_f32", |b| {
+        b.iter(|| {
+            for arg in black_box(&args_f) {
+                black_box(arg.exp());
+            }
+        })
+    });
+}
+
+fn bench_midi_note_to_frequency(c: &mut Criterion) {
+    let args: [NoteFxP; NUMPOINTS] =
+        core::array::from_fn(|i| NoteFxP::from_num(i as f32 / 2f32));
+    c.bench_function("fixedmath_midi_note_to_frequency", |b| {
+        b.iter(|| {
+            for arg in black_box(&args) {
+                black_box(fixedmath::midi_note_to_frequency(*arg));
+            }
+        })
+    });
+    #[cfg(not(feature = "libm"))]
+    {
+        let args_f: [f32; NUMPOINTS] = core::array::from_fn(|i| i as f32 / 2f32);
+        c.bench_function("float_approx_midi_note_to_frequency_f32", |b| {
+            b.iter(|| {
+                for arg in black_box(&args_f) {
+                    black_box(float_approx::midi_note_to_frequency(*arg));
+                }
+            })
+        });
+    }
+}
+
+fn bench_scale_fixedfloat(c: &mut Criterion) {
+    let args_a: [U16F16; NUMPOINTS] =
+        core::array::from_fn(|i| U16F16::from_num(i as f32 * 64f32 + 0.5f32));
+    let args_b: [ScalarFxP; NUMPOINTS] =
+        core::array::from_fn(|i| ScalarFxP::from_num(i as f32 / NUMPOINTS as f32));
+    c.bench_function("fixedmath_scale_fixedfloat", |b| {
+        b.iter(|| {
+            for (a, s) in core::iter::zip(black_box(&args_a), black_box(&args_b)) {
+                black_box(fixedmath::scale_fixedfloat(*a, *s));
+            }
+        })
+    });
+}
+
+fn bench_one_over_one_plus(c: &mut Criterion) {
+    let args: [U16F16; NUMPOINTS] =
+        core::array::from_fn(|i| U16F16::from_num(i as f32 / 16f32));
+    c.bench_function("fixedmath_one_over_one_plus", |b| {
+        b.iter(|| {
+            for arg in black_box(&args) {
+                black_box(fixedmath::one_over_one_plus(*arg));
+            }
+        })
+    });
+    let args_ha: [U0F16; NUMPOINTS] =
+        core::array::from_fn(|i| U0F16::from_num(i as f32 / NUMPOINTS as f32));
+    c.bench_function("fixedmath_one_over_one_plus_highacc", |b| {
+        b.iter(|| {
+            for arg in black_box(&args_ha) {
+                black_box(fixedmath::one_over_one_plus_highacc(*arg));
+            }
+        })
+    });
+}
+
+criterion_group!(
+    fixedmath_benches,
+    bench_sin,
+    bench_tan,
+    bench_exp,
+    bench_midi_note_to_frequency,
+    bench_scale_fixedfloat,
+    bench_one_over_one_plus
+);
+criterion_main!(fixedmath_benches);
@@ -13,17 +13,63 @@ pub trait GenericContext {
     fn is_fixed_point(&self) -> bool;
 }
 
+/// The interval, in samples, at which the modulation matrix is evaluated
+/// (see [crate::voice::modulation]).  Between evaluation points the modulated
+/// parameters are linearly interpolated, so larger intervals trade modulation
+/// bandwidth for a proportional reduction in processing cost.  This is
+/// restricted to powers of two so that the fixed-point interpolation can use
+/// shifts instead of division.
+#[derive(Default, Clone, Copy, PartialEq, Eq)]
+pub enum ModInterval {
+    /// Evaluate modulation at audio rate (every sample)
+    #[default]
+    Audio,
+    /// Evaluate modulation every 4 samples
+    Every4,
+    /// Evaluate modulation every 16 samples
+    Every16,
+}
+
+impl ModInterval {
+    /// The interval, in samples
+    pub const fn value(&self) -> usize {
+        1 << self.log2()
+    }
+    /// The base 2 logarithm of the interval, i.e. the shift corresponding
+    /// to a division by `self.value()`
+    pub const fn log2(&self) -> u32 {
+        match self {
+            Self::Audio => 0,
+            Self::Every4 => 2,
+            Self::Every16 => 4,
+        }
+    }
+}
+
 #[derive(Clone, Copy)]
 /// A floating point (using the type `Smp`) processing context
 pub struct Context<Smp: Float> {
     /// The sample rate, in Hz, with the same type as a processing type
     pub sample_rate: Smp,
+    /// The interval at which to evaluate modulation (see [ModInterval])
+    pub mod_interval: ModInterval,
 }
 
 impl<Smp: Float> Context<Smp> {
     /// Create a new `Context`
     pub fn new(sample_rate: Smp) -> Self {
-        Self { sample_rate }
+        Self {
+            sample_rate,
+            mod_interval: ModInterval::default(),
+        }
+    }
+    /// Replace the modulation interval of `self`, consuming `self` and
+    /// returning the new context
+    pub fn with_mod_interval(self, i: ModInterval) -> Self {
+        Self {
+            mod_interval: i,
+            ..self
+        }
     }
 }
 
@@ -51,6 +97,8 @@ impl<Smp: Float> GenericContext for Context<Smp> {
 pub struct ContextFxP {
     /// The sample rate, as one of the supported FixedSampleRates:
     pub sample_rate: FixedSampleRate,
+    /// The interval at which to evaluate modulation (see [ModInterval])
+    pub mod_interval: ModInterval,
 }
 
 impl ContextFxP {
@@ -58,23 +106,36 @@ impl ContextFxP {
     pub const fn new_441() -> Self {
         Self {
             sample_rate: FixedSampleRate::Khz44_1,
+            mod_interval: ModInterval::Audio,
         }
     }
     /// Create a new fixed-point context with a sample rate of 48kHz
     pub const fn new_480() -> Self {
         Self {
             sample_rate: FixedSampleRate::Khz48_0,
+            mod_interval: ModInterval::Audio,
         }
     }
     /// Create a fixed-point processing context if the sample rate provided is
     /// a supported sample rate, or return `None` otherwise.
     pub fn maybe_create(value: u32) -> Option<Self> {
         if let Ok(val) = FixedSampleRate::try_from(value) {
-            Some(Self { sample_rate: val })
+            Some(Self {
+                sample_rate: val,
+                mod_interval: ModInterval::default(),
+            })
         } else {
             None
         }
     }
+    /// Replace the modulation interval of `self`, consuming `self` and
+    /// returning the new context
+    pub fn with_mod_interval(self, i: ModInterval) -> Self {
+        Self {
+            mod_interval: i,
+            ..self
+        }
+    }
 }
 
 impl GenericContext for ContextFxP {
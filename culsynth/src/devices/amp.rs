@@ -16,11 +16,16 @@ impl<Smp: Float> Amp<Smp> {
     /// Process the input signal and apply the VCA gain to it
     pub fn process(&mut self, signal: &[Smp], gain: &[Smp]) -> &[Smp] {
         let numsamples = min_size(&[signal.len(), gain.len(), STATIC_BUFFER_SIZE]);
-        for i in 0..numsamples {
-            self.outbuf[i] = signal[i] * gain[i];
-        }
+        Smp::buf_mul(&mut self.outbuf[0..numsamples], signal, gain);
         &self.outbuf[0..numsamples]
     }
+    /// Apply the VCA gain to a single sample - the per-sample analog of
+    /// [Amp::process], for callers interleaving several devices in one loop
+    /// (see [crate::voice::Voice])
+    #[cfg_attr(feature = "profile", allow(dead_code))]
+    pub(crate) fn tick(signal: Smp, gain: Smp) -> Smp {
+        signal * gain
+    }
 }
 
 impl<Smp: Float> Default for Amp<Smp> {
@@ -46,10 +51,16 @@ impl AmpFxP {
     pub fn process(&mut self, signal: &[SampleFxP], gain: &[SampleFxP]) -> &[SampleFxP] {
         let numsamples = min_size(&[signal.len(), gain.len(), STATIC_BUFFER_SIZE]);
         for i in 0..numsamples {
-            self.outbuf[i] = signal[i].saturating_mul(gain[i]);
+            self.outbuf[i] = Self::tick(signal[i], gain[i]);
         }
         &self.outbuf[0..numsamples]
     }
+    /// Apply the VCA gain to a single sample - the per-sample analog of
+    /// [AmpFxP::process], for callers interleaving several devices in one
+    /// loop (see [crate::voice::VoiceFxP])
+    pub(crate) fn tick(signal: SampleFxP, gain: SampleFxP) -> SampleFxP {
+        signal.saturating_mul(gain)
+    }
 }
 
 impl Default for AmpFxP {
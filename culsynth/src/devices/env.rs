@@ -119,46 +119,54 @@ impl<Smp: Float> Env<Smp> {
     /// copy them into their own output buffers before calling this function
     /// again to process the remainder of the data.
     pub fn process(&mut self, ctx: &Context<Smp>, gate: &[Smp], params: EnvParams<Smp>) -> &[Smp] {
-        let attack = params.attack;
-        let decay = params.decay;
-        let sustain = params.sustain;
-        let release = params.release;
-        let numsamples = min_size(&[
-            attack.len(),
-            decay.len(),
-            sustain.len(),
-            release.len(),
-            gate.len(),
-            STATIC_BUFFER_SIZE,
-        ]);
-        let setpoint_old = self.setpoint;
+        let numsamples = min_size(&[params.len(), gate.len(), STATIC_BUFFER_SIZE]);
+        let half_sr = ctx.sample_rate / Smp::TWO;
         for i in 0..numsamples {
-            if gate[i] <= Self::GATE_THRESHOLD {
-                self.state = EnvState::Release;
-                self.setpoint = Self::SIGNAL_MIN;
-            } else if self.state == EnvState::Release {
-                self.state = EnvState::Attack;
-                self.setpoint = Self::SIGNAL_MAX;
-            } else if self.state == EnvState::Attack && self.last > Self::ATTACK_THRESHOLD {
-                self.state = EnvState::Decay;
-            }
-            let rise = if self.state == EnvState::Attack {
-                attack[i]
-            } else if self.state == EnvState::Decay {
-                self.setpoint = sustain[i];
-                decay[i]
-            } else {
-                release[i]
-            };
-            // This is equivalen to saying rise time = 4 time constants...
-            let k = rise * (ctx.sample_rate / Smp::TWO) + Smp::ONE;
-            let pro = setpoint_old + self.setpoint - self.last - self.last;
-            let delta = pro / k;
-            self.last = self.last + delta;
-            self.outbuf[i] = self.last;
+            self.outbuf[i] = self.tick(half_sr, gate[i], &params, i);
         }
         &self.outbuf[0..numsamples]
     }
+    /// Process a single sample of the gate input - the per-sample analog of
+    /// [Env::process], for callers interleaving several devices in one loop
+    /// (see [crate::voice::Voice]).  `half_sr` is half the sample rate, which
+    /// is loop-invariant and should be computed once per block by the caller.
+    pub(crate) fn tick(&mut self, half_sr: Smp, gate: Smp, params: &EnvParams<Smp>, i: usize) -> Smp {
+        let setpoint_old = self.setpoint;
+        if gate <= Self::GATE_THRESHOLD {
+            self.state = EnvState::Release;
+            self.setpoint = Self::SIGNAL_MIN;
+        } else if self.state == EnvState::Release {
+            self.state = EnvState::Attack;
+            self.setpoint = Self::SIGNAL_MAX;
+        } else if self.state == EnvState::Attack && self.last > Self::ATTACK_THRESHOLD {
+            self.state = EnvState::Decay;
+        }
+        let rise = if self.state == EnvState::Attack {
+            params.attack[i]
+        } else if self.state == EnvState::Decay {
+            self.setpoint = params.sustain[i];
+            params.decay[i]
+        } else {
+            params.release[i]
+        };
+        // This is equivalen to saying rise time = 4 time constants...
+        let k = rise * half_sr + Smp::ONE;
+        let pro = setpoint_old + self.setpoint - self.last - self.last;
+        let delta = pro / k;
+        self.last = self.last + delta;
+        self.last
+    }
+    /// Returns true if the envelope has been released and its output has
+    /// decayed below audibility (approximately -72dB), so processing whatever
+    /// it is enveloping would only produce silence
+    pub fn is_idle(&self) -> bool {
+        self.state == EnvState::Release && self.last < Smp::ONE / Smp::from_u16(4096)
+    }
+    /// Get the current output level of the envelope (i.e. the last sample
+    /// generated)
+    pub fn value(&self) -> Smp {
+        self.last
+    }
 }
 
 impl<Smp: Float> Default for Env<Smp> {
@@ -256,6 +264,45 @@ impl<'a> From<MutEnvParamsFxP<'a>> for EnvParamsFxP<'a> {
     }
 }
 
+/// The cached rate coefficient for an [EnvFxP], keyed on the rise time and
+/// sample rate it was derived from.  The active rise time only changes when a
+/// knob moves or the envelope changes state, so on the common (unchanged) path
+/// the reciprocal calculation reduces to a compare.
+#[derive(Clone)]
+struct EnvCoeffFxP {
+    rise: EnvParamFxP,
+    half_sr: fixedmath::U16F0,
+    gain: fixedmath::U1F15,
+    shift: u32,
+}
+
+impl EnvCoeffFxP {
+    /// An invalid cache entry.  The sample rate is never zero, so the first
+    /// call to [Self::update] will always recompute.
+    fn invalid() -> Self {
+        Self {
+            rise: EnvParamFxP::ZERO,
+            half_sr: fixedmath::U16F0::ZERO,
+            gain: fixedmath::U1F15::ZERO,
+            shift: 0,
+        }
+    }
+    /// Recompute the coefficient if the rise time or sample rate has changed
+    /// since it was last derived.
+    fn update(&mut self, rise: EnvParamFxP, half_sr: fixedmath::U16F0) {
+        if rise == self.rise && half_sr == self.half_sr {
+            return;
+        }
+        // This is equivalen to saying rise time = 4 time constants...
+        let k = rise.wide_mul(half_sr);
+        let (gain, shift) = fixedmath::one_over_one_plus(k);
+        self.rise = rise;
+        self.half_sr = half_sr;
+        self.gain = gain;
+        self.shift = shift;
+    }
+}
+
 /// A fixed point ADSR envelope generator.  See [EnvParamsFxP] for the fixed point
 /// definitions of the parameters.
 #[derive(Clone)]
@@ -264,6 +311,7 @@ pub struct EnvFxP {
     outbuf: BufferT<ScalarFxP>,
     setpoint: fixedmath::I3F29,
     last: fixedmath::I3F29,
+    coeff: EnvCoeffFxP,
 }
 
 impl EnvFxP {
@@ -271,6 +319,9 @@ impl EnvFxP {
     const ATTACK_THRESHOLD: ScalarFxP = ScalarFxP::lit("0.98");
     const SIGNAL_MAX: ScalarFxP = ScalarFxP::lit("0x0.FFFC");
     const SIGNAL_MIN: fixedmath::I3F29 = fixedmath::I3F29::lit("0x0.0004");
+    // Approximately -72dB, and comfortably above SIGNAL_MIN, which the
+    // release asymptotically approaches:
+    const IDLE_THRESHOLD: fixedmath::I3F29 = fixedmath::I3F29::lit("0x0.0010");
     /// Constructor
     pub fn new() -> Self {
         Self {
@@ -278,6 +329,7 @@ impl EnvFxP {
             outbuf: [ScalarFxP::ZERO; STATIC_BUFFER_SIZE],
             setpoint: Self::SIGNAL_MIN,
             last: Self::SIGNAL_MIN,
+            coeff: EnvCoeffFxP::invalid(),
         }
     }
     /// Process the gate input and return an envelope signal according to the ADSR
@@ -293,54 +345,68 @@ impl EnvFxP {
         gate: &[SampleFxP],
         params: EnvParamsFxP,
     ) -> &[ScalarFxP] {
-        let attack = params.attack;
-        let decay = params.decay;
-        let sustain = params.sustain;
-        let release = params.release;
-        let numsamples = min_size(&[
-            attack.len(),
-            decay.len(),
-            sustain.len(),
-            release.len(),
-            gate.len(),
-            STATIC_BUFFER_SIZE,
-        ]);
-        let setpoint_old = self.setpoint;
+        let numsamples = min_size(&[params.len(), gate.len(), STATIC_BUFFER_SIZE]);
+        let half_sr = fixedmath::U16F0::from_bits(ctx.sample_rate.value() >> 1);
         for i in 0..numsamples {
-            if gate[i] <= Self::GATE_THRESHOLD {
-                self.state = EnvState::Release;
-                self.setpoint = Self::SIGNAL_MIN;
-            } else if self.state == EnvState::Release {
-                self.state = EnvState::Attack;
-                self.setpoint = fixedmath::I3F29::from_num(Self::SIGNAL_MAX);
-            } else if self.state == EnvState::Attack && self.last > Self::ATTACK_THRESHOLD {
-                self.state = EnvState::Decay;
-            }
-            let rise = if self.state == EnvState::Attack {
-                attack[i]
-            } else if self.state == EnvState::Decay {
-                self.setpoint = core::cmp::max(
-                    fixedmath::I3F29::from_num(core::cmp::min(sustain[i], Self::SIGNAL_MAX)),
-                    Self::SIGNAL_MIN,
-                );
-                decay[i]
-            } else {
-                release[i]
-            };
-            // This is equivalen to saying rise time = 4 time constants...
-            let sr = fixedmath::U16F0::from_bits(ctx.sample_rate.value() >> 1);
-            let k = rise.wide_mul(sr);
-            let (gain, shift) = fixedmath::one_over_one_plus(k);
-            // Need saturating here to avoid panic if A == 0 && S == 0:
-            let pro = fixedmath::I2F14::saturating_from_num(
-                setpoint_old + self.setpoint - self.last.unwrapped_shl(1),
-            );
-            let delta = pro.wide_mul_unsigned(gain).unwrapped_shr(shift);
-            self.last += delta;
-            self.outbuf[i] = ScalarFxP::saturating_from_num(self.last);
+            self.outbuf[i] = self.tick(half_sr, gate[i], &params, i);
         }
         &self.outbuf[0..numsamples]
     }
+    /// Process a single sample of the gate input - the per-sample analog of
+    /// [EnvFxP::process], for callers interleaving several devices in one
+    /// loop (see [crate::voice::VoiceFxP]).  `half_sr` is half the sample
+    /// rate, which is loop-invariant and should be computed once per block by
+    /// the caller.
+    pub(crate) fn tick(
+        &mut self,
+        half_sr: fixedmath::U16F0,
+        gate: SampleFxP,
+        params: &EnvParamsFxP,
+        i: usize,
+    ) -> ScalarFxP {
+        let setpoint_old = self.setpoint;
+        if gate <= Self::GATE_THRESHOLD {
+            self.state = EnvState::Release;
+            self.setpoint = Self::SIGNAL_MIN;
+        } else if self.state == EnvState::Release {
+            self.state = EnvState::Attack;
+            self.setpoint = fixedmath::I3F29::from_num(Self::SIGNAL_MAX);
+        } else if self.state == EnvState::Attack && self.last > Self::ATTACK_THRESHOLD {
+            self.state = EnvState::Decay;
+        }
+        let rise = if self.state == EnvState::Attack {
+            params.attack[i]
+        } else if self.state == EnvState::Decay {
+            self.setpoint = core::cmp::max(
+                fixedmath::I3F29::from_num(core::cmp::min(params.sustain[i], Self::SIGNAL_MAX)),
+                Self::SIGNAL_MIN,
+            );
+            params.decay[i]
+        } else {
+            params.release[i]
+        };
+        self.coeff.update(rise, half_sr);
+        // Need saturating here to avoid panic if A == 0 && S == 0:
+        let pro = fixedmath::I2F14::saturating_from_num(
+            setpoint_old + self.setpoint - self.last.unwrapped_shl(1),
+        );
+        let delta = pro
+            .wide_mul_unsigned(self.coeff.gain)
+            .unwrapped_shr(self.coeff.shift);
+        self.last += delta;
+        ScalarFxP::saturating_from_num(self.last)
+    }
+    /// Returns true if the envelope has been released and its output has
+    /// decayed below audibility (approximately -72dB), so processing whatever
+    /// it is enveloping would only produce silence
+    pub fn is_idle(&self) -> bool {
+        self.state == EnvState::Release && self.last < Self::IDLE_THRESHOLD
+    }
+    /// Get the current output level of the envelope (i.e. the last sample
+    /// generated)
+    pub fn value(&self) -> ScalarFxP {
+        ScalarFxP::saturating_from_num(self.last)
+    }
 }
 
 impl Default for EnvFxP {
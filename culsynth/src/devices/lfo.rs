@@ -226,6 +226,7 @@ impl<Smp: Float> Lfo<Smp> {
             depth.len(),
             STATIC_BUFFER_SIZE,
         ]);
+        let tau_over_sr = Smp::TAU() / ctx.sample_rate;
         for i in 0..numsamples {
             let this_gate = gate[i] > Smp::ONE_HALF;
             if opts[i].retrigger() && this_gate && !self.last_gate {
@@ -275,7 +276,7 @@ impl<Smp: Float> Lfo<Smp> {
                 value = (value + Smp::ONE) / Smp::TWO;
             }
             self.outbuf[i] = value * depth[i];
-            let phase_per_sample = (freq[i] * Smp::TAU()) / ctx.sample_rate;
+            let phase_per_sample = freq[i] * tau_over_sr;
             self.phase = self.phase + phase_per_sample;
             // Check if we've crossed from positive phase back to negative:
             if self.phase >= Smp::PI() {
@@ -402,6 +403,7 @@ impl LfoFxP {
         const FRAC_2_PI: ScalarFxP = ScalarFxP::lit("0x0.a2fa");
         const TWO: SampleFxP = SampleFxP::lit("2");
         const ONE_HALF: SampleFxP = SampleFxP::lit("0.5");
+        let frac_2pi4096_sr = ctx.sample_rate.frac_2pi4096_sr();
         for i in 0..numsamples {
             let this_gate = gate[i] > ONE_HALF;
             if opts[i].retrigger() && this_gate && !self.last_gate {
@@ -456,11 +458,8 @@ impl LfoFxP {
                 value = (value + SampleFxP::ONE).unwrapped_shr(1);
             }
             self.outbuf[i] = SampleFxP::from_num(value.wide_mul_unsigned(depth[i]));
-            let phase_per_sample = PhaseFxP::from_num(
-                freq[i]
-                    .wide_mul(ctx.sample_rate.frac_2pi4096_sr())
-                    .unwrapped_shr(12),
-            );
+            let phase_per_sample =
+                PhaseFxP::from_num(freq[i].wide_mul(frac_2pi4096_sr).unwrapped_shr(12));
             self.phase += phase_per_sample;
             // Check if we've crossed from positive phase back to negative:
             if self.phase >= PhaseFxP::PI {
@@ -55,6 +55,30 @@ impl<'a, Smp> MixOscParams<'a, Smp> {
     }
 }
 
+impl<'a, Smp: Float> MixOscParams<'a, Smp> {
+    /// Determine which waveforms actually contribute to the mix this block,
+    /// i.e. those with a non-zero gain for at least one sample.  This lets
+    /// the inner [Osc] skip generating the others entirely (see
+    /// [OscWaveforms]) - most patches only use one or two waveforms per
+    /// oscillator, so this is usually a significant savings.
+    pub fn waveforms(&self) -> OscWaveforms {
+        let mut waves = OscWaveforms::NONE;
+        if self.sin.iter().any(|x| *x != Smp::ZERO) {
+            waves = waves | OscWaveforms::SIN;
+        }
+        if self.sq.iter().any(|x| *x != Smp::ZERO) {
+            waves = waves | OscWaveforms::SQ;
+        }
+        if self.tri.iter().any(|x| *x != Smp::ZERO) {
+            waves = waves | OscWaveforms::TRI;
+        }
+        if self.saw.iter().any(|x| *x != Smp::ZERO) {
+            waves = waves | OscWaveforms::SAW;
+        }
+        waves
+    }
+}
+
 /// A mutable parameter pack for a [MixOsc] - see [MixOscParams]
 pub struct MutMixOscParams<'a, Smp> {
     /// The tuning offset, in semitones offset from 12TET/A440
@@ -134,7 +158,9 @@ impl<Smp: Float> MixOsc<Smp> {
         ctx: &Context<Smp>,
         note: &[Smp],
         params: MixOscParams<Smp>,
+        scratch: &mut OscScratch<Smp>,
     ) -> &[Smp] {
+        let waves = params.waveforms();
         let osc_out = self.osc.process(
             ctx,
             note,
@@ -142,17 +168,73 @@ impl<Smp: Float> MixOsc<Smp> {
                 tune: params.tune,
                 shape: params.shape,
                 sync: params.sync,
+                waves,
             },
+            scratch,
         );
         let numsamples = osc_out.len();
-        for i in 0..numsamples {
-            self.outbuf[i] = (osc_out.sin[i] * params.sin[i])
-                + (osc_out.sq[i] * params.sq[i])
-                + (osc_out.tri[i] * params.tri[i])
-                + (osc_out.saw[i] * params.saw[i]);
+        // Mix each contributing wave in turn - the first overwrites the
+        // stale data in outbuf, and subsequent waves accumulate on top
+        let out = &mut self.outbuf[0..numsamples];
+        let mut first = true;
+        for (mask, wave, gain) in [
+            (OscWaveforms::SIN, osc_out.sin, params.sin),
+            (OscWaveforms::SQ, osc_out.sq, params.sq),
+            (OscWaveforms::TRI, osc_out.tri, params.tri),
+            (OscWaveforms::SAW, osc_out.saw, params.saw),
+        ] {
+            if !waves.contains(mask) {
+                continue;
+            }
+            if first {
+                Smp::buf_mul(out, wave, gain);
+                first = false;
+            } else {
+                Smp::buf_mul_add(out, wave, gain);
+            }
+        }
+        if first {
+            out.fill(Smp::ZERO);
         }
         &self.outbuf[0..numsamples]
     }
+    /// Access the inner oscillator directly - used by [super::UnisonOsc] to
+    /// drive its center voice with a detune offset applied to the tune input
+    pub(crate) fn engine(&mut self) -> &mut Osc<Smp> {
+        &mut self.osc
+    }
+    /// Run this oscillator for a single sample - the per-sample analog of
+    /// [MixOsc::process], for callers interleaving several devices in one
+    /// loop (see [crate::voice::Voice]).  The waveform mask should be
+    /// computed once per block with [MixOscParams::waveforms], and the `sync`
+    /// argument is used in place of `params.sync` (which is ignored).
+    pub(crate) fn tick(
+        &mut self,
+        tau_over_sr: Smp,
+        note: Smp,
+        params: &MixOscParams<Smp>,
+        waves: OscWaveforms,
+        sync: OscSyncTick<Smp>,
+        i: usize,
+    ) -> Smp {
+        let osc_out = self
+            .osc
+            .tick(tau_over_sr, note, params.tune[i], params.shape[i], waves, sync);
+        let mut mixed = Smp::ZERO;
+        if waves.contains(OscWaveforms::SIN) {
+            mixed = mixed + osc_out.sin * params.sin[i];
+        }
+        if waves.contains(OscWaveforms::SQ) {
+            mixed = mixed + osc_out.sq * params.sq[i];
+        }
+        if waves.contains(OscWaveforms::TRI) {
+            mixed = mixed + osc_out.tri * params.tri[i];
+        }
+        if waves.contains(OscWaveforms::SAW) {
+            mixed = mixed + osc_out.saw * params.saw[i];
+        }
+        mixed
+    }
 }
 
 impl<Smp: Float> Default for MixOsc<Smp> {
@@ -161,15 +243,20 @@ impl<Smp: Float> Default for MixOsc<Smp> {
     }
 }
 
-/// This wraps [OscFxP], combining the oscillator with a mixer for each of the
-/// wave shapes and taking the gain of each wave as a parameter and providing
-/// a pre-mixed output
+/// This wraps an oscillator engine (by default the arithmetic [OscFxP]),
+/// combining the oscillator with a mixer for each of the wave shapes and
+/// taking the gain of each wave as a parameter and providing a pre-mixed
+/// output.  See [OscEngineFxP] for the alternative engines available.
 #[derive(Clone)]
-pub struct MixOscFxP {
+pub struct MixOscFxP<O: OscEngineFxP = OscFxP> {
     outbuf: BufferT<SampleFxP>,
-    osc: OscFxP,
+    osc: O,
 }
 
+/// A [MixOscFxP] built on the band-limited wavetable engine
+#[cfg(feature = "wavetables")]
+pub type WavetableMixOscFxP = MixOscFxP<WavetableOscFxP>;
+
 /// A parameter pack for [MixOscFxP].  This is immutable except for `sync`.
 pub struct MixOscParamsFxP<'a> {
     /// The tuning offset, in semitones offset from 12TET/A440
@@ -214,6 +301,27 @@ impl<'a> MixOscParamsFxP<'a> {
     pub fn with_sync(self, s: OscSync<'a, ScalarFxP>) -> Self {
         Self { sync: s, ..self }
     }
+    /// Determine which waveforms actually contribute to the mix this block,
+    /// i.e. those with a non-zero gain for at least one sample.  This lets
+    /// the inner [OscFxP] skip generating the others entirely (see
+    /// [OscWaveforms]) - most patches only use one or two waveforms per
+    /// oscillator, so this is usually a significant savings.
+    pub fn waveforms(&self) -> OscWaveforms {
+        let mut waves = OscWaveforms::NONE;
+        if self.sin.iter().any(|x| *x != ScalarFxP::ZERO) {
+            waves = waves | OscWaveforms::SIN;
+        }
+        if self.sq.iter().any(|x| *x != ScalarFxP::ZERO) {
+            waves = waves | OscWaveforms::SQ;
+        }
+        if self.tri.iter().any(|x| *x != ScalarFxP::ZERO) {
+            waves = waves | OscWaveforms::TRI;
+        }
+        if self.saw.iter().any(|x| *x != ScalarFxP::ZERO) {
+            waves = waves | OscWaveforms::SAW;
+        }
+        waves
+    }
 }
 
 /// A mutable parameter pack for a [MixOscFxP] - see [MixOscParamsFxP]
@@ -276,7 +384,7 @@ impl<'a> MutMixOscParamsFxP<'a> {
     }
 }
 
-impl MixOscFxP {
+impl<O: OscEngineFxP> MixOscFxP<O> {
     /// Constructor
     pub fn new() -> Self {
         Self {
@@ -295,7 +403,9 @@ impl MixOscFxP {
         ctx: &ContextFxP,
         note: &[NoteFxP],
         params: MixOscParamsFxP,
+        scratch: &mut OscScratch<SampleFxP>,
     ) -> &[SampleFxP] {
+        let waves = params.waveforms();
         let osc_out = self.osc.process(
             ctx,
             note,
@@ -303,21 +413,75 @@ impl MixOscFxP {
                 tune: params.tune,
                 shape: params.shape,
                 sync: params.sync,
+                waves,
             },
+            scratch,
         );
         let numsamples = osc_out.len();
         for i in 0..numsamples {
-            let sin = osc_out.sin[i].wide_mul_unsigned(params.sin[i]);
-            let sq = osc_out.sq[i].wide_mul_unsigned(params.sq[i]);
-            let tri = osc_out.tri[i].wide_mul_unsigned(params.tri[i]);
-            let saw = osc_out.saw[i].wide_mul_unsigned(params.saw[i]);
-            self.outbuf[i] = SampleFxP::from_num(sin + sq + tri + saw);
+            let mut mixed = fixedmath::I4F28::ZERO;
+            if waves.contains(OscWaveforms::SIN) {
+                mixed += osc_out.sin[i].wide_mul_unsigned(params.sin[i]);
+            }
+            if waves.contains(OscWaveforms::SQ) {
+                mixed += osc_out.sq[i].wide_mul_unsigned(params.sq[i]);
+            }
+            if waves.contains(OscWaveforms::TRI) {
+                mixed += osc_out.tri[i].wide_mul_unsigned(params.tri[i]);
+            }
+            if waves.contains(OscWaveforms::SAW) {
+                mixed += osc_out.saw[i].wide_mul_unsigned(params.saw[i]);
+            }
+            self.outbuf[i] = SampleFxP::from_num(mixed);
         }
         &self.outbuf[0..numsamples]
     }
+    /// Access the inner oscillator engine directly - used by
+    /// [super::UnisonOscFxP] to drive its center voice with a detune offset
+    /// applied to the tune input
+    pub(crate) fn engine(&mut self) -> &mut O {
+        &mut self.osc
+    }
+    /// Run this oscillator for a single sample - the per-sample analog of
+    /// [MixOscFxP::process], for callers interleaving several devices in one
+    /// loop (see [crate::voice::VoiceFxP]).  The waveform mask should be
+    /// computed once per block with [MixOscParamsFxP::waveforms], and the
+    /// `sync` argument is used in place of `params.sync` (which is ignored).
+    pub(crate) fn tick(
+        &mut self,
+        frac_2pi4096_sr: ScalarFxP,
+        note: NoteFxP,
+        params: &MixOscParamsFxP,
+        waves: OscWaveforms,
+        sync: OscSyncTick<ScalarFxP>,
+        i: usize,
+    ) -> SampleFxP {
+        let osc_out = self.osc.tick(
+            frac_2pi4096_sr,
+            note,
+            params.tune[i],
+            params.shape[i],
+            waves,
+            sync,
+        );
+        let mut mixed = fixedmath::I4F28::ZERO;
+        if waves.contains(OscWaveforms::SIN) {
+            mixed += osc_out.sin.wide_mul_unsigned(params.sin[i]);
+        }
+        if waves.contains(OscWaveforms::SQ) {
+            mixed += osc_out.sq.wide_mul_unsigned(params.sq[i]);
+        }
+        if waves.contains(OscWaveforms::TRI) {
+            mixed += osc_out.tri.wide_mul_unsigned(params.tri[i]);
+        }
+        if waves.contains(OscWaveforms::SAW) {
+            mixed += osc_out.saw.wide_mul_unsigned(params.saw[i]);
+        }
+        SampleFxP::from_num(mixed)
+    }
 }
 
-impl Default for MixOscFxP {
+impl<O: OscEngineFxP> Default for MixOscFxP<O> {
     fn default() -> Self {
         Self::new()
     }
@@ -8,6 +8,7 @@ mod mixosc;
 mod modfilt;
 mod osc;
 mod ringmod;
+mod unison;
 
 use crate::context::{Context, ContextFxP};
 use crate::{
@@ -57,6 +58,24 @@ pub trait Float: NumTraitsFloat + num_traits::FloatConst + From<u16> + Default +
     }
     /// Return a buffer of zeros
     fn zerobuf<'a>() -> &'a [Self; STATIC_BUFFER_SIZE];
+    /// Element-wise multiply `a` and `b` into `dst`, truncating to the
+    /// shortest of the three slices.  The default implementation is a scalar
+    /// loop; `f32` overrides it with a vectorized kernel when the `simd`
+    /// feature is enabled.
+    fn buf_mul(dst: &mut [Self], a: &[Self], b: &[Self]) {
+        for ((d, a), b) in dst.iter_mut().zip(a).zip(b) {
+            *d = *a * *b;
+        }
+    }
+    /// Element-wise multiply `a` and `b` and accumulate the products into
+    /// `dst`, truncating to the shortest of the three slices.  The default
+    /// implementation is a scalar loop; `f32` overrides it with a vectorized
+    /// kernel when the `simd` feature is enabled.
+    fn buf_mul_add(dst: &mut [Self], a: &[Self], b: &[Self]) {
+        for ((d, a), b) in dst.iter_mut().zip(a).zip(b) {
+            *d = *d + (*a * *b);
+        }
+    }
     /// Returns the sine of self
     fn fsin(self) -> Self;
     /// Returns the cosine of self
@@ -81,6 +100,22 @@ impl Float for f32 {
     fn zerobuf<'a>() -> &'a [Self; STATIC_BUFFER_SIZE] {
         &F32_ZEROBUF
     }
+    fn buf_mul(dst: &mut [Self], a: &[Self], b: &[Self]) {
+        #[cfg(all(feature = "simd", target_arch = "x86_64"))]
+        crate::simd::mul(dst, a, b);
+        #[cfg(not(all(feature = "simd", target_arch = "x86_64")))]
+        for ((d, a), b) in dst.iter_mut().zip(a).zip(b) {
+            *d = *a * *b;
+        }
+    }
+    fn buf_mul_add(dst: &mut [Self], a: &[Self], b: &[Self]) {
+        #[cfg(all(feature = "simd", target_arch = "x86_64"))]
+        crate::simd::mul_add(dst, a, b);
+        #[cfg(not(all(feature = "simd", target_arch = "x86_64")))]
+        for ((d, a), b) in dst.iter_mut().zip(a).zip(b) {
+            *d = *d + (*a * *b);
+        }
+    }
     fn fsin(self) -> Self {
         #[cfg(not(feature = "libm"))]
         let ret = crate::float_approx::sin_approx(self);
@@ -158,7 +193,8 @@ impl Float for f64 {
 pub use amp::{Amp, AmpFxP};
 pub use env::{Env, EnvFxP, EnvParams, EnvParamsFxP, MutEnvParams, MutEnvParamsFxP};
 pub use filt::{
-    Filt, FiltFxP, FiltOutput, FiltOutputFxP, FiltParams, FiltParamsFxP, MutFiltParamsFxP,
+    Filt, FiltFxP, FiltOutput, FiltOutputFxP, FiltOversample, FiltParams, FiltParamsFxP,
+    MutFiltParamsFxP,
 };
 pub use lfo::{
     Lfo, LfoFxP, LfoOptions, LfoParams, LfoParamsFxP, LfoWave, MutLfoParams, MutLfoParamsFxP,
@@ -169,7 +205,17 @@ pub use mixosc::{
 pub use modfilt::{
     ModFilt, ModFiltFxP, ModFiltParams, ModFiltParamsFxP, MutModFiltParams, MutModFiltParamsFxP,
 };
-pub use osc::{Osc, OscFxP, OscOutput, OscParams, OscParamsFxP, OscSync};
+pub use osc::{
+    Osc, OscEngineFxP, OscFxP, OscOutput, OscOutputSample, OscParams, OscParamsFxP, OscScratch,
+    OscSync, OscSyncTick, OscWaveforms,
+};
+#[cfg(feature = "wavetables")]
+pub use mixosc::WavetableMixOscFxP;
+#[cfg(feature = "wavetables")]
+pub use osc::WavetableOscFxP;
 pub use ringmod::{
     MutRingModParams, MutRingModParamsFxP, RingMod, RingModFxP, RingModParams, RingModParamsFxP,
 };
+pub use unison::{UnisonOsc, UnisonOscFxP, UnisonOscParams, UnisonOscParamsFxP, UNISON_MAX};
+#[cfg(feature = "wavetables")]
+pub use unison::WavetableUnisonOscFxP;
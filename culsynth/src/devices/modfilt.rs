@@ -21,6 +21,8 @@ pub struct ModFiltParams<'a, Smp> {
     pub band_mix: &'a [Smp],
     /// The mix of the high-pass output of the filter
     pub high_mix: &'a [Smp],
+    /// The internal oversampling mode of the filter (see [FiltOversample])
+    pub oversample: FiltOversample,
 }
 
 impl<'a, Smp> ModFiltParams<'a, Smp> {
@@ -64,6 +66,8 @@ pub struct MutModFiltParams<'a, Smp> {
     pub band_mix: &'a mut [Smp],
     /// The mix of the high-pass output of the filter
     pub high_mix: &'a mut [Smp],
+    /// The internal oversampling mode of the filter (see [FiltOversample])
+    pub oversample: FiltOversample,
 }
 
 impl<'a, Smp> MutModFiltParams<'a, Smp> {
@@ -98,6 +102,7 @@ impl<'a, Smp> From<MutModFiltParams<'a, Smp>> for ModFiltParams<'a, Smp> {
             low_mix: value.low_mix,
             band_mix: value.band_mix,
             high_mix: value.high_mix,
+            oversample: value.oversample,
         }
     }
 }
@@ -156,16 +161,47 @@ impl<Smp: Float> ModFilt<Smp> {
             FiltParams {
                 cutoff: &self.outbuf[0..numsamples],
                 resonance: params.resonance,
+                oversample: params.oversample,
             },
         );
         //now mix the outputs
-        for i in 0..numsamples {
-            self.outbuf[i] = (params.low_mix[i] * filt_out.low[i])
-                + (params.band_mix[i] * filt_out.band[i])
-                + (params.high_mix[i] * filt_out.high[i]);
-        }
+        let out = &mut self.outbuf[0..numsamples];
+        Smp::buf_mul(out, params.low_mix, filt_out.low);
+        Smp::buf_mul_add(out, params.band_mix, filt_out.band);
+        Smp::buf_mul_add(out, params.high_mix, filt_out.high);
         &self.outbuf[0..numsamples]
     }
+    /// Run the filter for a single sample - the per-sample analog of
+    /// [ModFilt::process], for callers interleaving several devices in one
+    /// loop (see [crate::voice::Voice]).  `pi_over_sr` is pi divided by the
+    /// sample rate, which is loop-invariant and should be computed once per
+    /// block by the caller.
+    #[cfg_attr(feature = "profile", allow(dead_code))]
+    pub(crate) fn tick(
+        &mut self,
+        pi_over_sr: Smp,
+        input: Smp,
+        env: Smp,
+        note: Smp,
+        vel: Smp,
+        params: &ModFiltParams<Smp>,
+        i: usize,
+    ) -> Smp {
+        let mut cutoff = Smp::NOTE_MAX * params.env_mod[i] * env;
+        cutoff = cutoff + (Smp::NOTE_MAX * params.vel_mod[i] * vel);
+        cutoff = cutoff + params.cutoff[i] + (params.kbd[i] * note);
+        // saturate the cutoff if it's higher than note_max
+        if cutoff > Smp::NOTE_MAX {
+            cutoff = Smp::NOTE_MAX;
+        }
+        let (low, band, high) = match params.oversample {
+            FiltOversample::Off => self.filter.tick(pi_over_sr, input, cutoff, params.resonance[i]),
+            FiltOversample::TwoX => {
+                self.filter.tick_2x(pi_over_sr, input, cutoff, params.resonance[i])
+            }
+        };
+        params.low_mix[i] * low + params.band_mix[i] * band + params.high_mix[i] * high
+    }
 }
 
 impl<Smp: Float> Default for ModFilt<Smp> {
@@ -194,6 +230,8 @@ pub struct ModFiltParamsFxP<'a> {
     pub band_mix: &'a [ScalarFxP],
     /// The mix of the high-pass output of the filter
     pub high_mix: &'a [ScalarFxP],
+    /// The internal oversampling mode of the filter (see [FiltOversample])
+    pub oversample: FiltOversample,
 }
 
 impl<'a> ModFiltParamsFxP<'a> {
@@ -236,6 +274,8 @@ pub struct MutModFiltParamsFxP<'a> {
     pub band_mix: &'a mut [ScalarFxP],
     /// The mix of the high-pass output of the filter
     pub high_mix: &'a mut [ScalarFxP],
+    /// The internal oversampling mode of the filter (see [FiltOversample])
+    pub oversample: FiltOversample,
 }
 
 impl<'a> MutModFiltParamsFxP<'a> {
@@ -270,6 +310,7 @@ impl<'a> From<MutModFiltParamsFxP<'a>> for ModFiltParamsFxP<'a> {
             low_mix: value.low_mix,
             band_mix: value.band_mix,
             high_mix: value.high_mix,
+            oversample: value.oversample,
         }
     }
 }
@@ -332,6 +373,7 @@ impl ModFiltFxP {
             FiltParamsFxP {
                 cutoff: &self.modbuf[0..numsamples],
                 resonance: params.resonance,
+                oversample: params.oversample,
             },
         );
         //now mix the outputs
@@ -343,6 +385,45 @@ impl ModFiltFxP {
         }
         &self.outbuf[0..numsamples]
     }
+    /// Run the filter for a single sample - the per-sample analog of
+    /// [ModFiltFxP::process], for callers interleaving several devices in one
+    /// loop (see [crate::voice::VoiceFxP]).  `frac_2pi4096_sr` is the
+    /// loop-invariant sample rate constant (see
+    /// [crate::context::FixedSampleRate::frac_2pi4096_sr]), which should be
+    /// looked up once per block by the caller.
+    #[cfg_attr(feature = "profile", allow(dead_code))]
+    pub(crate) fn tick(
+        &mut self,
+        frac_2pi4096_sr: ScalarFxP,
+        input: SampleFxP,
+        env: ScalarFxP,
+        note: NoteFxP,
+        vel: ScalarFxP,
+        params: &ModFiltParamsFxP,
+        i: usize,
+    ) -> SampleFxP {
+        // reinterpret the env_mod as a number from 0 to NOTE_MAX instead of 0 to 1,
+        // then multiply by the envelope output:
+        let envmod = apply_scalar_u(NoteFxP::from_bits(params.env_mod[i].to_bits()), env);
+        let velmod = apply_scalar_u(NoteFxP::from_bits(params.vel_mod[i].to_bits()), vel);
+        let kbdmod = apply_scalar_u(note, params.kbd[i]);
+        let cutoff = params.cutoff[i]
+            .saturating_add(envmod)
+            .saturating_add(velmod)
+            .saturating_add(kbdmod);
+        let (low, band, high) = match params.oversample {
+            FiltOversample::Off => {
+                self.filter.tick(frac_2pi4096_sr, input, cutoff, params.resonance[i])
+            }
+            FiltOversample::TwoX => {
+                self.filter.tick_2x(frac_2pi4096_sr, input, cutoff, params.resonance[i])
+            }
+        };
+        let low = params.low_mix[i].wide_mul_signed(low);
+        let band = params.band_mix[i].wide_mul_signed(band);
+        let high = params.high_mix[i].wide_mul_signed(high);
+        SampleFxP::from_num(low.saturating_add(band).saturating_add(high))
+    }
 }
 
 impl Default for ModFiltFxP {
@@ -29,6 +29,7 @@ pub(crate) type PhaseFxP = fixedmath::I4F28;
 /// let ctx = Context::new(48000f32);
 /// let mut osc1 = Osc::<f32>::new();
 /// let mut osc2 = Osc::<f32>::new();
+/// let mut scratch = OscScratch::<f32>::new();
 /// let osc1_pitch = [midi_const::A4 as f32; NUMSAMPLES];
 /// let osc2_pitch = [midi_const::C3 as f32; NUMSAMPLES];
 /// let zerobuf = [0f32; NUMSAMPLES];
@@ -40,7 +41,9 @@ pub(crate) type PhaseFxP = fixedmath::I4F28;
 ///         tune: &zerobuf,
 ///         shape: &zerobuf,
 ///         sync: OscSync::Master(&mut syncbuf),
+///         waves: OscWaveforms::ALL,
 ///     },
+///     &mut scratch,
 /// );
 /// osc2.process(
 ///     &ctx,
@@ -49,7 +52,9 @@ pub(crate) type PhaseFxP = fixedmath::I4F28;
 ///         tune: &zerobuf,
 ///         shape: &zerobuf,
 ///         sync: OscSync::Slave(&syncbuf),
+///         waves: OscWaveforms::ALL,
 ///     },
+///     &mut scratch,
 /// );
 /// ```
 pub enum OscSync<'a, Smp> {
@@ -83,18 +88,160 @@ impl<'a, Smp> OscSync<'a, Smp> {
     }
 }
 
+impl<'a, Smp: Copy> OscSync<'a, Smp> {
+    /// Borrow the sync data for sample `i` of this block (see [OscSyncTick])
+    pub fn at(&mut self, i: usize) -> OscSyncTick<Smp> {
+        match self {
+            OscSync::Off => OscSyncTick::Off,
+            OscSync::Master(x) => OscSyncTick::Master(&mut x[i]),
+            OscSync::Slave(x) => OscSyncTick::Slave(x[i]),
+        }
+    }
+}
+
+/// The single-sample analog of [OscSync], passed to the per-sample `tick`
+/// entry points.  A master oscillator reads its enable flag from (and writes
+/// its crossing information back to) the referenced sample; a slave receives
+/// the master's crossing information by value.
+pub enum OscSyncTick<'a, Smp> {
+    /// No sync behavior - do not calculate
+    Off,
+    /// This is the master oscillator - see [OscSync::Master]
+    Master(&'a mut Smp),
+    /// This is the slave oscillator - see [OscSync::Slave]
+    Slave(Smp),
+}
+
+/// A bitmask of the waveforms an oscillator should generate on a given block.
+/// Most patches only consume one or two of the four outputs, so callers that
+/// know which outputs they will actually mix (see e.g. [super::MixOsc]) can
+/// skip the per-sample work of generating the others entirely.  This fits in
+/// 8 bits but uses the same `u16` representation as [super::LfoOptions] to
+/// allow for future expansion.
+#[repr(transparent)]
+#[derive(Clone, Copy, PartialEq, Eq)]
+pub struct OscWaveforms {
+    bits: u16,
+}
+
+impl OscWaveforms {
+    /// Sine wave
+    pub const SIN: Self = Self { bits: 1 };
+    /// Square wave
+    pub const SQ: Self = Self { bits: 1 << 1 };
+    /// Triangle wave
+    pub const TRI: Self = Self { bits: 1 << 2 };
+    /// Sawtooth wave
+    pub const SAW: Self = Self { bits: 1 << 3 };
+    /// All four waveforms - equivalent to the behavior before masking existed
+    pub const ALL: Self = Self { bits: 0xF };
+    /// No waveforms - only advance the oscillator phase (and sync, if enabled)
+    pub const NONE: Self = Self { bits: 0 };
+    /// True if every waveform in `other` is also set in `self`
+    pub const fn contains(&self, other: Self) -> bool {
+        self.bits & other.bits == other.bits
+    }
+    /// True if any waveform in `other` is also set in `self`
+    pub const fn intersects(&self, other: Self) -> bool {
+        self.bits & other.bits != 0
+    }
+}
+
+impl core::ops::BitOr for OscWaveforms {
+    type Output = Self;
+    fn bitor(self, rhs: Self) -> Self {
+        Self {
+            bits: self.bits | rhs.bits,
+        }
+    }
+}
+
+impl Default for OscWaveforms {
+    /// The default is to generate all waveforms
+    fn default() -> Self {
+        Self::ALL
+    }
+}
+
+/// Scratch space for the transient waveform buffers of an [Osc]/[OscFxP].
+///
+/// The oscillator itself only holds persistent state (its phase); the four
+/// waveform buffers it writes only live for the duration of a single call to
+/// `process()`, so callers supply them here and may share one scratch between
+/// every oscillator processed sequentially on a thread (e.g. both oscillators
+/// of every voice) rather than each oscillator carrying several KB of buffers
+/// for its entire lifetime.
+#[derive(Clone)]
+pub struct OscScratch<T> {
+    sin: BufferT<T>,
+    sq: BufferT<T>,
+    tri: BufferT<T>,
+    saw: BufferT<T>,
+}
+
+impl<T: Copy + Default> OscScratch<T> {
+    /// Constructor
+    pub fn new() -> Self {
+        Self {
+            sin: [T::default(); STATIC_BUFFER_SIZE],
+            sq: [T::default(); STATIC_BUFFER_SIZE],
+            tri: [T::default(); STATIC_BUFFER_SIZE],
+            saw: [T::default(); STATIC_BUFFER_SIZE],
+        }
+    }
+}
+
+impl<T: Copy + Default> Default for OscScratch<T> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+/// A one-entry cache of the phase increment corresponding to a note, so the
+/// (comparatively expensive) note to frequency conversion only runs when the
+/// pitch actually changes.  Between pitch bend gestures the note input is
+/// typically constant for entire blocks at a time, so in the common case this
+/// reduces the per-sample cost of following the note slice to a compare.
+#[derive(Clone)]
+struct PhaseIncrCache<Smp> {
+    note: Smp,
+    tau_over_sr: Smp,
+    phase_per_sample: Smp,
+}
+
+impl<Smp: Float> PhaseIncrCache<Smp> {
+    fn new() -> Self {
+        Self {
+            // tau_over_sr is never zero in use, so the first tick will always
+            // miss and recompute:
+            note: Smp::ZERO,
+            tau_over_sr: Smp::ZERO,
+            phase_per_sample: Smp::ZERO,
+        }
+    }
+    fn get(&mut self, note: Smp, tau_over_sr: Smp) -> Smp {
+        if note != self.note || tau_over_sr != self.tau_over_sr {
+            self.note = note;
+            self.tau_over_sr = tau_over_sr;
+            self.phase_per_sample = note.midi_to_freq() * tau_over_sr;
+        }
+        self.phase_per_sample
+    }
+}
+
 /// A floating point Oscillator providing Sine, Square, Sawtooth, and Triangle outputs.
 #[derive(Clone)]
 pub struct Osc<Smp> {
-    sinbuf: BufferT<Smp>,
-    sqbuf: BufferT<Smp>,
-    tribuf: BufferT<Smp>,
-    sawbuf: BufferT<Smp>,
     phase: Smp,
+    incr: PhaseIncrCache<Smp>,
 }
 
 /// A struct wrapping the various output signals of an [Osc].  All signals
 /// are in phase with each other.
+///
+/// Note: if a waveform was not requested in the [OscWaveforms] mask passed
+/// to `process()`, its slice here refers to stale data from a previous call
+/// and must not be consumed.
 pub struct OscOutput<'a, Smp> {
     /// Sine Wave
     pub sin: &'a [Smp],
@@ -117,6 +264,21 @@ impl<'a, Smp> OscOutput<'a, Smp> {
     }
 }
 
+/// A single sample of oscillator output - the per-sample analog of
+/// [OscOutput], returned by the `tick` entry points.  Waveforms that were
+/// not requested in the [OscWaveforms] mask are left at zero.
+#[derive(Clone, Copy)]
+pub struct OscOutputSample<Smp> {
+    /// Sine Wave
+    pub sin: Smp,
+    /// Square Wave
+    pub sq: Smp,
+    /// Triangle Wave
+    pub tri: Smp,
+    /// Sawtooth Wave
+    pub saw: Smp,
+}
+
 /// A wrapper struct for passing parameters into the floating-point [Osc].
 pub struct OscParams<'a, Smp> {
     /// Tune control as an offset from the commanded note, in semitones
@@ -125,6 +287,8 @@ pub struct OscParams<'a, Smp> {
     pub shape: &'a [Smp],
     /// Controls oscillator sync (see [OscSync] for further details)
     pub sync: OscSync<'a, Smp>,
+    /// The waveforms to generate this block (see [OscWaveforms])
+    pub waves: OscWaveforms,
 }
 
 impl<'a, Smp> OscParams<'a, Smp> {
@@ -139,11 +303,11 @@ impl<'a, Smp> OscParams<'a, Smp> {
     }
     /// Replace the sync parameter in `self`, consuming `self` and returning the new struct.
     pub fn with_sync(self, s: OscSync<'a, Smp>) -> Self {
-        Self {
-            tune: self.tune,
-            shape: self.shape,
-            sync: s,
-        }
+        Self { sync: s, ..self }
+    }
+    /// Replace the waveform mask in `self`, consuming `self` and returning the new struct.
+    pub fn with_waveforms(self, w: OscWaveforms) -> Self {
+        Self { waves: w, ..self }
     }
 }
 
@@ -151,11 +315,8 @@ impl<Smp: Float> Osc<Smp> {
     /// Constructor
     pub fn new() -> Self {
         Self {
-            sinbuf: [Smp::zero(); STATIC_BUFFER_SIZE],
-            sqbuf: [Smp::zero(); STATIC_BUFFER_SIZE],
-            tribuf: [Smp::zero(); STATIC_BUFFER_SIZE],
-            sawbuf: [Smp::zero(); STATIC_BUFFER_SIZE],
             phase: Smp::zero(),
+            incr: PhaseIncrCache::new(),
         }
     }
     /// Run the oscillator, using the given note signal and parameters.
@@ -164,128 +325,189 @@ impl<Smp: Float> Osc<Smp> {
     ///
     /// See [OscSync] for the semantics of the `sync` argument.
     ///
+    /// The output waveforms are written into (and borrowed from) `scratch`,
+    /// which may be shared with any other oscillators processed sequentially
+    /// (see [OscScratch]).
+    ///
     /// Note: The output slices from this function may be shorter than the
     /// input slices.  Callers must check the number of returned samples and
     /// copy them into their own output buffers before calling this function
     /// again to process the remainder of the data.
-    pub fn process(
+    pub fn process<'a>(
         &mut self,
         ctx: &Context<Smp>,
         note: &[Smp],
         params: OscParams<Smp>,
-    ) -> OscOutput<Smp> {
+        scratch: &'a mut OscScratch<Smp>,
+    ) -> OscOutput<'a, Smp> {
         let numsamples = min_size(&[note.len(), params.len(), STATIC_BUFFER_SIZE]);
         let mut sync = params.sync;
         let shape = params.shape;
         let tune = params.tune;
-        // We don't have to split sin up piecewise but we'll do it for symmetry with
-        // the fixed point implementation and to make it easy to switch to an
-        // approximation if performance dictates
+        let waves = params.waves;
+        let tau_over_sr = Smp::TAU() / ctx.sample_rate;
         for i in 0..numsamples {
-            //generate waveforms (piecewise defined)
-            let frac_2phase_pi = self.phase * Smp::FRAC_2_PI();
-            self.sawbuf[i] = frac_2phase_pi / Smp::TWO;
+            let out = self.tick(tau_over_sr, note[i], tune[i], shape[i], waves, sync.at(i));
+            if waves.contains(OscWaveforms::SIN) {
+                scratch.sin[i] = out.sin;
+            }
+            if waves.contains(OscWaveforms::SQ) {
+                scratch.sq[i] = out.sq;
+            }
+            if waves.contains(OscWaveforms::TRI) {
+                scratch.tri[i] = out.tri;
+            }
+            if waves.contains(OscWaveforms::SAW) {
+                scratch.saw[i] = out.saw;
+            }
+        }
+        OscOutput {
+            sin: &scratch.sin[0..numsamples],
+            tri: &scratch.tri[0..numsamples],
+            sq: &scratch.sq[0..numsamples],
+            saw: &scratch.saw[0..numsamples],
+        }
+    }
+    /// Generate a single sample, using the given note and parameters - the
+    /// per-sample analog of [Osc::process], for callers interleaving several
+    /// devices in one loop (see [crate::voice::Voice]).  `tau_over_sr` is
+    /// 2*pi divided by the sample rate, which is loop-invariant and should be
+    /// computed once per block by the caller.
+    pub fn tick(
+        &mut self,
+        tau_over_sr: Smp,
+        note: Smp,
+        tune: Smp,
+        shape: Smp,
+        waves: OscWaveforms,
+        sync: OscSyncTick<Smp>,
+    ) -> OscOutputSample<Smp> {
+        let mut out = OscOutputSample {
+            sin: Smp::ZERO,
+            sq: Smp::ZERO,
+            tri: Smp::ZERO,
+            saw: Smp::ZERO,
+        };
+        //generate waveforms (piecewise defined) - but only those the caller
+        //asked for in the mask.  The mask is loop-invariant so the branches
+        //below are well-predicted (and hoistable by the compiler).
+        //
+        // We don't have to split sin up piecewise but we'll do it for symmetry
+        // with the fixed point implementation and to make it easy to switch to
+        // an approximation if performance dictates
+        let frac_2phase_pi = self.phase * Smp::FRAC_2_PI();
+        if waves.contains(OscWaveforms::SAW) {
+            out.saw = frac_2phase_pi / Smp::TWO;
+        }
+        if waves.intersects(OscWaveforms::SIN | OscWaveforms::SQ | OscWaveforms::TRI) {
             if self.phase < Smp::ZERO {
-                self.sqbuf[i] = Smp::ONE.neg();
+                if waves.contains(OscWaveforms::SQ) {
+                    out.sq = Smp::ONE.neg();
+                }
                 if self.phase < Smp::FRAC_PI_2().neg() {
                     // phase in [-pi, pi/2)
                     // sin(x) = -cos(x+pi/2)
                     // TODO: Use fast approximation?
-                    self.sinbuf[i] = (self.phase + Smp::FRAC_PI_2()).fcos().neg();
+                    if waves.contains(OscWaveforms::SIN) {
+                        out.sin = (self.phase + Smp::FRAC_PI_2()).fcos().neg();
+                    }
                     // Subtract (1+1) because traits :eyeroll:
-                    self.tribuf[i] = frac_2phase_pi.neg() - Smp::TWO;
+                    if waves.contains(OscWaveforms::TRI) {
+                        out.tri = frac_2phase_pi.neg() - Smp::TWO;
+                    }
                 } else {
                     // phase in [-pi/2, 0)
-                    self.sinbuf[i] = self.phase.fsin();
+                    if waves.contains(OscWaveforms::SIN) {
+                        out.sin = self.phase.fsin();
+                    }
                     //triangle
-                    self.tribuf[i] = frac_2phase_pi;
+                    if waves.contains(OscWaveforms::TRI) {
+                        out.tri = frac_2phase_pi;
+                    }
                 }
             } else {
-                self.sqbuf[i] = Smp::ONE;
+                if waves.contains(OscWaveforms::SQ) {
+                    out.sq = Smp::ONE;
+                }
                 if self.phase < Smp::FRAC_PI_2() {
                     // phase in [0, pi/2)
-                    self.sinbuf[i] = self.phase.fsin();
-                    self.tribuf[i] = frac_2phase_pi;
+                    if waves.contains(OscWaveforms::SIN) {
+                        out.sin = self.phase.fsin();
+                    }
+                    if waves.contains(OscWaveforms::TRI) {
+                        out.tri = frac_2phase_pi;
+                    }
                 } else {
                     // phase in [pi/2, pi)
                     // sin(x) = cos(x-pi/2)
-                    self.sinbuf[i] = (self.phase - Smp::FRAC_PI_2()).fcos();
-                    self.tribuf[i] = Smp::TWO - frac_2phase_pi;
-                }
-            }
-            //calculate the next phase
-            let freq = (note[i] + tune[i]).midi_to_freq();
-            let phase_per_sample = freq * Smp::TAU() / ctx.sample_rate;
-            let shape_clip = Smp::SHAPE_CLIP;
-            let shp = if shape[i] < shape_clip {
-                shape[i]
-            } else {
-                shape_clip
-            };
-            // Handle slave oscillator resetting phase if master crosses:
-            if let OscSync::Slave(syncbuf) = sync {
-                if syncbuf[i] != Smp::ZERO {
-                    self.phase = Smp::ZERO;
+                    if waves.contains(OscWaveforms::SIN) {
+                        out.sin = (self.phase - Smp::FRAC_PI_2()).fcos();
+                    }
+                    if waves.contains(OscWaveforms::TRI) {
+                        out.tri = Smp::TWO - frac_2phase_pi;
+                    }
                 }
             }
-            let phase_per_smp_adj = if self.phase < Smp::ZERO {
-                phase_per_sample * (Smp::ONE / (Smp::ONE + shp))
-            } else {
-                phase_per_sample * (Smp::ONE / (Smp::ONE - shp))
-            };
-            let old_phase = self.phase;
-            match sync {
-                OscSync::Off => {
-                    self.phase = self.phase + phase_per_smp_adj;
-                }
-                OscSync::Master(ref mut syncbuf) => {
-                    self.phase = self.phase + phase_per_smp_adj;
-                    // calculate what time in this sampling period the phase crossed zero:
-                    syncbuf[i] = if syncbuf[i] != Smp::ZERO
-                        && old_phase < Smp::ZERO
-                        && self.phase >= Smp::ZERO
-                    {
-                        Smp::ONE - (self.phase / phase_per_smp_adj)
-                    } else {
-                        Smp::ZERO
-                    };
-                }
-                OscSync::Slave(syncbuf) => {
-                    self.phase = self.phase
-                        + if syncbuf[i] != Smp::ZERO {
-                            phase_per_smp_adj * (Smp::ONE - syncbuf[i])
-                        } else {
-                            phase_per_smp_adj
-                        };
-                }
+        }
+        //calculate the next phase
+        let phase_per_sample = self.incr.get(note + tune, tau_over_sr);
+        let shape_clip = Smp::SHAPE_CLIP;
+        let shp = if shape < shape_clip { shape } else { shape_clip };
+        // Handle slave oscillator resetting phase if master crosses:
+        if let OscSyncTick::Slave(s) = &sync {
+            if *s != Smp::ZERO {
+                self.phase = Smp::ZERO;
             }
-            // make sure we calculate the correct new phase on transitions for assymmetric waves:
-            // check if we've crossed from negative to positive phase
-            if old_phase < Smp::ZERO && self.phase > Smp::ZERO && shp != Smp::ZERO {
-                // need to multiply residual phase i.e. (phase - 0) by (1+k)/(1-k)
-                // where k is the shape, so no work required if shape is 0
-                self.phase = self.phase * (Smp::ONE + shp) / (Smp::ONE - shp);
+        }
+        let phase_per_smp_adj = if self.phase < Smp::ZERO {
+            phase_per_sample * (Smp::ONE / (Smp::ONE + shp))
+        } else {
+            phase_per_sample * (Smp::ONE / (Smp::ONE - shp))
+        };
+        let old_phase = self.phase;
+        match sync {
+            OscSyncTick::Off => {
+                self.phase = self.phase + phase_per_smp_adj;
             }
-            // Check if we've crossed from positive phase back to negative:
-            if self.phase >= Smp::PI() {
-                // if we're a symmetric wave this is as simple as just subtract 2pi
-                if shp == Smp::ZERO {
-                    self.phase = self.phase - Smp::TAU();
+            OscSyncTick::Master(s) => {
+                self.phase = self.phase + phase_per_smp_adj;
+                // calculate what time in this sampling period the phase crossed zero:
+                *s = if *s != Smp::ZERO && old_phase < Smp::ZERO && self.phase >= Smp::ZERO {
+                    Smp::ONE - (self.phase / phase_per_smp_adj)
                 } else {
-                    // if assymmetric we have to multiply residual phase i.e. phase - pi
-                    // by (1-k)/(1+k) where k is the shape:
-                    let delta = (self.phase - Smp::PI()) * (Smp::ONE - shp) / (Smp::ONE + shp);
-                    // add new change in phase to our baseline, -pi:
-                    self.phase = delta - Smp::PI();
-                }
+                    Smp::ZERO
+                };
+            }
+            OscSyncTick::Slave(s) => {
+                self.phase = self.phase
+                    + if s != Smp::ZERO {
+                        phase_per_smp_adj * (Smp::ONE - s)
+                    } else {
+                        phase_per_smp_adj
+                    };
             }
         }
-        OscOutput {
-            sin: &self.sinbuf[0..numsamples],
-            tri: &self.tribuf[0..numsamples],
-            sq: &self.sqbuf[0..numsamples],
-            saw: &self.sawbuf[0..numsamples],
+        // make sure we calculate the correct new phase on transitions for assymmetric waves:
+        // check if we've crossed from negative to positive phase
+        if old_phase < Smp::ZERO && self.phase > Smp::ZERO && shp != Smp::ZERO {
+            // need to multiply residual phase i.e. (phase - 0) by (1+k)/(1-k)
+            // where k is the shape, so no work required if shape is 0
+            self.phase = self.phase * (Smp::ONE + shp) / (Smp::ONE - shp);
         }
+        // Check if we've crossed from positive phase back to negative:
+        if self.phase >= Smp::PI() {
+            // if we're a symmetric wave this is as simple as just subtract 2pi
+            if shp == Smp::ZERO {
+                self.phase = self.phase - Smp::TAU();
+            } else {
+                // if assymmetric we have to multiply residual phase i.e. phase - pi
+                // by (1-k)/(1+k) where k is the shape:
+                let delta = (self.phase - Smp::PI()) * (Smp::ONE - shp) / (Smp::ONE + shp);
+                // add new change in phase to our baseline, -pi:
+                self.phase = delta - Smp::PI();
+            }
+        }
+        out
     }
 }
 
@@ -303,6 +525,8 @@ pub struct OscParamsFxP<'a> {
     pub shape: &'a [ScalarFxP],
     /// Controls oscillator sync
     pub sync: OscSync<'a, ScalarFxP>,
+    /// The waveforms to generate this block (see [OscWaveforms])
+    pub waves: OscWaveforms,
 }
 
 impl<'a> OscParamsFxP<'a> {
@@ -318,33 +542,68 @@ impl<'a> OscParamsFxP<'a> {
     }
     /// Replace the sync parameter of `self`, consuming `self` and returning the resultant struct.
     pub fn with_sync(self, s: OscSync<'a, ScalarFxP>) -> Self {
+        Self { sync: s, ..self }
+    }
+    /// Replace the waveform mask of `self`, consuming `self` and returning the resultant struct.
+    pub fn with_waveforms(self, w: OscWaveforms) -> Self {
+        Self { waves: w, ..self }
+    }
+}
+
+/// The fixed-point analog of [PhaseIncrCache] - a one-entry cache of the
+/// phase increment corresponding to a note, keyed on the note and the sample
+/// rate constant, so the note to frequency conversion only runs when the
+/// pitch actually changes.
+#[derive(Clone)]
+struct PhaseIncrCacheFxP {
+    note: NoteFxP,
+    frac_2pi4096_sr: ScalarFxP,
+    phase_per_sample: fixedmath::U4F28,
+}
+
+impl PhaseIncrCacheFxP {
+    const fn new() -> Self {
         Self {
-            tune: self.tune,
-            shape: self.shape,
-            sync: s,
+            note: NoteFxP::ZERO,
+            // never a valid sample rate constant, so the first tick will
+            // always miss and recompute:
+            frac_2pi4096_sr: ScalarFxP::ZERO,
+            phase_per_sample: fixedmath::U4F28::ZERO,
         }
     }
+    fn get(&mut self, note: NoteFxP, frac_2pi4096_sr: ScalarFxP) -> fixedmath::U4F28 {
+        if note != self.note || frac_2pi4096_sr != self.frac_2pi4096_sr {
+            self.note = note;
+            self.frac_2pi4096_sr = frac_2pi4096_sr;
+            // we need to divide by 2^12 here, but we're increasing the
+            // fractional part by 10 bits so we'll only actually shift by 2
+            // places and then use a bitcast for the remaining logical 10 bits:
+            self.phase_per_sample = fixedmath::U4F28::from_bits(
+                fixedmath::scale_fixedfloat(
+                    fixedmath::midi_note_to_frequency_lut(note),
+                    frac_2pi4096_sr,
+                )
+                .unwrapped_shr(2)
+                .to_bits(),
+            );
+        }
+        self.phase_per_sample
+    }
 }
 
 /// A fixed-point oscillator providing sine, square, triangle, and sawtooth waves.
 #[derive(Clone)]
 pub struct OscFxP {
-    sinbuf: BufferT<SampleFxP>,
-    sqbuf: BufferT<SampleFxP>,
-    tribuf: BufferT<SampleFxP>,
-    sawbuf: BufferT<SampleFxP>,
     phase: PhaseFxP,
+    incr: PhaseIncrCacheFxP,
 }
 
 impl OscFxP {
     /// Constructor
     pub fn new() -> OscFxP {
         OscFxP {
-            sinbuf: [SampleFxP::ZERO; STATIC_BUFFER_SIZE],
-            sqbuf: [SampleFxP::ZERO; STATIC_BUFFER_SIZE],
-            tribuf: [SampleFxP::ZERO; STATIC_BUFFER_SIZE],
-            sawbuf: [SampleFxP::ZERO; STATIC_BUFFER_SIZE],
             phase: PhaseFxP::ZERO,
+            incr: PhaseIncrCacheFxP::new(),
         }
     }
     /// Generate waves based on the `note` control signal and parameters.
@@ -353,174 +612,436 @@ impl OscFxP {
     ///
     /// See [OscSync] for the semantics of the sync argument.
     ///
+    /// The output waveforms are written into (and borrowed from) `scratch`,
+    /// which may be shared with any other oscillators processed sequentially
+    /// (see [OscScratch]).
+    ///
     /// Note: The output slice from this function may be shorter than the
     /// input slices.  Callers must check the number of returned samples and
     /// copy them into their own output buffers before calling this function
     /// again to process the remainder of the data.
-    pub fn process(
+    pub fn process<'a>(
         &mut self,
         ctx: &ContextFxP,
         note: &[NoteFxP],
         params: OscParamsFxP,
-    ) -> OscOutput<SampleFxP> {
+        scratch: &'a mut OscScratch<SampleFxP>,
+    ) -> OscOutput<'a, SampleFxP> {
         let numsamples = min_size(&[note.len(), params.len(), STATIC_BUFFER_SIZE]);
         let shape = params.shape;
         let tune = params.tune;
         let mut sync = params.sync;
+        let waves = params.waves;
+        let frac_2pi4096_sr = ctx.sample_rate.frac_2pi4096_sr();
+        for i in 0..numsamples {
+            let out = self.tick(frac_2pi4096_sr, note[i], tune[i], shape[i], waves, sync.at(i));
+            if waves.contains(OscWaveforms::SIN) {
+                scratch.sin[i] = out.sin;
+            }
+            if waves.contains(OscWaveforms::SQ) {
+                scratch.sq[i] = out.sq;
+            }
+            if waves.contains(OscWaveforms::TRI) {
+                scratch.tri[i] = out.tri;
+            }
+            if waves.contains(OscWaveforms::SAW) {
+                scratch.saw[i] = out.saw;
+            }
+        }
+        OscOutput {
+            sin: &scratch.sin[0..numsamples],
+            tri: &scratch.tri[0..numsamples],
+            sq: &scratch.sq[0..numsamples],
+            saw: &scratch.saw[0..numsamples],
+        }
+    }
+    /// Generate a single sample, using the given note and parameters - the
+    /// per-sample analog of [OscFxP::process], for callers interleaving
+    /// several devices in one loop (see [crate::voice::VoiceFxP]).
+    /// `frac_2pi4096_sr` is the loop-invariant sample rate constant (see
+    /// [crate::context::FixedSampleRate::frac_2pi4096_sr]), which should be
+    /// looked up once per block by the caller.
+    pub fn tick(
+        &mut self,
+        frac_2pi4096_sr: ScalarFxP,
+        note: NoteFxP,
+        tune: SignedNoteFxP,
+        shape: ScalarFxP,
+        waves: OscWaveforms,
+        sync: OscSyncTick<ScalarFxP>,
+    ) -> OscOutputSample<SampleFxP> {
         const FRAC_2_PI: ScalarFxP = ScalarFxP::lit("0x0.a2fa");
         const TWO: SampleFxP = SampleFxP::lit("2");
-        for i in 0..numsamples {
-            //generate waveforms (piecewise defined)
-            let frac_2phase_pi = apply_scalar_i(SampleFxP::from_num(self.phase), FRAC_2_PI);
-            //Sawtooth wave does not have to be piecewise-defined
-            self.sawbuf[i] = frac_2phase_pi.unwrapped_shr(1);
-            //All other functions are piecewise-defined:
+        let mut out = OscOutputSample {
+            sin: SampleFxP::ZERO,
+            sq: SampleFxP::ZERO,
+            tri: SampleFxP::ZERO,
+            saw: SampleFxP::ZERO,
+        };
+        //generate waveforms (piecewise defined) - but only those the caller
+        //asked for in the mask.  The mask is loop-invariant so the branches
+        //below are well-predicted (and hoistable by the compiler).
+        let frac_2phase_pi = apply_scalar_i(SampleFxP::from_num(self.phase), FRAC_2_PI);
+        //Sawtooth wave does not have to be piecewise-defined
+        if waves.contains(OscWaveforms::SAW) {
+            out.saw = frac_2phase_pi.unwrapped_shr(1);
+        }
+        //All other functions are piecewise-defined:
+        if waves.intersects(OscWaveforms::SIN | OscWaveforms::SQ | OscWaveforms::TRI) {
             if self.phase < 0 {
-                self.sqbuf[i] = SampleFxP::NEG_ONE;
+                if waves.contains(OscWaveforms::SQ) {
+                    out.sq = SampleFxP::NEG_ONE;
+                }
                 if self.phase < PhaseFxP::FRAC_PI_2.unwrapped_neg() {
                     // phase in [-pi, pi/2)
                     // Use the identity sin(x) = -cos(x+pi/2) since our taylor series
                     // approximations are centered about zero and this will be more accurate
-                    self.sinbuf[i] =
-                        fixedmath::cos_fixed(SampleFxP::from_num(self.phase + PhaseFxP::FRAC_PI_2))
-                            .unwrapped_neg();
-                    self.tribuf[i] = frac_2phase_pi.unwrapped_neg() - TWO;
+                    if waves.contains(OscWaveforms::SIN) {
+                        out.sin = fixedmath::cos_fixed(SampleFxP::from_num(
+                            self.phase + PhaseFxP::FRAC_PI_2,
+                        ))
+                        .unwrapped_neg();
+                    }
+                    if waves.contains(OscWaveforms::TRI) {
+                        out.tri = frac_2phase_pi.unwrapped_neg() - TWO;
+                    }
                 } else {
                     // phase in [-pi/2, 0)
-                    self.sinbuf[i] = fixedmath::sin_fixed(SampleFxP::from_num(self.phase));
-                    self.tribuf[i] = frac_2phase_pi;
+                    if waves.contains(OscWaveforms::SIN) {
+                        out.sin = fixedmath::sin_fixed(SampleFxP::from_num(self.phase));
+                    }
+                    if waves.contains(OscWaveforms::TRI) {
+                        out.tri = frac_2phase_pi;
+                    }
                 }
             } else {
-                self.sqbuf[i] = SampleFxP::ONE;
+                if waves.contains(OscWaveforms::SQ) {
+                    out.sq = SampleFxP::ONE;
+                }
                 if self.phase < PhaseFxP::FRAC_PI_2 {
                     // phase in [0, pi/2)
-                    self.sinbuf[i] = fixedmath::sin_fixed(SampleFxP::from_num(self.phase));
-                    self.tribuf[i] = frac_2phase_pi;
+                    if waves.contains(OscWaveforms::SIN) {
+                        out.sin = fixedmath::sin_fixed(SampleFxP::from_num(self.phase));
+                    }
+                    if waves.contains(OscWaveforms::TRI) {
+                        out.tri = frac_2phase_pi;
+                    }
                 } else {
                     // phase in [pi/2, pi)
                     // sin(x) = cos(x-pi/2)
-                    self.sinbuf[i] =
-                        fixedmath::cos_fixed(SampleFxP::from_num(self.phase - PhaseFxP::FRAC_PI_2));
-                    self.tribuf[i] = TWO - frac_2phase_pi;
-                }
-            }
-            // we need to divide by 2^12 here, but we're increasing the fractional part by 10
-            // bits so we'll only actually shift by 2 places and then use a bitcast for the
-            // remaining logical 10 bits:
-            let phase_per_sample = fixedmath::U4F28::from_bits(
-                fixedmath::scale_fixedfloat(
-                    fixedmath::midi_note_to_frequency(note[i].saturating_add_signed(tune[i])),
-                    ctx.sample_rate.frac_2pi4096_sr(),
-                )
-                .unwrapped_shr(2)
-                .to_bits(),
-            );
-            // Handle slave oscillator resetting phase if master crosses:
-            if let OscSync::Slave(syncbuf) = sync {
-                if syncbuf[i] != ScalarFxP::ZERO {
-                    self.phase = PhaseFxP::ZERO;
-                }
-            }
-            // Adjust phase per sample for the shape parameter:
-            let phase_per_smp_adj = PhaseFxP::from_num(if self.phase < PhaseFxP::ZERO {
-                let (x, s) = fixedmath::one_over_one_plus_highacc(clip_shape(shape[i]));
-                fixedmath::scale_fixedfloat(phase_per_sample, x).unwrapped_shr(s)
-            } else {
-                fixedmath::scale_fixedfloat(phase_per_sample, one_over_one_minus_x(shape[i]))
-            });
-            // Advance the oscillator's phase, and handle oscillator sync logic:
-            let old_phase = self.phase;
-            match sync {
-                OscSync::Off => {
-                    self.phase += phase_per_smp_adj;
-                }
-                OscSync::Master(ref mut syncbuf) => {
-                    self.phase += phase_per_smp_adj;
-                    // calculate what time in this sampling period the phase crossed zero:
-                    syncbuf[i] = if syncbuf[i] != ScalarFxP::ZERO
-                        && old_phase < PhaseFxP::ZERO
-                        && self.phase >= PhaseFxP::ZERO
-                    {
-                        // we need to calculate 1 - (phase / phase_per_sample_adj)
-                        let adj_s = ScalarFxP::from_num(phase_per_smp_adj.unwrapped_shr(2));
-                        let x = fixedmath::U3F13::from_num(self.phase).wide_mul(inverse(adj_s));
-                        let proportion = ScalarFxP::saturating_from_num(x.unwrapped_shr(2));
-                        if proportion == ScalarFxP::MAX {
-                            ScalarFxP::DELTA
-                        } else {
-                            ScalarFxP::MAX - proportion
-                        }
-                    } else {
-                        ScalarFxP::ZERO
+                    if waves.contains(OscWaveforms::SIN) {
+                        out.sin = fixedmath::cos_fixed(SampleFxP::from_num(
+                            self.phase - PhaseFxP::FRAC_PI_2,
+                        ));
                     }
-                }
-                OscSync::Slave(syncbuf) => {
-                    self.phase += if syncbuf[i] != ScalarFxP::ZERO {
-                        // Only advance phase for the portion of time after master crossed zero:
-                        let scale = ScalarFxP::MAX - syncbuf[i];
-                        PhaseFxP::from_num(fixedmath::scale_fixedfloat(
-                            fixedmath::U4F28::from_num(phase_per_smp_adj),
-                            scale,
-                        ))
-                    } else {
-                        phase_per_smp_adj
+                    if waves.contains(OscWaveforms::TRI) {
+                        out.tri = TWO - frac_2phase_pi;
                     }
                 }
             }
-            // check if we've crossed from negative to positive phase
-            if old_phase < PhaseFxP::ZERO
-                && self.phase > PhaseFxP::ZERO
-                && shape[i] != ScalarFxP::ZERO
+        }
+        let phase_per_sample = self.incr.get(note.saturating_add_signed(tune), frac_2pi4096_sr);
+        advance_phase_fxp(&mut self.phase, phase_per_sample, shape, sync);
+        out
+    }
+}
+
+impl Default for OscFxP {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+/// The interface to the core oscillator engine of a [super::MixOscFxP].
+/// Implemented by the arithmetic [OscFxP] and, when the `wavetables` feature
+/// is enabled, the band-limited `WavetableOscFxP`, so the enclosing mixer
+/// (and voice) can use either engine interchangeably.
+pub trait OscEngineFxP: Clone + Default {
+    /// Generate waves based on the `note` control signal and parameters -
+    /// see [OscFxP::process]
+    fn process<'a>(
+        &mut self,
+        ctx: &ContextFxP,
+        note: &[NoteFxP],
+        params: OscParamsFxP,
+        scratch: &'a mut OscScratch<SampleFxP>,
+    ) -> OscOutput<'a, SampleFxP>;
+    /// Generate a single sample - the per-sample analog of
+    /// [OscEngineFxP::process], for callers interleaving several devices in
+    /// one loop (see [crate::voice::VoiceFxP]).  `frac_2pi4096_sr` is the
+    /// loop-invariant sample rate constant (see
+    /// [crate::context::FixedSampleRate::frac_2pi4096_sr]).
+    fn tick(
+        &mut self,
+        frac_2pi4096_sr: ScalarFxP,
+        note: NoteFxP,
+        tune: SignedNoteFxP,
+        shape: ScalarFxP,
+        waves: OscWaveforms,
+        sync: OscSyncTick<ScalarFxP>,
+    ) -> OscOutputSample<SampleFxP>;
+}
+
+impl OscEngineFxP for OscFxP {
+    fn process<'a>(
+        &mut self,
+        ctx: &ContextFxP,
+        note: &[NoteFxP],
+        params: OscParamsFxP,
+        scratch: &'a mut OscScratch<SampleFxP>,
+    ) -> OscOutput<'a, SampleFxP> {
+        OscFxP::process(self, ctx, note, params, scratch)
+    }
+    fn tick(
+        &mut self,
+        frac_2pi4096_sr: ScalarFxP,
+        note: NoteFxP,
+        tune: SignedNoteFxP,
+        shape: ScalarFxP,
+        waves: OscWaveforms,
+        sync: OscSyncTick<ScalarFxP>,
+    ) -> OscOutputSample<SampleFxP> {
+        OscFxP::tick(self, frac_2pi4096_sr, note, tune, shape, waves, sync)
+    }
+}
+
+/// Advance an oscillator phase accumulator by `phase_per_sample` (the
+/// undistorted phase increment, in radians), applying the shape (phase
+/// distortion) parameter and the oscillator sync logic for this sample.
+/// Shared by [OscFxP] and the wavetable engine so that both have identical
+/// phase, shape, and sync semantics.
+fn advance_phase_fxp(
+    phase_acc: &mut PhaseFxP,
+    phase_per_sample: fixedmath::U4F28,
+    shape: ScalarFxP,
+    sync: OscSyncTick<ScalarFxP>,
+) {
+    // Handle slave oscillator resetting phase if master crosses:
+    if let OscSyncTick::Slave(s) = &sync {
+        if *s != ScalarFxP::ZERO {
+            *phase_acc = PhaseFxP::ZERO;
+        }
+    }
+    // Adjust phase per sample for the shape parameter:
+    let phase_per_smp_adj = PhaseFxP::from_num(if *phase_acc < PhaseFxP::ZERO {
+        let (x, s) = fixedmath::one_over_one_plus_highacc(clip_shape(shape));
+        fixedmath::scale_fixedfloat(phase_per_sample, x).unwrapped_shr(s)
+    } else {
+        fixedmath::scale_fixedfloat(phase_per_sample, one_over_one_minus_x(shape))
+    });
+    // Advance the oscillator's phase, and handle oscillator sync logic:
+    let old_phase = *phase_acc;
+    match sync {
+        OscSyncTick::Off => {
+            *phase_acc += phase_per_smp_adj;
+        }
+        OscSyncTick::Master(s) => {
+            *phase_acc += phase_per_smp_adj;
+            // calculate what time in this sampling period the phase crossed zero:
+            *s = if *s != ScalarFxP::ZERO
+                && old_phase < PhaseFxP::ZERO
+                && *phase_acc >= PhaseFxP::ZERO
             {
-                // need to multiply residual phase i.e. (phase - 0) by (1+k)/(1-k)
-                // where k is the shape, so no work required if shape is 0
-                let scaled = fixedmath::scale_fixedfloat(
-                    fixedmath::U4F28::from_num(self.phase),
-                    one_over_one_minus_x(shape[i]),
-                );
-                let one_plus_shape =
-                    fixedmath::U1F15::from_num(clip_shape(shape[i])) + fixedmath::U1F15::ONE;
-                self.phase =
-                    PhaseFxP::from_num(fixedmath::scale_fixedfloat(scaled, one_plus_shape));
-            }
-            // Check if we've crossed from positive phase back to negative:
-            if self.phase >= PhaseFxP::PI {
-                // if we're a symmetric wave this is as simple as just subtract 2pi
-                if shape[i] == ScalarFxP::ZERO {
-                    self.phase -= PhaseFxP::TAU;
+                // we need to calculate 1 - (phase / phase_per_sample_adj)
+                let adj_s = ScalarFxP::from_num(phase_per_smp_adj.unwrapped_shr(2));
+                let x = fixedmath::U3F13::from_num(*phase_acc).wide_mul(inverse(adj_s));
+                let proportion = ScalarFxP::saturating_from_num(x.unwrapped_shr(2));
+                if proportion == ScalarFxP::MAX {
+                    ScalarFxP::DELTA
                 } else {
-                    // if assymmetric we have to multiply residual phase i.e. phase - pi
-                    // by (1-k)/(1+k) where k is the shape:
-                    let one_minus_shape =
-                        (ScalarFxP::MAX - clip_shape(shape[i])) + ScalarFxP::DELTA;
-                    // scaled = residual_phase * (1-k)
-                    let scaled = fixedmath::scale_fixedfloat(
-                        fixedmath::U4F28::from_num(self.phase - PhaseFxP::PI),
-                        one_minus_shape,
-                    );
-                    // new change in phase = scaled * 1/(1 + k)
-                    let (x, s) = fixedmath::one_over_one_plus_highacc(clip_shape(shape[i]));
-                    let delta = fixedmath::scale_fixedfloat(scaled, x).unwrapped_shr(s);
-                    // add new change in phase to our baseline, -pi:
-                    self.phase = PhaseFxP::from_num(delta) - PhaseFxP::PI;
+                    ScalarFxP::MAX - proportion
                 }
+            } else {
+                ScalarFxP::ZERO
+            }
+        }
+        OscSyncTick::Slave(s) => {
+            *phase_acc += if s != ScalarFxP::ZERO {
+                // Only advance phase for the portion of time after master crossed zero:
+                let scale = ScalarFxP::MAX - s;
+                PhaseFxP::from_num(fixedmath::scale_fixedfloat(
+                    fixedmath::U4F28::from_num(phase_per_smp_adj),
+                    scale,
+                ))
+            } else {
+                phase_per_smp_adj
+            }
+        }
+    }
+    // check if we've crossed from negative to positive phase
+    if old_phase < PhaseFxP::ZERO && *phase_acc > PhaseFxP::ZERO && shape != ScalarFxP::ZERO {
+        // need to multiply residual phase i.e. (phase - 0) by (1+k)/(1-k)
+        // where k is the shape, so no work required if shape is 0
+        let scaled = fixedmath::scale_fixedfloat(
+            fixedmath::U4F28::from_num(*phase_acc),
+            one_over_one_minus_x(shape),
+        );
+        let one_plus_shape = fixedmath::U1F15::from_num(clip_shape(shape)) + fixedmath::U1F15::ONE;
+        *phase_acc = PhaseFxP::from_num(fixedmath::scale_fixedfloat(scaled, one_plus_shape));
+    }
+    // Check if we've crossed from positive phase back to negative:
+    if *phase_acc >= PhaseFxP::PI {
+        // if we're a symmetric wave this is as simple as just subtract 2pi
+        if shape == ScalarFxP::ZERO {
+            *phase_acc -= PhaseFxP::TAU;
+        } else {
+            // if assymmetric we have to multiply residual phase i.e. phase - pi
+            // by (1-k)/(1+k) where k is the shape:
+            let one_minus_shape = (ScalarFxP::MAX - clip_shape(shape)) + ScalarFxP::DELTA;
+            // scaled = residual_phase * (1-k)
+            let scaled = fixedmath::scale_fixedfloat(
+                fixedmath::U4F28::from_num(*phase_acc - PhaseFxP::PI),
+                one_minus_shape,
+            );
+            // new change in phase = scaled * 1/(1 + k)
+            let (x, s) = fixedmath::one_over_one_plus_highacc(clip_shape(shape));
+            let delta = fixedmath::scale_fixedfloat(scaled, x).unwrapped_shr(s);
+            // add new change in phase to our baseline, -pi:
+            *phase_acc = PhaseFxP::from_num(delta) - PhaseFxP::PI;
+        }
+    }
+}
+
+#[cfg(feature = "wavetables")]
+mod wavetables;
+
+/// A fixed-point oscillator with the same interface and phase/sync semantics
+/// as [OscFxP], but generating its square, triangle, and sawtooth outputs by
+/// interpolated playback of precomputed band-limited wavetables (one mipmap
+/// level per octave, selected by note) instead of deriving the shapes
+/// arithmetically.  Table playback is substantially cheaper per sample than
+/// the branch-heavy waveform arithmetic, and the band-limited tables remove
+/// most of the aliasing of the naive shapes at high notes.  The sine output
+/// uses [fixedmath::sin_fixed], which is already alias-free.
+///
+/// The tables are a single shared static set (see the `wavetables`
+/// submodule), so memory cost is flat no matter how many oscillators exist.
+///
+/// The shape (phase distortion) parameter warps the table readout phase just
+/// as it warps the arithmetic waveforms in [OscFxP]; a non-zero shape will
+/// therefore reintroduce some aliasing.
+#[cfg(feature = "wavetables")]
+#[derive(Clone)]
+pub struct WavetableOscFxP {
+    phase: PhaseFxP,
+    incr: PhaseIncrCacheFxP,
+}
+
+#[cfg(feature = "wavetables")]
+impl WavetableOscFxP {
+    /// Constructor
+    pub fn new() -> WavetableOscFxP {
+        WavetableOscFxP {
+            phase: PhaseFxP::ZERO,
+            incr: PhaseIncrCacheFxP::new(),
+        }
+    }
+    /// Generate waves based on the `note` control signal and parameters -
+    /// see [OscFxP::process] for the full semantics.
+    pub fn process<'a>(
+        &mut self,
+        ctx: &ContextFxP,
+        note: &[NoteFxP],
+        params: OscParamsFxP,
+        scratch: &'a mut OscScratch<SampleFxP>,
+    ) -> OscOutput<'a, SampleFxP> {
+        let numsamples = min_size(&[note.len(), params.len(), STATIC_BUFFER_SIZE]);
+        let shape = params.shape;
+        let tune = params.tune;
+        let mut sync = params.sync;
+        let waves = params.waves;
+        let frac_2pi4096_sr = ctx.sample_rate.frac_2pi4096_sr();
+        for i in 0..numsamples {
+            let out = self.tick(frac_2pi4096_sr, note[i], tune[i], shape[i], waves, sync.at(i));
+            if waves.contains(OscWaveforms::SIN) {
+                scratch.sin[i] = out.sin;
+            }
+            if waves.contains(OscWaveforms::SQ) {
+                scratch.sq[i] = out.sq;
+            }
+            if waves.contains(OscWaveforms::TRI) {
+                scratch.tri[i] = out.tri;
+            }
+            if waves.contains(OscWaveforms::SAW) {
+                scratch.saw[i] = out.saw;
             }
         }
         OscOutput {
-            sin: &self.sinbuf[0..numsamples],
-            tri: &self.tribuf[0..numsamples],
-            sq: &self.sqbuf[0..numsamples],
-            saw: &self.sawbuf[0..numsamples],
+            sin: &scratch.sin[0..numsamples],
+            tri: &scratch.tri[0..numsamples],
+            sq: &scratch.sq[0..numsamples],
+            saw: &scratch.saw[0..numsamples],
+        }
+    }
+    /// Generate a single sample - the per-sample analog of
+    /// [WavetableOscFxP::process], with the same semantics as [OscFxP::tick]
+    pub fn tick(
+        &mut self,
+        frac_2pi4096_sr: ScalarFxP,
+        note: NoteFxP,
+        tune: SignedNoteFxP,
+        shape: ScalarFxP,
+        waves: OscWaveforms,
+        sync: OscSyncTick<ScalarFxP>,
+    ) -> OscOutputSample<SampleFxP> {
+        let mut out = OscOutputSample {
+            sin: SampleFxP::ZERO,
+            sq: SampleFxP::ZERO,
+            tri: SampleFxP::ZERO,
+            saw: SampleFxP::ZERO,
+        };
+        let n = note.saturating_add_signed(tune);
+        // One mipmap level per MIDI octave:
+        let level = core::cmp::min((n.to_bits() >> 9) as usize / 12, wavetables::NUM_MIPS - 1);
+        if waves.contains(OscWaveforms::SIN) {
+            out.sin = fixedmath::sin_fixed(SampleFxP::from_num(self.phase));
+        }
+        if waves.contains(OscWaveforms::SQ) {
+            out.sq = wavetables::lookup(&wavetables::SQ[level], self.phase);
+        }
+        if waves.contains(OscWaveforms::TRI) {
+            out.tri = wavetables::lookup(&wavetables::TRI[level], self.phase);
+        }
+        if waves.contains(OscWaveforms::SAW) {
+            out.saw = wavetables::lookup(&wavetables::SAW[level], self.phase);
         }
+        let phase_per_sample = self.incr.get(n, frac_2pi4096_sr);
+        advance_phase_fxp(&mut self.phase, phase_per_sample, shape, sync);
+        out
     }
 }
 
-impl Default for OscFxP {
+#[cfg(feature = "wavetables")]
+impl Default for WavetableOscFxP {
     fn default() -> Self {
         Self::new()
     }
 }
 
+#[cfg(feature = "wavetables")]
+impl OscEngineFxP for WavetableOscFxP {
+    fn process<'a>(
+        &mut self,
+        ctx: &ContextFxP,
+        note: &[NoteFxP],
+        params: OscParamsFxP,
+        scratch: &'a mut OscScratch<SampleFxP>,
+    ) -> OscOutput<'a, SampleFxP> {
+        WavetableOscFxP::process(self, ctx, note, params, scratch)
+    }
+    fn tick(
+        &mut self,
+        frac_2pi4096_sr: ScalarFxP,
+        note: NoteFxP,
+        tune: SignedNoteFxP,
+        shape: ScalarFxP,
+        waves: OscWaveforms,
+        sync: OscSyncTick<ScalarFxP>,
+    ) -> OscOutputSample<SampleFxP> {
+        WavetableOscFxP::tick(self, frac_2pi4096_sr, note, tune, shape, waves, sync)
+    }
+}
+
 fn clip_shape(x: ScalarFxP) -> ScalarFxP {
     const CLIP_MAX: ScalarFxP = ScalarFxP::lit("0x0.F");
     if x > CLIP_MAX {
@@ -727,4 +1248,26 @@ mod test {
             let _neg = one_over_one_minus_x(x);
         }
     }
+    #[cfg(feature = "wavetables")]
+    #[test]
+    fn wavetable_lookup() {
+        use core::f32::consts::{PI, TAU};
+        // Sweep the full phase range on every mipmap level - the lookups must
+        // not panic (i.e. the interpolation never reads past the guard
+        // entries), and the most heavily band-limited saw (level 0, 256
+        // harmonics) must track the naive ramp away from the discontinuity:
+        for level in 0..wavetables::NUM_MIPS {
+            for i in 0..4096 {
+                let phasef = ((i as f32) / 4096f32) * TAU - PI;
+                let phase = PhaseFxP::from_num(phasef);
+                let saw = wavetables::lookup(&wavetables::SAW[level], phase);
+                let _sq = wavetables::lookup(&wavetables::SQ[level], phase);
+                let _tri = wavetables::lookup(&wavetables::TRI[level], phase);
+                let ideal = phasef / PI;
+                if level == 0 && ideal.abs() < 0.9f32 {
+                    assert!((saw.to_num::<f32>() - ideal).abs() < 0.05f32);
+                }
+            }
+        }
+    }
 }
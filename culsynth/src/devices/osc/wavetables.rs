@@ -0,0 +1,2302 @@
+//! Precomputed band-limited wavetables for the wavetable oscillator engine
+//! (see [super::WavetableOscFxP]).  There is one mipmap level per MIDI
+//! octave: level `o` holds the partial Fourier sum of the ideal shape,
+//! truncated so that the highest harmonic of the highest note of octave `o`
+//! stays below 20kHz (and below the table's own Nyquist limit of
+//! [TABLE_LEN]`/2` harmonics).  Entries are the raw bits of a
+//! [SampleFxP], matching the amplitude of the arithmetic waveforms in
+//! [super::OscFxP] (so up to about +/-1.09 with the Gibbs overshoot).
+//!
+//! The tables are immutable statics shared by every oscillator in the
+//! process, so their memory cost is flat as polyphony grows.
+//!
+//! Tables generated with python:
+//!
+//! import math
+//! LEN = 512
+//! MIPS = 11
+//! def k_max(o):
+//!     f = 8.1758 * 2.0 ** (o + 1)
+//!     return max(1, min(LEN // 2, int(20000.0 / f)))
+//! def saw(theta, k):
+//!     return sum(2.0 / (math.pi * n) * (-1) ** (n + 1) * math.sin(n * theta)
+//!                for n in range(1, k + 1))
+//! def square(theta, k):
+//!     return sum(4.0 / (math.pi * n) * math.sin(n * theta)
+//!                for n in range(1, k + 1, 2))
+//! def tri(theta, k):
+//!     return sum(8.0 / (math.pi ** 2 * n ** 2) * (-1) ** ((n - 1) // 2) * math.sin(n * theta)
+//!                for n in range(1, k + 1, 2))
+//! def table(f, o):
+//!     vals = [f(-math.pi + 2.0 * math.pi * (j % LEN) / LEN, k_max(o))
+//!             for j in range(LEN + 2)]
+//!     return [max(-32768, min(32767, round(v * 4096))) for v in vals]
+//! for name, f in [("SAW", saw), ("SQ", square), ("TRI", tri)]:
+//!     print("#[rustfmt::skip]")
+//!     print(f"pub(super) static {name}: [[i16; TABLE_LEN + 2]; NUM_MIPS] = [")
+//!     for o in range(MIPS):
+//!         print("    [")
+//!         t = table(f, o)
+//!         for i in range(0, len(t), 8):
+//!             print("        " + ", ".join(str(x) for x in t[i:i+8]) + ",")
+//!         print("    ],")
+//!     print("];")
+
+use super::PhaseFxP;
+use crate::{fixedmath, SampleFxP, ScalarFxP};
+
+/// The number of mipmap levels (one per MIDI octave)
+pub(super) const NUM_MIPS: usize = 11;
+
+/// The number of table entries spanning one full cycle.  The two extra
+/// entries past the cycle let [lookup] read one entry ahead without any
+/// index clamping (mirroring [crate::fixedmath::sin_lut]).
+pub(super) const TABLE_LEN: usize = 512;
+
+// 256/pi - converts radians in [0, 2*pi] to a table index in [0, TABLE_LEN]
+const FRAC_256_PI: fixedmath::U8F8 = fixedmath::U8F8::lit("81.4873");
+
+/// Look up `phase` (radians in `[-pi, pi)`, spanning one full cycle of the
+/// table) with linear interpolation between entries.
+pub(super) fn lookup(table: &[i16; TABLE_LEN + 2], phase: PhaseFxP) -> SampleFxP {
+    // Map [-pi, pi) onto the table indices [0, TABLE_LEN).  The saturating
+    // conversion clamps phases a rounding error below -pi to index zero, and
+    // the min() clamps the scale-factor rounding overshoot at +pi onto the
+    // guard entries:
+    let offset = fixedmath::USample::saturating_from_num(phase + PhaseFxP::PI);
+    let scaled = offset
+        .wide_mul(FRAC_256_PI)
+        .to_bits()
+        .min((TABLE_LEN as u32) << 20); // U12F20
+    let index = (scaled >> 20) as usize;
+    let frac = ScalarFxP::from_bits((scaled >> 4) as u16);
+    let (a, b) = (
+        SampleFxP::from_bits(table[index]),
+        SampleFxP::from_bits(table[index + 1]),
+    );
+    a + SampleFxP::from_num(frac.wide_mul_signed(b - a))
+}
+
+
+#[rustfmt::skip]
+pub(super) static SAW: [[i16; TABLE_LEN + 2]; NUM_MIPS] = [
+    [
+        0, -4813, -3666, -4319, -3827, -4181, -3862, -4102,
+        -3865, -4044, -3853, -3995, -3835, -3952, -3813, -3911,
+        -3788, -3873, -3762, -3835, -3735, -3799, -3707, -3764,
+        -3678, -3729, -3648, -3694, -3619, -3660, -3589, -3626,
+        -3558, -3593, -3528, -3559, -3497, -3526, -3467, -3493,
+        -3436, -3460, -3405, -3427, -3374, -3394, -3342, -3361,
+        -3311, -3328, -3280, -3296, -3249, -3263, -3217, -3231,
+        -3186, -3198, -3154, -3165, -3123, -3133, -3091, -3101,
+        -3060, -3068, -3028, -3036, -2997, -3003, -2965, -2971,
+        -2933, -2939, -2902, -2906, -2870, -2874, -2838, -2842,
+        -2806, -2809, -2775, -2777, -2743, -2745, -2711, -2713,
+        -2680, -2680, -2648, -2648, -2616, -2616, -2584, -2584,
+        -2552, -2552, -2521, -2519, -2489, -2487, -2457, -2455,
+        -2425, -2423, -2393, -2391, -2361, -2358, -2330, -2326,
+        -2298, -2294, -2266, -2262, -2234, -2230, -2202, -2198,
+        -2170, -2166, -2139, -2133, -2107, -2101, -2075, -2069,
+        -2043, -2037, -2011, -2005, -1979, -1973, -1947, -1941,
+        -1915, -1909, -1883, -1876, -1852, -1844, -1820, -1812,
+        -1788, -1780, -1756, -1748, -1724, -1716, -1692, -1684,
+        -1660, -1652, -1628, -1620, -1596, -1588, -1565, -1555,
+        -1533, -1523, -1501, -1491, -1469, -1459, -1437, -1427,
+        -1405, -1395, -1373, -1363, -1341, -1331, -1309, -1299,
+        -1277, -1267, -1245, -1235, -1213, -1203, -1182, -1170,
+        -1150, -1138, -1118, -1106, -1086, -1074, -1054, -1042,
+        -1022, -1010, -990, -978, -958, -946, -926, -914,
+        -894, -882, -862, -850, -830, -818, -798, -786,
+        -766, -754, -735, -721, -703, -689, -671, -657,
+        -639, -625, -607, -593, -575, -561, -543, -529,
+        -511, -497, -479, -465, -447, -433, -415, -401,
+        -383, -369, -351, -337, -319, -305, -287, -273,
+        -255, -240, -224, -208, -192, -176, -160, -144,
+        -128, -112, -96, -80, -64, -48, -32, -16,
+        0, 16, 32, 48, 64, 80, 96, 112,
+        128, 144, 160, 176, 192, 208, 224, 240,
+        255, 273, 287, 305, 319, 337, 351, 369,
+        383, 401, 415, 433, 447, 465, 479, 497,
+        511, 529, 543, 561, 575, 593, 607, 625,
+        639, 657, 671, 689, 703, 721, 735, 754,
+        766, 786, 798, 818, 830, 850, 862, 882,
+        894, 914, 926, 946, 958, 978, 990, 1010,
+        1022, 1042, 1054, 1074, 1086, 1106, 1118, 1138,
+        1150, 1170, 1182, 1203, 1213, 1235, 1245, 1267,
+        1277, 1299, 1309, 1331, 1341, 1363, 1373, 1395,
+        1405, 1427, 1437, 1459, 1469, 1491, 1501, 1523,
+        1533, 1555, 1565, 1588, 1596, 1620, 1628, 1652,
+        1660, 1684, 1692, 1716, 1724, 1748, 1756, 1780,
+        1788, 1812, 1820, 1844, 1852, 1876, 1883, 1909,
+        1915, 1941, 1947, 1973, 1979, 2005, 2011, 2037,
+        2043, 2069, 2075, 2101, 2107, 2133, 2139, 2166,
+        2170, 2198, 2202, 2230, 2234, 2262, 2266, 2294,
+        2298, 2326, 2330, 2358, 2361, 2391, 2393, 2423,
+        2425, 2455, 2457, 2487, 2489, 2519, 2521, 2552,
+        2552, 2584, 2584, 2616, 2616, 2648, 2648, 2680,
+        2680, 2713, 2711, 2745, 2743, 2777, 2775, 2809,
+        2806, 2842, 2838, 2874, 2870, 2906, 2902, 2939,
+        2933, 2971, 2965, 3003, 2997, 3036, 3028, 3068,
+        3060, 3101, 3091, 3133, 3123, 3165, 3154, 3198,
+        3186, 3231, 3217, 3263, 3249, 3296, 3280, 3328,
+        3311, 3361, 3342, 3394, 3374, 3427, 3405, 3460,
+        3436, 3493, 3467, 3526, 3497, 3559, 3528, 3593,
+        3558, 3626, 3589, 3660, 3619, 3694, 3648, 3729,
+        3678, 3764, 3707, 3799, 3735, 3835, 3762, 3873,
+        3788, 3911, 3813, 3952, 3835, 3995, 3853, 4044,
+        3865, 4102, 3862, 4181, 3827, 4319, 3666, 4813,
+        0, -4813,
+    ],
+    [
+        0, -4813, -3666, -4319, -3827, -4181, -3862, -4102,
+        -3865, -4044, -3853, -3995, -3835, -3952, -3813, -3911,
+        -3788, -3873, -3762, -3835, -3735, -3799, -3707, -3764,
+        -3678, -3729, -3648, -3694, -3619, -3660, -3589, -3626,
+        -3558, -3593, -3528, -3559, -3497, -3526, -3467, -3493,
+        -3436, -3460, -3405, -3427, -3374, -3394, -3342, -3361,
+        -3311, -3328, -3280, -3296, -3249, -3263, -3217, -3231,
+        -3186, -3198, -3154, -3165, -3123, -3133, -3091, -3101,
+        -3060, -3068, -3028, -3036, -2997, -3003, -2965, -2971,
+        -2933, -2939, -2902, -2906, -2870, -2874, -2838, -2842,
+        -2806, -2809, -2775, -2777, -2743, -2745, -2711, -2713,
+        -2680, -2680, -2648, -2648, -2616, -2616, -2584, -2584,
+        -2552, -2552, -2521, -2519, -2489, -2487, -2457, -2455,
+        -2425, -2423, -2393, -2391, -2361, -2358, -2330, -2326,
+        -2298, -2294, -2266, -2262, -2234, -2230, -2202, -2198,
+        -2170, -2166, -2139, -2133, -2107, -2101, -2075, -2069,
+        -2043, -2037, -2011, -2005, -1979, -1973, -1947, -1941,
+        -1915, -1909, -1883, -1876, -1852, -1844, -1820, -1812,
+        -1788, -1780, -1756, -1748, -1724, -1716, -1692, -1684,
+        -1660, -1652, -1628, -1620, -1596, -1588, -1565, -1555,
+        -1533, -1523, -1501, -1491, -1469, -1459, -1437, -1427,
+        -1405, -1395, -1373, -1363, -1341, -1331, -1309, -1299,
+        -1277, -1267, -1245, -1235, -1213, -1203, -1182, -1170,
+        -1150, -1138, -1118, -1106, -1086, -1074, -1054, -1042,
+        -1022, -1010, -990, -978, -958, -946, -926, -914,
+        -894, -882, -862, -850, -830, -818, -798, -786,
+        -766, -754, -735, -721, -703, -689, -671, -657,
+        -639, -625, -607, -593, -575, -561, -543, -529,
+        -511, -497, -479, -465, -447, -433, -415, -401,
+        -383, -369, -351, -337, -319, -305, -287, -273,
+        -255, -240, -224, -208, -192, -176, -160, -144,
+        -128, -112, -96, -80, -64, -48, -32, -16,
+        0, 16, 32, 48, 64, 80, 96, 112,
+        128, 144, 160, 176, 192, 208, 224, 240,
+        255, 273, 287, 305, 319, 337, 351, 369,
+        383, 401, 415, 433, 447, 465, 479, 497,
+        511, 529, 543, 561, 575, 593, 607, 625,
+        639, 657, 671, 689, 703, 721, 735, 754,
+        766, 786, 798, 818, 830, 850, 862, 882,
+        894, 914, 926, 946, 958, 978, 990, 1010,
+        1022, 1042, 1054, 1074, 1086, 1106, 1118, 1138,
+        1150, 1170, 1182, 1203, 1213, 1235, 1245, 1267,
+        1277, 1299, 1309, 1331, 1341, 1363, 1373, 1395,
+        1405, 1427, 1437, 1459, 1469, 1491, 1501, 1523,
+        1533, 1555, 1565, 1588, 1596, 1620, 1628, 1652,
+        1660, 1684, 1692, 1716, 1724, 1748, 1756, 1780,
+        1788, 1812, 1820, 1844, 1852, 1876, 1883, 1909,
+        1915, 1941, 1947, 1973, 1979, 2005, 2011, 2037,
+        2043, 2069, 2075, 2101, 2107, 2133, 2139, 2166,
+        2170, 2198, 2202, 2230, 2234, 2262, 2266, 2294,
+        2298, 2326, 2330, 2358, 2361, 2391, 2393, 2423,
+        2425, 2455, 2457, 2487, 2489, 2519, 2521, 2552,
+        2552, 2584, 2584, 2616, 2616, 2648, 2648, 2680,
+        2680, 2713, 2711, 2745, 2743, 2777, 2775, 2809,
+        2806, 2842, 2838, 2874, 2870, 2906, 2902, 2939,
+        2933, 2971, 2965, 3003, 2997, 3036, 3028, 3068,
+        3060, 3101, 3091, 3133, 3123, 3165, 3154, 3198,
+        3186, 3231, 3217, 3263, 3249, 3296, 3280, 3328,
+        3311, 3361, 3342, 3394, 3374, 3427, 3405, 3460,
+        3436, 3493, 3467, 3526, 3497, 3559, 3528, 3593,
+        3558, 3626, 3589, 3660, 3619, 3694, 3648, 3729,
+        3678, 3764, 3707, 3799, 3735, 3835, 3762, 3873,
+        3788, 3911, 3813, 3952, 3835, 3995, 3853, 4044,
+        3865, 4102, 3862, 4181, 3827, 4319, 3666, 4813,
+        0, -4813,
+    ],
+    [
+        0, -4813, -3666, -4319, -3827, -4181, -3862, -4102,
+        -3865, -4044, -3853, -3995, -3835, -3952, -3813, -3911,
+        -3788, -3873, -3762, -3835, -3735, -3799, -3707, -3764,
+        -3678, -3729, -3648, -3694, -3619, -3660, -3589, -3626,
+        -3558, -3593, -3528, -3559, -3497, -3526, -3467, -3493,
+        -3436, -3460, -3405, -3427, -3374, -3394, -3342, -3361,
+        -3311, -3328, -3280, -3296, -3249, -3263, -3217, -3231,
+        -3186, -3198, -3154, -3165, -3123, -3133, -3091, -3101,
+        -3060, -3068, -3028, -3036, -2997, -3003, -2965, -2971,
+        -2933, -2939, -2902, -2906, -2870, -2874, -2838, -2842,
+        -2806, -2809, -2775, -2777, -2743, -2745, -2711, -2713,
+        -2680, -2680, -2648, -2648, -2616, -2616, -2584, -2584,
+        -2552, -2552, -2521, -2519, -2489, -2487, -2457, -2455,
+        -2425, -2423, -2393, -2391, -2361, -2358, -2330, -2326,
+        -2298, -2294, -2266, -2262, -2234, -2230, -2202, -2198,
+        -2170, -2166, -2139, -2133, -2107, -2101, -2075, -2069,
+        -2043, -2037, -2011, -2005, -1979, -1973, -1947, -1941,
+        -1915, -1909, -1883, -1876, -1852, -1844, -1820, -1812,
+        -1788, -1780, -1756, -1748, -1724, -1716, -1692, -1684,
+        -1660, -1652, -1628, -1620, -1596, -1588, -1565, -1555,
+        -1533, -1523, -1501, -1491, -1469, -1459, -1437, -1427,
+        -1405, -1395, -1373, -1363, -1341, -1331, -1309, -1299,
+        -1277, -1267, -1245, -1235, -1213, -1203, -1182, -1170,
+        -1150, -1138, -1118, -1106, -1086, -1074, -1054, -1042,
+        -1022, -1010, -990, -978, -958, -946, -926, -914,
+        -894, -882, -862, -850, -830, -818, -798, -786,
+        -766, -754, -735, -721, -703, -689, -671, -657,
+        -639, -625, -607, -593, -575, -561, -543, -529,
+        -511, -497, -479, -465, -447, -433, -415, -401,
+        -383, -369, -351, -337, -319, -305, -287, -273,
+        -255, -240, -224, -208, -192, -176, -160, -144,
+        -128, -112, -96, -80, -64, -48, -32, -16,
+        0, 16, 32, 48, 64, 80, 96, 112,
+        128, 144, 160, 176, 192, 208, 224, 240,
+        255, 273, 287, 305, 319, 337, 351, 369,
+        383, 401, 415, 433, 447, 465, 479, 497,
+        511, 529, 543, 561, 575, 593, 607, 625,
+        639, 657, 671, 689, 703, 721, 735, 754,
+        766, 786, 798, 818, 830, 850, 862, 882,
+        894, 914, 926, 946, 958, 978, 990, 1010,
+        1022, 1042, 1054, 1074, 1086, 1106, 1118, 1138,
+        1150, 1170, 1182, 1203, 1213, 1235, 1245, 1267,
+        1277, 1299, 1309, 1331, 1341, 1363, 1373, 1395,
+        1405, 1427, 1437, 1459, 1469, 1491, 1501, 1523,
+        1533, 1555, 1565, 1588, 1596, 1620, 1628, 1652,
+        1660, 1684, 1692, 1716, 1724, 1748, 1756, 1780,
+        1788, 1812, 1820, 1844, 1852, 1876, 1883, 1909,
+        1915, 1941, 1947, 1973, 1979, 2005, 2011, 2037,
+        2043, 2069, 2075, 2101, 2107, 2133, 2139, 2166,
+        2170, 2198, 2202, 2230, 2234, 2262, 2266, 2294,
+        2298, 2326, 2330, 2358, 2361, 2391, 2393, 2423,
+        2425, 2455, 2457, 2487, 2489, 2519, 2521, 2552,
+        2552, 2584, 2584, 2616, 2616, 2648, 2648, 2680,
+        2680, 2713, 2711, 2745, 2743, 2777, 2775, 2809,
+        2806, 2842, 2838, 2874, 2870, 2906, 2902, 2939,
+        2933, 2971, 2965, 3003, 2997, 3036, 3028, 3068,
+        3060, 3101, 3091, 3133, 3123, 3165, 3154, 3198,
+        3186, 3231, 3217, 3263, 3249, 3296, 3280, 3328,
+        3311, 3361, 3342, 3394, 3374, 3427, 3405, 3460,
+        3436, 3493, 3467, 3526, 3497, 3559, 3528, 3593,
+        3558, 3626, 3589, 3660, 3619, 3694, 3648, 3729,
+        3678, 3764, 3707, 3799, 3735, 3835, 3762, 3873,
+        3788, 3911, 3813, 3952, 3835, 3995, 3853, 4044,
+        3865, 4102, 3862, 4181, 3827, 4319, 3666, 4813,
+        0, -4813,
+    ],
+    [
+        0, -4009, -4668, -3746, -3871, -4287, -3966, -3807,
+        -4088, -4025, -3800, -3935, -4010, -3817, -3821, -3946,
+        -3834, -3747, -3856, -3833, -3709, -3760, -3804, -3693,
+        -3676, -3748, -3683, -3614, -3674, -3664, -3573, -3595,
+        -3627, -3548, -3523, -3571, -3527, -3466, -3503, -3499,
+        -3426, -3431, -3457, -3397, -3367, -3402, -3370, -3314,
+        -3336, -3336, -3274, -3270, -3291, -3242, -3209, -3235,
+        -3211, -3159, -3172, -3174, -3120, -3108, -3126, -3086,
+        -3051, -3070, -3052, -3003, -3008, -3012, -2964, -2948,
+        -2963, -2929, -2893, -2906, -2893, -2847, -2846, -2850,
+        -2808, -2787, -2800, -2771, -2735, -2743, -2733, -2690,
+        -2684, -2688, -2650, -2627, -2637, -2613, -2576, -2580,
+        -2573, -2532, -2522, -2527, -2493, -2467, -2475, -2454,
+        -2418, -2418, -2413, -2374, -2361, -2365, -2335, -2307,
+        -2313, -2295, -2259, -2256, -2252, -2216, -2200, -2204,
+        -2177, -2148, -2151, -2136, -2101, -2095, -2092, -2058,
+        -2039, -2043, -2018, -1988, -1989, -1977, -1942, -1933,
+        -1932, -1900, -1879, -1881, -1860, -1829, -1827, -1817,
+        -1783, -1772, -1771, -1742, -1719, -1720, -1701, -1669,
+        -1666, -1658, -1625, -1611, -1610, -1583, -1558, -1558,
+        -1542, -1510, -1504, -1498, -1466, -1450, -1449, -1425,
+        -1398, -1397, -1383, -1351, -1343, -1338, -1308, -1289,
+        -1289, -1266, -1238, -1236, -1223, -1192, -1182, -1177,
+        -1149, -1128, -1128, -1107, -1079, -1075, -1064, -1033,
+        -1020, -1017, -990, -968, -967, -948, -919, -913,
+        -904, -874, -859, -857, -831, -808, -806, -789,
+        -759, -752, -744, -715, -699, -696, -673, -647,
+        -645, -630, -600, -591, -585, -556, -538, -536,
+        -514, -487, -483, -471, -441, -430, -425, -397,
+        -377, -375, -355, -327, -322, -311, -281, -269,
+        -265, -238, -216, -214, -196, -168, -161, -152,
+        -122, -108, -104, -79, -56, -53, -37, -8,
+        0, 8, 37, 53, 56, 79, 104, 108,
+        122, 152, 161, 168, 196, 214, 216, 238,
+        265, 269, 281, 311, 322, 327, 355, 375,
+        377, 397, 425, 430, 441, 471, 483, 487,
+        514, 536, 538, 556, 585, 591, 600, 630,
+        645, 647, 673, 696, 699, 715, 744, 752,
+        759, 789, 806, 808, 831, 857, 859, 874,
+        904, 913, 919, 948, 967, 968, 990, 1017,
+        1020, 1033, 1064, 1075, 1079, 1107, 1128, 1128,
+        1149, 1177, 1182, 1192, 1223, 1236, 1238, 1266,
+        1289, 1289, 1308, 1338, 1343, 1351, 1383, 1397,
+        1398, 1425, 1449, 1450, 1466, 1498, 1504, 1510,
+        1542, 1558, 1558, 1583, 1610, 1611, 1625, 1658,
+        1666, 1669, 1701, 1720, 1719, 1742, 1771, 1772,
+        1783, 1817, 1827, 1829, 1860, 1881, 1879, 1900,
+        1932, 1933, 1942, 1977, 1989, 1988, 2018, 2043,
+        2039, 2058, 2092, 2095, 2101, 2136, 2151, 2148,
+        2177, 2204, 2200, 2216, 2252, 2256, 2259, 2295,
+        2313, 2307, 2335, 2365, 2361, 2374, 2413, 2418,
+        2418, 2454, 2475, 2467, 2493, 2527, 2522, 2532,
+        2573, 2580, 2576, 2613, 2637, 2627, 2650, 2688,
+        2684, 2690, 2733, 2743, 2735, 2771, 2800, 2787,
+        2808, 2850, 2846, 2847, 2893, 2906, 2893, 2929,
+        2963, 2948, 2964, 3012, 3008, 3003, 3052, 3070,
+        3051, 3086, 3126, 3108, 3120, 3174, 3172, 3159,
+        3211, 3235, 3209, 3242, 3291, 3270, 3274, 3336,
+        3336, 3314, 3370, 3402, 3367, 3397, 3457, 3431,
+        3426, 3499, 3503, 3466, 3527, 3571, 3523, 3548,
+        3627, 3595, 3573, 3664, 3674, 3614, 3683, 3748,
+        3676, 3693, 3804, 3760, 3709, 3833, 3856, 3747,
+        3834, 3946, 3821, 3817, 4010, 3935, 3800, 4025,
+        4088, 3807, 3966, 4287, 3871, 3746, 4668, 4009,
+        0, -4009,
+    ],
+    [
+        0, -2315, -4001, -4734, -4631, -4124, -3693, -3602,
+        -3815, -4093, -4207, -4092, -3862, -3696, -3699, -3833,
+        -3966, -3984, -3873, -3722, -3638, -3669, -3767, -3837,
+        -3814, -3711, -3603, -3562, -3604, -3677, -3708, -3663,
+        -3570, -3492, -3479, -3523, -3575, -3579, -3522, -3440,
+        -3387, -3391, -3433, -3465, -3450, -3388, -3318, -3285,
+        -3299, -3336, -3351, -3321, -3258, -3202, -3184, -3205,
+        -3233, -3234, -3193, -3134, -3090, -3084, -3107, -3126,
+        -3113, -3067, -3013, -2981, -2985, -3007, -3015, -2992,
+        -2943, -2895, -2875, -2885, -2903, -2901, -2869, -2820,
+        -2782, -2771, -2784, -2796, -2785, -2747, -2700, -2671,
+        -2668, -2681, -2687, -2667, -2625, -2583, -2562, -2565,
+        -2577, -2574, -2547, -2504, -2468, -2455, -2462, -2470,
+        -2460, -2427, -2385, -2356, -2350, -2358, -2361, -2343,
+        -2307, -2268, -2246, -2245, -2253, -2250, -2226, -2187,
+        -2153, -2138, -2140, -2146, -2136, -2107, -2069, -2040,
+        -2031, -2036, -2037, -2021, -1988, -1952, -1929, -1925,
+        -1930, -1926, -1905, -1869, -1836, -1820, -1819, -1823,
+        -1814, -1787, -1752, -1723, -1712, -1714, -1714, -1700,
+        -1669, -1635, -1611, -1605, -1607, -1604, -1584, -1551,
+        -1519, -1501, -1498, -1500, -1492, -1468, -1434, -1405,
+        -1392, -1392, -1392, -1379, -1350, -1317, -1293, -1284,
+        -1286, -1282, -1264, -1233, -1201, -1182, -1177, -1178,
+        -1171, -1148, -1115, -1087, -1072, -1071, -1070, -1058,
+        -1031, -998, -974, -964, -964, -961, -944, -914,
+        -883, -862, -856, -857, -850, -828, -797, -768,
+        -752, -749, -749, -737, -712, -680, -655, -643,
+        -643, -640, -624, -595, -564, -543, -536, -535,
+        -529, -509, -478, -449, -432, -428, -427, -417,
+        -393, -361, -335, -323, -321, -319, -304, -276,
+        -245, -223, -215, -214, -208, -189, -159, -130,
+        -112, -107, -106, -97, -74, -43, -16, -2,
+        0, 2, 16, 43, 74, 97, 106, 107,
+        112, 130, 159, 189, 208, 214, 215, 223,
+        245, 276, 304, 319, 321, 323, 335, 361,
+        393, 417, 427, 428, 432, 449, 478, 509,
+        529, 535, 536, 543, 564, 595, 624, 640,
+        643, 643, 655, 680, 712, 737, 749, 749,
+        752, 768, 797, 828, 850, 857, 856, 862,
+        883, 914, 944, 961, 964, 964, 974, 998,
+        1031, 1058, 1070, 1071, 1072, 1087, 1115, 1148,
+        1171, 1178, 1177, 1182, 1201, 1233, 1264, 1282,
+        1286, 1284, 1293, 1317, 1350, 1379, 1392, 1392,
+        1392, 1405, 1434, 1468, 1492, 1500, 1498, 1501,
+        1519, 1551, 1584, 1604, 1607, 1605, 1611, 1635,
+        1669, 1700, 1714, 1714, 1712, 1723, 1752, 1787,
+        1814, 1823, 1819, 1820, 1836, 1869, 1905, 1926,
+        1930, 1925, 1929, 1952, 1988, 2021, 2037, 2036,
+        2031, 2040, 2069, 2107, 2136, 2146, 2140, 2138,
+        2153, 2187, 2226, 2250, 2253, 2245, 2246, 2268,
+        2307, 2343, 2361, 2358, 2350, 2356, 2385, 2427,
+        2460, 2470, 2462, 2455, 2468, 2504, 2547, 2574,
+        2577, 2565, 2562, 2583, 2625, 2667, 2687, 2681,
+        2668, 2671, 2700, 2747, 2785, 2796, 2784, 2771,
+        2782, 2820, 2869, 2901, 2903, 2885, 2875, 2895,
+        2943, 2992, 3015, 3007, 2985, 2981, 3013, 3067,
+        3113, 3126, 3107, 3084, 3090, 3134, 3193, 3234,
+        3233, 3205, 3184, 3202, 3258, 3321, 3351, 3336,
+        3299, 3285, 3318, 3388, 3450, 3465, 3433, 3391,
+        3387, 3440, 3522, 3579, 3575, 3523, 3479, 3492,
+        3570, 3663, 3708, 3677, 3604, 3562, 3603, 3711,
+        3814, 3837, 3767, 3669, 3638, 3722, 3873, 3984,
+        3966, 3833, 3699, 3696, 3862, 4092, 4207, 4093,
+        3815, 3602, 3693, 4124, 4631, 4734, 4001, 2315,
+        0, -2315,
+    ],
+    [
+        0, -1201, -2313, -3260, -3985, -4462, -4692, -4706,
+        -4557, -4308, -4027, -3772, -3587, -3494, -3495, -3575,
+        -3703, -3843, -3963, -4036, -4048, -3999, -3903, -3779,
+        -3654, -3549, -3482, -3462, -3485, -3540, -3610, -3676,
+        -3721, -3733, -3708, -3650, -3569, -3482, -3403, -3346,
+        -3317, -3319, -3346, -3388, -3432, -3464, -3476, -3461,
+        -3421, -3362, -3294, -3228, -3175, -3143, -3134, -3146,
+        -3172, -3203, -3228, -3239, -3230, -3201, -3154, -3098,
+        -3041, -2991, -2957, -2941, -2943, -2959, -2981, -3001,
+        -3011, -3006, -2984, -2946, -2898, -2847, -2801, -2765,
+        -2744, -2739, -2747, -2763, -2778, -2788, -2785, -2769,
+        -2738, -2696, -2650, -2606, -2570, -2545, -2535, -2537,
+        -2547, -2559, -2568, -2567, -2554, -2529, -2493, -2451,
+        -2409, -2372, -2345, -2331, -2328, -2333, -2342, -2350,
+        -2351, -2341, -2320, -2288, -2250, -2209, -2173, -2144,
+        -2126, -2119, -2120, -2127, -2133, -2135, -2128, -2110,
+        -2082, -2047, -2009, -1973, -1943, -1922, -1911, -1909,
+        -1913, -1918, -1920, -1915, -1900, -1876, -1844, -1808,
+        -1772, -1740, -1717, -1703, -1698, -1699, -1703, -1706,
+        -1702, -1690, -1669, -1640, -1605, -1570, -1538, -1513,
+        -1496, -1488, -1487, -1489, -1491, -1489, -1479, -1461,
+        -1435, -1403, -1368, -1336, -1309, -1289, -1278, -1275,
+        -1276, -1278, -1276, -1269, -1253, -1229, -1199, -1166,
+        -1133, -1104, -1083, -1070, -1064, -1063, -1064, -1064,
+        -1058, -1044, -1023, -995, -963, -930, -900, -877,
+        -861, -853, -851, -851, -851, -847, -835, -817,
+        -791, -760, -727, -697, -671, -653, -643, -638,
+        -638, -638, -635, -626, -609, -586, -556, -524,
+        -493, -466, -446, -433, -427, -425, -425, -423,
+        -416, -402, -380, -352, -321, -289, -261, -239,
+        -223, -215, -213, -213, -212, -206, -194, -174,
+        -148, -118, -86, -56, -32, -15, -5, -1,
+        0, 1, 5, 15, 32, 56, 86, 118,
+        148, 174, 194, 206, 212, 213, 213, 215,
+        223, 239, 261, 289, 321, 352, 380, 402,
+        416, 423, 425, 425, 427, 433, 446, 466,
+        493, 524, 556, 586, 609, 626, 635, 638,
+        638, 638, 643, 653, 671, 697, 727, 760,
+        791, 817, 835, 847, 851, 851, 851, 853,
+        861, 877, 900, 930, 963, 995, 1023, 1044,
+        1058, 1064, 1064, 1063, 1064, 1070, 1083, 1104,
+        1133, 1166, 1199, 1229, 1253, 1269, 1276, 1278,
+        1276, 1275, 1278, 1289, 1309, 1336, 1368, 1403,
+        1435, 1461, 1479, 1489, 1491, 1489, 1487, 1488,
+        1496, 1513, 1538, 1570, 1605, 1640, 1669, 1690,
+        1702, 1706, 1703, 1699, 1698, 1703, 1717, 1740,
+        1772, 1808, 1844, 1876, 1900, 1915, 1920, 1918,
+        1913, 1909, 1911, 1922, 1943, 1973, 2009, 2047,
+        2082, 2110, 2128, 2135, 2133, 2127, 2120, 2119,
+        2126, 2144, 2173, 2209, 2250, 2288, 2320, 2341,
+        2351, 2350, 2342, 2333, 2328, 2331, 2345, 2372,
+        2409, 2451, 2493, 2529, 2554, 2567, 2568, 2559,
+        2547, 2537, 2535, 2545, 2570, 2606, 2650, 2696,
+        2738, 2769, 2785, 2788, 2778, 2763, 2747, 2739,
+        2744, 2765, 2801, 2847, 2898, 2946, 2984, 3006,
+        3011, 3001, 2981, 2959, 2943, 2941, 2957, 2991,
+        3041, 3098, 3154, 3201, 3230, 3239, 3228, 3203,
+        3172, 3146, 3134, 3143, 3175, 3228, 3294, 3362,
+        3421, 3461, 3476, 3464, 3432, 3388, 3346, 3319,
+        3317, 3346, 3403, 3482, 3569, 3650, 3708, 3733,
+        3721, 3676, 3610, 3540, 3485, 3462, 3482, 3549,
+        3654, 3779, 3903, 3999, 4048, 4036, 3963, 3843,
+        3703, 3575, 3495, 3494, 3587, 3772, 4027, 4308,
+        4557, 4706, 4692, 4462, 3985, 3260, 2313, 1201,
+        0, -1201,
+    ],
+    [
+        0, -606, -1200, -1771, -2308, -2802, -3245, -3630,
+        -3953, -4212, -4405, -4536, -4606, -4622, -4589, -4515,
+        -4409, -4279, -4134, -3983, -3833, -3692, -3566, -3459,
+        -3375, -3315, -3281, -3271, -3282, -3313, -3359, -3416,
+        -3479, -3544, -3605, -3659, -3702, -3732, -3746, -3745,
+        -3727, -3694, -3647, -3589, -3523, -3451, -3377, -3305,
+        -3237, -3177, -3126, -3085, -3057, -3041, -3036, -3043,
+        -3058, -3080, -3107, -3136, -3165, -3190, -3210, -3223,
+        -3228, -3223, -3209, -3184, -3151, -3111, -3064, -3013,
+        -2960, -2907, -2856, -2809, -2768, -2734, -2707, -2689,
+        -2679, -2677, -2681, -2690, -2704, -2719, -2735, -2750,
+        -2761, -2767, -2768, -2762, -2749, -2728, -2701, -2668,
+        -2630, -2589, -2545, -2501, -2458, -2418, -2381, -2350,
+        -2324, -2305, -2292, -2285, -2284, -2287, -2293, -2302,
+        -2311, -2320, -2326, -2329, -2327, -2321, -2309, -2291,
+        -2267, -2238, -2205, -2169, -2131, -2092, -2054, -2017,
+        -1983, -1953, -1928, -1908, -1893, -1883, -1878, -1877,
+        -1880, -1884, -1889, -1894, -1898, -1899, -1896, -1889,
+        -1878, -1861, -1840, -1814, -1785, -1752, -1717, -1681,
+        -1645, -1611, -1579, -1550, -1524, -1504, -1487, -1476,
+        -1468, -1465, -1464, -1466, -1469, -1472, -1473, -1473,
+        -1470, -1463, -1452, -1437, -1417, -1393, -1366, -1336,
+        -1303, -1269, -1235, -1202, -1171, -1142, -1117, -1095,
+        -1078, -1065, -1056, -1051, -1048, -1048, -1049, -1050,
+        -1051, -1050, -1047, -1040, -1030, -1015, -997, -975,
+        -949, -920, -889, -857, -824, -792, -761, -732,
+        -707, -685, -666, -652, -642, -635, -631, -630,
+        -629, -630, -630, -629, -625, -619, -609, -596,
+        -579, -558, -533, -506, -476, -444, -412, -380,
+        -349, -321, -295, -272, -253, -238, -226, -218,
+        -213, -211, -210, -210, -210, -209, -205, -200,
+        -191, -179, -162, -142, -119, -92, -63, -32,
+        0, 32, 63, 92, 119, 142, 162, 179,
+        191, 200, 205, 209, 210, 210, 210, 211,
+        213, 218, 226, 238, 253, 272, 295, 321,
+        349, 380, 412, 444, 476, 506, 533, 558,
+        579, 596, 609, 619, 625, 629, 630, 630,
+        629, 630, 631, 635, 642, 652, 666, 685,
+        707, 732, 761, 792, 824, 857, 889, 920,
+        949, 975, 997, 1015, 1030, 1040, 1047, 1050,
+        1051, 1050, 1049, 1048, 1048, 1051, 1056, 1065,
+        1078, 1095, 1117, 1142, 1171, 1202, 1235, 1269,
+        1303, 1336, 1366, 1393, 1417, 1437, 1452, 1463,
+        1470, 1473, 1473, 1472, 1469, 1466, 1464, 1465,
+        1468, 1476, 1487, 1504, 1524, 1550, 1579, 1611,
+        1645, 1681, 1717, 1752, 1785, 1814, 1840, 1861,
+        1878, 1889, 1896, 1899, 1898, 1894, 1889, 1884,
+        1880, 1877, 1878, 1883, 1893, 1908, 1928, 1953,
+        1983, 2017, 2054, 2092, 2131, 2169, 2205, 2238,
+        2267, 2291, 2309, 2321, 2327, 2329, 2326, 2320,
+        2311, 2302, 2293, 2287, 2284, 2285, 2292, 2305,
+        2324, 2350, 2381, 2418, 2458, 2501, 2545, 2589,
+        2630, 2668, 2701, 2728, 2749, 2762, 2768, 2767,
+        2761, 2750, 2735, 2719, 2704, 2690, 2681, 2677,
+        2679, 2689, 2707, 2734, 2768, 2809, 2856, 2907,
+        2960, 3013, 3064, 3111, 3151, 3184, 3209, 3223,
+        3228, 3223, 3210, 3190, 3165, 3136, 3107, 3080,
+        3058, 3043, 3036, 3041, 3057, 3085, 3126, 3177,
+        3237, 3305, 3377, 3451, 3523, 3589, 3647, 3694,
+        3727, 3745, 3746, 3732, 3702, 3659, 3605, 3544,
+        3479, 3416, 3359, 3313, 3282, 3271, 3281, 3315,
+        3375, 3459, 3566, 3692, 3833, 3983, 4134, 4279,
+        4409, 4515, 4589, 4622, 4606, 4536, 4405, 4212,
+        3953, 3630, 3245, 2802, 2308, 1771, 1200, 606,
+        0, -606,
+    ],
+    [
+        0, -288, -574, -858, -1137, -1412, -1679, -1939,
+        -2190, -2431, -2660, -2878, -3083, -3274, -3452, -3614,
+        -3762, -3895, -4012, -4114, -4200, -4271, -4327, -4369,
+        -4396, -4410, -4412, -4401, -4379, -4346, -4304, -4254,
+        -4196, -4131, -4061, -3986, -3908, -3827, -3745, -3663,
+        -3580, -3499, -3420, -3344, -3271, -3203, -3138, -3079,
+        -3026, -2977, -2935, -2899, -2869, -2845, -2826, -2814,
+        -2807, -2805, -2808, -2815, -2826, -2841, -2858, -2878,
+        -2900, -2924, -2947, -2972, -2995, -3018, -3040, -3059,
+        -3077, -3091, -3103, -3111, -3116, -3117, -3115, -3108,
+        -3097, -3083, -3064, -3042, -3016, -2987, -2954, -2919,
+        -2881, -2841, -2799, -2755, -2711, -2666, -2621, -2575,
+        -2531, -2487, -2445, -2404, -2365, -2328, -2294, -2262,
+        -2233, -2207, -2184, -2164, -2147, -2133, -2122, -2114,
+        -2109, -2106, -2105, -2107, -2110, -2115, -2121, -2128,
+        -2135, -2143, -2150, -2157, -2164, -2169, -2173, -2176,
+        -2177, -2176, -2173, -2168, -2160, -2149, -2137, -2121,
+        -2103, -2083, -2060, -2035, -2008, -1979, -1948, -1915,
+        -1882, -1847, -1812, -1775, -1739, -1703, -1667, -1632,
+        -1597, -1564, -1532, -1501, -1472, -1445, -1420, -1397,
+        -1376, -1357, -1341, -1327, -1315, -1305, -1297, -1291,
+        -1287, -1284, -1283, -1282, -1283, -1285, -1287, -1289,
+        -1291, -1293, -1294, -1295, -1294, -1293, -1290, -1286,
+        -1280, -1272, -1262, -1251, -1237, -1221, -1203, -1184,
+        -1162, -1138, -1113, -1086, -1058, -1028, -998, -966,
+        -934, -901, -868, -835, -803, -771, -739, -709,
+        -679, -651, -624, -599, -575, -553, -533, -515,
+        -499, -485, -472, -462, -453, -446, -440, -436,
+        -433, -431, -430, -430, -430, -430, -430, -430,
+        -430, -428, -426, -423, -419, -414, -407, -398,
+        -387, -375, -361, -345, -327, -308, -286, -263,
+        -238, -212, -184, -156, -126, -95, -64, -32,
+        0, 32, 64, 95, 126, 156, 184, 212,
+        238, 263, 286, 308, 327, 345, 361, 375,
+        387, 398, 407, 414, 419, 423, 426, 428,
+        430, 430, 430, 430, 430, 430, 430, 431,
+        433, 436, 440, 446, 453, 462, 472, 485,
+        499, 515, 533, 553, 575, 599, 624, 651,
+        679, 709, 739, 771, 803, 835, 868, 901,
+        934, 966, 998, 1028, 1058, 1086, 1113, 1138,
+        1162, 1184, 1203, 1221, 1237, 1251, 1262, 1272,
+        1280, 1286, 1290, 1293, 1294, 1295, 1294, 1293,
+        1291, 1289, 1287, 1285, 1283, 1282, 1283, 1284,
+        1287, 1291, 1297, 1305, 1315, 1327, 1341, 1357,
+        1376, 1397, 1420, 1445, 1472, 1501, 1532, 1564,
+        1597, 1632, 1667, 1703, 1739, 1775, 1812, 1847,
+        1882, 1915, 1948, 1979, 2008, 2035, 2060, 2083,
+        2103, 2121, 2137, 2149, 2160, 2168, 2173, 2176,
+        2177, 2176, 2173, 2169, 2164, 2157, 2150, 2143,
+        2135, 2128, 2121, 2115, 2110, 2107, 2105, 2106,
+        2109, 2114, 2122, 2133, 2147, 2164, 2184, 2207,
+        2233, 2262, 2294, 2328, 2365, 2404, 2445, 2487,
+        2531, 2575, 2621, 2666, 2711, 2755, 2799, 2841,
+        2881, 2919, 2954, 2987, 3016, 3042, 3064, 3083,
+        3097, 3108, 3115, 3117, 3116, 3111, 3103, 3091,
+        3077, 3059, 3040, 3018, 2995, 2972, 2947, 2924,
+        2900, 2878, 2858, 2841, 2826, 2815, 2808, 2805,
+        2807, 2814, 2826, 2845, 2869, 2899, 2935, 2977,
+        3026, 3079, 3138, 3203, 3271, 3344, 3420, 3499,
+        3580, 3663, 3745, 3827, 3908, 3986, 4061, 4131,
+        4196, 4254, 4304, 4346, 4379, 4401, 4412, 4410,
+        4396, 4369, 4327, 4271, 4200, 4114, 4012, 3895,
+        3762, 3614, 3452, 3274, 3083, 2878, 2660, 2431,
+        2190, 1939, 1679, 1412, 1137, 858, 574, 288,
+        0, -288,
+    ],
+    [
+        0, -128, -256, -383, -510, -637, -763, -888,
+        -1012, -1135, -1256, -1376, -1495, -1612, -1727, -1840,
+        -1952, -2061, -2167, -2272, -2374, -2473, -2570, -2664,
+        -2755, -2844, -2929, -3011, -3091, -3166, -3239, -3309,
+        -3375, -3437, -3497, -3553, -3605, -3654, -3700, -3742,
+        -3781, -3816, -3847, -3876, -3901, -3922, -3940, -3955,
+        -3967, -3975, -3980, -3982, -3982, -3978, -3971, -3961,
+        -3949, -3934, -3916, -3896, -3874, -3849, -3822, -3793,
+        -3762, -3729, -3695, -3658, -3620, -3581, -3540, -3498,
+        -3455, -3410, -3365, -3319, -3273, -3226, -3178, -3130,
+        -3081, -3033, -2984, -2936, -2887, -2839, -2791, -2743,
+        -2696, -2650, -2604, -2559, -2515, -2471, -2429, -2387,
+        -2347, -2307, -2269, -2232, -2196, -2162, -2128, -2096,
+        -2066, -2037, -2009, -1983, -1958, -1935, -1913, -1892,
+        -1873, -1855, -1839, -1824, -1810, -1798, -1787, -1777,
+        -1768, -1761, -1755, -1749, -1745, -1742, -1740, -1739,
+        -1738, -1739, -1740, -1742, -1744, -1747, -1750, -1754,
+        -1758, -1763, -1768, -1772, -1777, -1782, -1787, -1792,
+        -1797, -1801, -1805, -1809, -1813, -1816, -1818, -1820,
+        -1822, -1823, -1823, -1822, -1821, -1818, -1815, -1811,
+        -1806, -1801, -1794, -1786, -1778, -1768, -1757, -1745,
+        -1733, -1719, -1704, -1688, -1671, -1654, -1635, -1615,
+        -1594, -1572, -1550, -1526, -1502, -1477, -1451, -1424,
+        -1396, -1368, -1339, -1310, -1280, -1249, -1218, -1186,
+        -1155, -1123, -1090, -1057, -1025, -992, -959, -926,
+        -893, -860, -827, -794, -762, -730, -698, -667,
+        -636, -605, -575, -546, -517, -489, -461, -434,
+        -408, -382, -358, -334, -311, -289, -267, -247,
+        -227, -208, -191, -174, -158, -142, -128, -115,
+        -102, -91, -80, -70, -61, -52, -45, -38,
+        -32, -26, -21, -17, -14, -11, -8, -6,
+        -4, -3, -2, -1, -1, 0, 0, 0,
+        0, 0, 0, 0, 1, 1, 2, 3,
+        4, 6, 8, 11, 14, 17, 21, 26,
+        32, 38, 45, 52, 61, 70, 80, 91,
+        102, 115, 128, 142, 158, 174, 191, 208,
+        227, 247, 267, 289, 311, 334, 358, 382,
+        408, 434, 461, 489, 517, 546, 575, 605,
+        636, 667, 698, 730, 762, 794, 827, 860,
+        893, 926, 959, 992, 1025, 1057, 1090, 1123,
+        1155, 1186, 1218, 1249, 1280, 1310, 1339, 1368,
+        1396, 1424, 1451, 1477, 1502, 1526, 1550, 1572,
+        1594, 1615, 1635, 1654, 1671, 1688, 1704, 1719,
+        1733, 1745, 1757, 1768, 1778, 1786, 1794, 1801,
+        1806, 1811, 1815, 1818, 1821, 1822, 1823, 1823,
+        1822, 1820, 1818, 1816, 1813, 1809, 1805, 1801,
+        1797, 1792, 1787, 1782, 1777, 1772, 1768, 1763,
+        1758, 1754, 1750, 1747, 1744, 1742, 1740, 1739,
+        1738, 1739, 1740, 1742, 1745, 1749, 1755, 1761,
+        1768, 1777, 1787, 1798, 1810, 1824, 1839, 1855,
+        1873, 1892, 1913, 1935, 1958, 1983, 2009, 2037,
+        2066, 2096, 2128, 2162, 2196, 2232, 2269, 2307,
+        2347, 2387, 2429, 2471, 2515, 2559, 2604, 2650,
+        2696, 2743, 2791, 2839, 2887, 2936, 2984, 3033,
+        3081, 3130, 3178, 3226, 3273, 3319, 3365, 3410,
+        3455, 3498, 3540, 3581, 3620, 3658, 3695, 3729,
+        3762, 3793, 3822, 3849, 3874, 3896, 3916, 3934,
+        3949, 3961, 3971, 3978, 3982, 3982, 3980, 3975,
+        3967, 3955, 3940, 3922, 3901, 3876, 3847, 3816,
+        3781, 3742, 3700, 3654, 3605, 3553, 3497, 3437,
+        3375, 3309, 3239, 3166, 3091, 3011, 2929, 2844,
+        2755, 2664, 2570, 2473, 2374, 2272, 2167, 2061,
+        1952, 1840, 1727, 1612, 1495, 1376, 1256, 1135,
+        1012, 888, 763, 637, 510, 383, 256, 128,
+        0, -128,
+    ],
+    [
+        0, -64, -128, -192, -256, -319, -383, -447,
+        -510, -573, -636, -699, -761, -823, -885, -947,
+        -1008, -1068, -1129, -1189, -1248, -1307, -1366, -1424,
+        -1481, -1538, -1595, -1650, -1706, -1760, -1814, -1867,
+        -1920, -1972, -2023, -2073, -2123, -2172, -2220, -2267,
+        -2313, -2359, -2404, -2447, -2490, -2533, -2574, -2614,
+        -2653, -2692, -2729, -2766, -2801, -2835, -2869, -2901,
+        -2933, -2963, -2993, -3021, -3049, -3075, -3100, -3124,
+        -3148, -3170, -3191, -3211, -3230, -3247, -3264, -3280,
+        -3294, -3308, -3320, -3332, -3342, -3351, -3360, -3367,
+        -3373, -3378, -3382, -3385, -3386, -3387, -3387, -3386,
+        -3384, -3381, -3376, -3371, -3365, -3358, -3350, -3341,
+        -3331, -3320, -3308, -3296, -3282, -3268, -3253, -3237,
+        -3220, -3202, -3183, -3164, -3144, -3123, -3102, -3079,
+        -3056, -3033, -3008, -2983, -2958, -2932, -2905, -2877,
+        -2849, -2821, -2792, -2762, -2732, -2702, -2671, -2639,
+        -2608, -2575, -2543, -2510, -2477, -2443, -2409, -2375,
+        -2341, -2306, -2271, -2236, -2201, -2166, -2130, -2094,
+        -2059, -2023, -1987, -1951, -1915, -1879, -1843, -1807,
+        -1771, -1735, -1699, -1664, -1628, -1593, -1557, -1522,
+        -1487, -1452, -1418, -1383, -1349, -1316, -1282, -1249,
+        -1216, -1183, -1151, -1118, -1087, -1055, -1024, -994,
+        -964, -934, -904, -875, -847, -819, -791, -764,
+        -737, -711, -685, -659, -635, -610, -586, -563,
+        -540, -518, -496, -474, -454, -433, -414, -394,
+        -375, -357, -340, -322, -306, -290, -274, -259,
+        -244, -230, -216, -203, -191, -179, -167, -156,
+        -145, -135, -125, -116, -107, -99, -91, -83,
+        -76, -69, -63, -57, -51, -46, -41, -37,
+        -33, -29, -25, -22, -19, -16, -14, -12,
+        -10, -8, -7, -5, -4, -3, -2, -2,
+        -1, -1, -1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1, 1,
+        1, 2, 2, 3, 4, 5, 7, 8,
+        10, 12, 14, 16, 19, 22, 25, 29,
+        33, 37, 41, 46, 51, 57, 63, 69,
+        76, 83, 91, 99, 107, 116, 125, 135,
+        145, 156, 167, 179, 191, 203, 216, 230,
+        244, 259, 274, 290, 306, 322, 340, 357,
+        375, 394, 414, 433, 454, 474, 496, 518,
+        540, 563, 586, 610, 635, 659, 685, 711,
+        737, 764, 791, 819, 847, 875, 904, 934,
+        964, 994, 1024, 1055, 1087, 1118, 1151, 1183,
+        1216, 1249, 1282, 1316, 1349, 1383, 1418, 1452,
+        1487, 1522, 1557, 1593, 1628, 1664, 1699, 1735,
+        1771, 1807, 1843, 1879, 1915, 1951, 1987, 2023,
+        2059, 2094, 2130, 2166, 2201, 2236, 2271, 2306,
+        2341, 2375, 2409, 2443, 2477, 2510, 2543, 2575,
+        2608, 2639, 2671, 2702, 2732, 2762, 2792, 2821,
+        2849, 2877, 2905, 2932, 2958, 2983, 3008, 3033,
+        3056, 3079, 3102, 3123, 3144, 3164, 3183, 3202,
+        3220, 3237, 3253, 3268, 3282, 3296, 3308, 3320,
+        3331, 3341, 3350, 3358, 3365, 3371, 3376, 3381,
+        3384, 3386, 3387, 3387, 3386, 3385, 3382, 3378,
+        3373, 3367, 3360, 3351, 3342, 3332, 3320, 3308,
+        3294, 3280, 3264, 3247, 3230, 3211, 3191, 3170,
+        3148, 3124, 3100, 3075, 3049, 3021, 2993, 2963,
+        2933, 2901, 2869, 2835, 2801, 2766, 2729, 2692,
+        2653, 2614, 2574, 2533, 2490, 2447, 2404, 2359,
+        2313, 2267, 2220, 2172, 2123, 2073, 2023, 1972,
+        1920, 1867, 1814, 1760, 1706, 1650, 1595, 1538,
+        1481, 1424, 1366, 1307, 1248, 1189, 1129, 1068,
+        1008, 947, 885, 823, 761, 699, 636, 573,
+        510, 447, 383, 319, 256, 192, 128, 64,
+        0, -64,
+    ],
+    [
+        0, -32, -64, -96, -128, -160, -192, -224,
+        -256, -287, -319, -351, -383, -414, -446, -477,
+        -509, -540, -571, -603, -634, -665, -695, -726,
+        -757, -788, -818, -848, -878, -909, -938, -968,
+        -998, -1027, -1057, -1086, -1115, -1144, -1172, -1201,
+        -1229, -1257, -1285, -1313, -1341, -1368, -1395, -1422,
+        -1449, -1475, -1501, -1528, -1553, -1579, -1604, -1629,
+        -1654, -1679, -1703, -1727, -1751, -1775, -1798, -1821,
+        -1844, -1866, -1889, -1910, -1932, -1953, -1974, -1995,
+        -2016, -2036, -2056, -2075, -2094, -2113, -2132, -2150,
+        -2168, -2186, -2203, -2220, -2237, -2253, -2269, -2284,
+        -2300, -2315, -2329, -2343, -2357, -2371, -2384, -2397,
+        -2409, -2421, -2433, -2444, -2455, -2466, -2476, -2486,
+        -2495, -2504, -2513, -2521, -2529, -2537, -2544, -2551,
+        -2557, -2564, -2569, -2574, -2579, -2584, -2588, -2592,
+        -2595, -2598, -2601, -2603, -2604, -2606, -2607, -2607,
+        -2608, -2607, -2607, -2606, -2604, -2603, -2601, -2598,
+        -2595, -2592, -2588, -2584, -2579, -2574, -2569, -2564,
+        -2557, -2551, -2544, -2537, -2529, -2521, -2513, -2504,
+        -2495, -2486, -2476, -2466, -2455, -2444, -2433, -2421,
+        -2409, -2397, -2384, -2371, -2357, -2343, -2329, -2315,
+        -2300, -2284, -2269, -2253, -2237, -2220, -2203, -2186,
+        -2168, -2150, -2132, -2113, -2094, -2075, -2056, -2036,
+        -2016, -1995, -1974, -1953, -1932, -1910, -1889, -1866,
+        -1844, -1821, -1798, -1775, -1751, -1727, -1703, -1679,
+        -1654, -1629, -1604, -1579, -1553, -1528, -1501, -1475,
+        -1449, -1422, -1395, -1368, -1341, -1313, -1285, -1257,
+        -1229, -1201, -1172, -1144, -1115, -1086, -1057, -1027,
+        -998, -968, -938, -909, -878, -848, -818, -788,
+        -757, -726, -695, -665, -634, -603, -571, -540,
+        -509, -477, -446, -414, -383, -351, -319, -287,
+        -256, -224, -192, -160, -128, -96, -64, -32,
+        0, 32, 64, 96, 128, 160, 192, 224,
+        256, 287, 319, 351, 383, 414, 446, 477,
+        509, 540, 571, 603, 634, 665, 695, 726,
+        757, 788, 818, 848, 878, 909, 938, 968,
+        998, 1027, 1057, 1086, 1115, 1144, 1172, 1201,
+        1229, 1257, 1285, 1313, 1341, 1368, 1395, 1422,
+        1449, 1475, 1501, 1528, 1553, 1579, 1604, 1629,
+        1654, 1679, 1703, 1727, 1751, 1775, 1798, 1821,
+        1844, 1866, 1889, 1910, 1932, 1953, 1974, 1995,
+        2016, 2036, 2056, 2075, 2094, 2113, 2132, 2150,
+        2168, 2186, 2203, 2220, 2237, 2253, 2269, 2284,
+        2300, 2315, 2329, 2343, 2357, 2371, 2384, 2397,
+        2409, 2421, 2433, 2444, 2455, 2466, 2476, 2486,
+        2495, 2504, 2513, 2521, 2529, 2537, 2544, 2551,
+        2557, 2564, 2569, 2574, 2579, 2584, 2588, 2592,
+        2595, 2598, 2601, 2603, 2604, 2606, 2607, 2607,
+        2608, 2607, 2607, 2606, 2604, 2603, 2601, 2598,
+        2595, 2592, 2588, 2584, 2579, 2574, 2569, 2564,
+        2557, 2551, 2544, 2537, 2529, 2521, 2513, 2504,
+        2495, 2486, 2476, 2466, 2455, 2444, 2433, 2421,
+        2409, 2397, 2384, 2371, 2357, 2343, 2329, 2315,
+        2300, 2284, 2269, 2253, 2237, 2220, 2203, 2186,
+        2168, 2150, 2132, 2113, 2094, 2075, 2056, 2036,
+        2016, 1995, 1974, 1953, 1932, 1910, 1889, 1866,
+        1844, 1821, 1798, 1775, 1751, 1727, 1703, 1679,
+        1654, 1629, 1604, 1579, 1553, 1528, 1501, 1475,
+        1449, 1422, 1395, 1368, 1341, 1313, 1285, 1257,
+        1229, 1201, 1172, 1144, 1115, 1086, 1057, 1027,
+        998, 968, 938, 909, 878, 848, 818, 788,
+        757, 726, 695, 665, 634, 603, 571, 540,
+        509, 477, 446, 414, 383, 351, 319, 287,
+        256, 224, 192, 160, 128, 96, 64, 32,
+        0, -32,
+    ],
+];
+
+#[rustfmt::skip]
+pub(super) static SQ: [[i16; TABLE_LEN + 2]; NUM_MIPS] = [
+    [
+        0, -4829, -3698, -4367, -3891, -4261, -3958, -4214,
+        -3992, -4188, -4013, -4172, -4027, -4160, -4036, -4152,
+        -4044, -4145, -4050, -4140, -4054, -4136, -4058, -4133,
+        -4061, -4130, -4064, -4127, -4066, -4125, -4068, -4123,
+        -4069, -4122, -4071, -4120, -4072, -4119, -4073, -4118,
+        -4074, -4117, -4075, -4116, -4076, -4115, -4077, -4115,
+        -4078, -4114, -4078, -4113, -4079, -4113, -4079, -4112,
+        -4080, -4112, -4080, -4111, -4081, -4111, -4081, -4111,
+        -4082, -4110, -4082, -4110, -4082, -4110, -4083, -4109,
+        -4083, -4109, -4083, -4109, -4083, -4109, -4084, -4108,
+        -4084, -4108, -4084, -4108, -4084, -4108, -4084, -4108,
+        -4084, -4107, -4085, -4107, -4085, -4107, -4085, -4107,
+        -4085, -4107, -4085, -4107, -4085, -4107, -4085, -4107,
+        -4085, -4107, -4085, -4107, -4085, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4086, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4086, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4086, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4086, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4085, -4107, -4085, -4107,
+        -4085, -4107, -4085, -4107, -4085, -4107, -4085, -4107,
+        -4085, -4107, -4085, -4107, -4085, -4107, -4085, -4107,
+        -4084, -4108, -4084, -4108, -4084, -4108, -4084, -4108,
+        -4084, -4108, -4084, -4109, -4083, -4109, -4083, -4109,
+        -4083, -4109, -4083, -4110, -4082, -4110, -4082, -4110,
+        -4082, -4111, -4081, -4111, -4081, -4111, -4080, -4112,
+        -4080, -4112, -4079, -4113, -4079, -4113, -4078, -4114,
+        -4078, -4115, -4077, -4115, -4076, -4116, -4075, -4117,
+        -4074, -4118, -4073, -4119, -4072, -4120, -4071, -4122,
+        -4069, -4123, -4068, -4125, -4066, -4127, -4064, -4130,
+        -4061, -4133, -4058, -4136, -4054, -4140, -4050, -4145,
+        -4044, -4152, -4036, -4160, -4027, -4172, -4013, -4188,
+        -3992, -4214, -3958, -4261, -3891, -4367, -3698, -4829,
+        0, 4829, 3698, 4367, 3891, 4261, 3958, 4214,
+        3992, 4188, 4013, 4172, 4027, 4160, 4036, 4152,
+        4044, 4145, 4050, 4140, 4054, 4136, 4058, 4133,
+        4061, 4130, 4064, 4127, 4066, 4125, 4068, 4123,
+        4069, 4122, 4071, 4120, 4072, 4119, 4073, 4118,
+        4074, 4117, 4075, 4116, 4076, 4115, 4077, 4115,
+        4078, 4114, 4078, 4113, 4079, 4113, 4079, 4112,
+        4080, 4112, 4080, 4111, 4081, 4111, 4081, 4111,
+        4082, 4110, 4082, 4110, 4082, 4110, 4083, 4109,
+        4083, 4109, 4083, 4109, 4083, 4109, 4084, 4108,
+        4084, 4108, 4084, 4108, 4084, 4108, 4084, 4108,
+        4084, 4107, 4085, 4107, 4085, 4107, 4085, 4107,
+        4085, 4107, 4085, 4107, 4085, 4107, 4085, 4107,
+        4085, 4107, 4085, 4107, 4085, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4086, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4086, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4086, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4086, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4085, 4107, 4085, 4107,
+        4085, 4107, 4085, 4107, 4085, 4107, 4085, 4107,
+        4085, 4107, 4085, 4107, 4085, 4107, 4085, 4107,
+        4084, 4108, 4084, 4108, 4084, 4108, 4084, 4108,
+        4084, 4108, 4084, 4109, 4083, 4109, 4083, 4109,
+        4083, 4109, 4083, 4110, 4082, 4110, 4082, 4110,
+        4082, 4111, 4081, 4111, 4081, 4111, 4080, 4112,
+        4080, 4112, 4079, 4113, 4079, 4113, 4078, 4114,
+        4078, 4115, 4077, 4115, 4076, 4116, 4075, 4117,
+        4074, 4118, 4073, 4119, 4072, 4120, 4071, 4122,
+        4069, 4123, 4068, 4125, 4066, 4127, 4064, 4130,
+        4061, 4133, 4058, 4136, 4054, 4140, 4050, 4145,
+        4044, 4152, 4036, 4160, 4027, 4172, 4013, 4188,
+        3992, 4214, 3958, 4261, 3891, 4367, 3698, 4829,
+        0, -4829,
+    ],
+    [
+        0, -4829, -3698, -4367, -3891, -4261, -3958, -4214,
+        -3992, -4188, -4013, -4172, -4027, -4160, -4036, -4152,
+        -4044, -4145, -4050, -4140, -4054, -4136, -4058, -4133,
+        -4061, -4130, -4064, -4127, -4066, -4125, -4068, -4123,
+        -4069, -4122, -4071, -4120, -4072, -4119, -4073, -4118,
+        -4074, -4117, -4075, -4116, -4076, -4115, -4077, -4115,
+        -4078, -4114, -4078, -4113, -4079, -4113, -4079, -4112,
+        -4080, -4112, -4080, -4111, -4081, -4111, -4081, -4111,
+        -4082, -4110, -4082, -4110, -4082, -4110, -4083, -4109,
+        -4083, -4109, -4083, -4109, -4083, -4109, -4084, -4108,
+        -4084, -4108, -4084, -4108, -4084, -4108, -4084, -4108,
+        -4084, -4107, -4085, -4107, -4085, -4107, -4085, -4107,
+        -4085, -4107, -4085, -4107, -4085, -4107, -4085, -4107,
+        -4085, -4107, -4085, -4107, -4085, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4086, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4086, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4086, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4086, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4085, -4107, -4085, -4107,
+        -4085, -4107, -4085, -4107, -4085, -4107, -4085, -4107,
+        -4085, -4107, -4085, -4107, -4085, -4107, -4085, -4107,
+        -4084, -4108, -4084, -4108, -4084, -4108, -4084, -4108,
+        -4084, -4108, -4084, -4109, -4083, -4109, -4083, -4109,
+        -4083, -4109, -4083, -4110, -4082, -4110, -4082, -4110,
+        -4082, -4111, -4081, -4111, -4081, -4111, -4080, -4112,
+        -4080, -4112, -4079, -4113, -4079, -4113, -4078, -4114,
+        -4078, -4115, -4077, -4115, -4076, -4116, -4075, -4117,
+        -4074, -4118, -4073, -4119, -4072, -4120, -4071, -4122,
+        -4069, -4123, -4068, -4125, -4066, -4127, -4064, -4130,
+        -4061, -4133, -4058, -4136, -4054, -4140, -4050, -4145,
+        -4044, -4152, -4036, -4160, -4027, -4172, -4013, -4188,
+        -3992, -4214, -3958, -4261, -3891, -4367, -3698, -4829,
+        0, 4829, 3698, 4367, 3891, 4261, 3958, 4214,
+        3992, 4188, 4013, 4172, 4027, 4160, 4036, 4152,
+        4044, 4145, 4050, 4140, 4054, 4136, 4058, 4133,
+        4061, 4130, 4064, 4127, 4066, 4125, 4068, 4123,
+        4069, 4122, 4071, 4120, 4072, 4119, 4073, 4118,
+        4074, 4117, 4075, 4116, 4076, 4115, 4077, 4115,
+        4078, 4114, 4078, 4113, 4079, 4113, 4079, 4112,
+        4080, 4112, 4080, 4111, 4081, 4111, 4081, 4111,
+        4082, 4110, 4082, 4110, 4082, 4110, 4083, 4109,
+        4083, 4109, 4083, 4109, 4083, 4109, 4084, 4108,
+        4084, 4108, 4084, 4108, 4084, 4108, 4084, 4108,
+        4084, 4107, 4085, 4107, 4085, 4107, 4085, 4107,
+        4085, 4107, 4085, 4107, 4085, 4107, 4085, 4107,
+        4085, 4107, 4085, 4107, 4085, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4086, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4086, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4086, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4086, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4085, 4107, 4085, 4107,
+        4085, 4107, 4085, 4107, 4085, 4107, 4085, 4107,
+        4085, 4107, 4085, 4107, 4085, 4107, 4085, 4107,
+        4084, 4108, 4084, 4108, 4084, 4108, 4084, 4108,
+        4084, 4108, 4084, 4109, 4083, 4109, 4083, 4109,
+        4083, 4109, 4083, 4110, 4082, 4110, 4082, 4110,
+        4082, 4111, 4081, 4111, 4081, 4111, 4080, 4112,
+        4080, 4112, 4079, 4113, 4079, 4113, 4078, 4114,
+        4078, 4115, 4077, 4115, 4076, 4116, 4075, 4117,
+        4074, 4118, 4073, 4119, 4072, 4120, 4071, 4122,
+        4069, 4123, 4068, 4125, 4066, 4127, 4064, 4130,
+        4061, 4133, 4058, 4136, 4054, 4140, 4050, 4145,
+        4044, 4152, 4036, 4160, 4027, 4172, 4013, 4188,
+        3992, 4214, 3958, 4261, 3891, 4367, 3698, 4829,
+        0, -4829,
+    ],
+    [
+        0, -4829, -3698, -4367, -3891, -4261, -3958, -4214,
+        -3992, -4188, -4013, -4172, -4027, -4160, -4036, -4152,
+        -4044, -4145, -4050, -4140, -4054, -4136, -4058, -4133,
+        -4061, -4130, -4064, -4127, -4066, -4125, -4068, -4123,
+        -4069, -4122, -4071, -4120, -4072, -4119, -4073, -4118,
+        -4074, -4117, -4075, -4116, -4076, -4115, -4077, -4115,
+        -4078, -4114, -4078, -4113, -4079, -4113, -4079, -4112,
+        -4080, -4112, -4080, -4111, -4081, -4111, -4081, -4111,
+        -4082, -4110, -4082, -4110, -4082, -4110, -4083, -4109,
+        -4083, -4109, -4083, -4109, -4083, -4109, -4084, -4108,
+        -4084, -4108, -4084, -4108, -4084, -4108, -4084, -4108,
+        -4084, -4107, -4085, -4107, -4085, -4107, -4085, -4107,
+        -4085, -4107, -4085, -4107, -4085, -4107, -4085, -4107,
+        -4085, -4107, -4085, -4107, -4085, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4086, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4086, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4086, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4086, -4106, -4086, -4106,
+        -4086, -4106, -4086, -4106, -4085, -4107, -4085, -4107,
+        -4085, -4107, -4085, -4107, -4085, -4107, -4085, -4107,
+        -4085, -4107, -4085, -4107, -4085, -4107, -4085, -4107,
+        -4084, -4108, -4084, -4108, -4084, -4108, -4084, -4108,
+        -4084, -4108, -4084, -4109, -4083, -4109, -4083, -4109,
+        -4083, -4109, -4083, -4110, -4082, -4110, -4082, -4110,
+        -4082, -4111, -4081, -4111, -4081, -4111, -4080, -4112,
+        -4080, -4112, -4079, -4113, -4079, -4113, -4078, -4114,
+        -4078, -4115, -4077, -4115, -4076, -4116, -4075, -4117,
+        -4074, -4118, -4073, -4119, -4072, -4120, -4071, -4122,
+        -4069, -4123, -4068, -4125, -4066, -4127, -4064, -4130,
+        -4061, -4133, -4058, -4136, -4054, -4140, -4050, -4145,
+        -4044, -4152, -4036, -4160, -4027, -4172, -4013, -4188,
+        -3992, -4214, -3958, -4261, -3891, -4367, -3698, -4829,
+        0, 4829, 3698, 4367, 3891, 4261, 3958, 4214,
+        3992, 4188, 4013, 4172, 4027, 4160, 4036, 4152,
+        4044, 4145, 4050, 4140, 4054, 4136, 4058, 4133,
+        4061, 4130, 4064, 4127, 4066, 4125, 4068, 4123,
+        4069, 4122, 4071, 4120, 4072, 4119, 4073, 4118,
+        4074, 4117, 4075, 4116, 4076, 4115, 4077, 4115,
+        4078, 4114, 4078, 4113, 4079, 4113, 4079, 4112,
+        4080, 4112, 4080, 4111, 4081, 4111, 4081, 4111,
+        4082, 4110, 4082, 4110, 4082, 4110, 4083, 4109,
+        4083, 4109, 4083, 4109, 4083, 4109, 4084, 4108,
+        4084, 4108, 4084, 4108, 4084, 4108, 4084, 4108,
+        4084, 4107, 4085, 4107, 4085, 4107, 4085, 4107,
+        4085, 4107, 4085, 4107, 4085, 4107, 4085, 4107,
+        4085, 4107, 4085, 4107, 4085, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4086, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4086, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4086, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4086, 4106, 4086, 4106,
+        4086, 4106, 4086, 4106, 4085, 4107, 4085, 4107,
+        4085, 4107, 4085, 4107, 4085, 4107, 4085, 4107,
+        4085, 4107, 4085, 4107, 4085, 4107, 4085, 4107,
+        4084, 4108, 4084, 4108, 4084, 4108, 4084, 4108,
+        4084, 4108, 4084, 4109, 4083, 4109, 4083, 4109,
+        4083, 4109, 4083, 4110, 4082, 4110, 4082, 4110,
+        4082, 4111, 4081, 4111, 4081, 4111, 4080, 4112,
+        4080, 4112, 4079, 4113, 4079, 4113, 4078, 4114,
+        4078, 4115, 4077, 4115, 4076, 4116, 4075, 4117,
+        4074, 4118, 4073, 4119, 4072, 4120, 4071, 4122,
+        4069, 4123, 4068, 4125, 4066, 4127, 4064, 4130,
+        4061, 4133, 4058, 4136, 4054, 4140, 4050, 4145,
+        4044, 4152, 4036, 4160, 4027, 4172, 4013, 4188,
+        3992, 4214, 3958, 4261, 3891, 4367, 3698, 4829,
+        0, -4829,
+    ],
+    [
+        0, -4016, -4705, -3799, -3927, -4366, -4071, -3915,
+        -4211, -4177, -3961, -4102, -4206, -4031, -4037, -4185,
+        -4099, -4016, -4138, -4145, -4032, -4088, -4159, -4068,
+        -4053, -4145, -4108, -4043, -4115, -4135, -4057, -4082,
+        -4141, -4084, -4060, -4127, -4112, -4057, -4103, -4129,
+        -4071, -4079, -4130, -4093, -4065, -4116, -4114, -4066,
+        -4096, -4125, -4080, -4077, -4123, -4099, -4069, -4109,
+        -4115, -4073, -4091, -4122, -4086, -4076, -4117, -4103,
+        -4072, -4103, -4116, -4078, -4087, -4119, -4092, -4076,
+        -4112, -4106, -4075, -4098, -4116, -4083, -4084, -4116,
+        -4096, -4076, -4107, -4109, -4078, -4094, -4115, -4087,
+        -4082, -4113, -4100, -4077, -4103, -4111, -4080, -4091,
+        -4115, -4091, -4081, -4110, -4103, -4078, -4099, -4112,
+        -4083, -4088, -4113, -4094, -4080, -4107, -4106, -4079,
+        -4096, -4113, -4086, -4085, -4112, -4098, -4079, -4104,
+        -4108, -4081, -4093, -4113, -4089, -4083, -4110, -4101,
+        -4079, -4101, -4110, -4083, -4089, -4113, -4093, -4081,
+        -4108, -4104, -4079, -4098, -4112, -4085, -4086, -4113,
+        -4096, -4079, -4106, -4107, -4080, -4094, -4113, -4088,
+        -4083, -4112, -4099, -4078, -4103, -4110, -4081, -4091,
+        -4115, -4091, -4080, -4111, -4103, -4077, -4100, -4113,
+        -4082, -4087, -4115, -4094, -4078, -4109, -4107, -4076,
+        -4096, -4116, -4084, -4083, -4116, -4098, -4075, -4106,
+        -4112, -4076, -4092, -4119, -4087, -4078, -4116, -4103,
+        -4072, -4103, -4117, -4076, -4086, -4122, -4091, -4073,
+        -4115, -4109, -4069, -4099, -4123, -4077, -4080, -4125,
+        -4096, -4066, -4114, -4116, -4065, -4093, -4130, -4079,
+        -4071, -4129, -4103, -4057, -4112, -4127, -4060, -4084,
+        -4141, -4082, -4057, -4135, -4115, -4043, -4108, -4145,
+        -4053, -4068, -4159, -4088, -4032, -4145, -4138, -4016,
+        -4099, -4185, -4037, -4031, -4206, -4102, -3961, -4177,
+        -4211, -3915, -4071, -4366, -3927, -3799, -4705, -4016,
+        0, 4016, 4705, 3799, 3927, 4366, 4071, 3915,
+        4211, 4177, 3961, 4102, 4206, 4031, 4037, 4185,
+        4099, 4016, 4138, 4145, 4032, 4088, 4159, 4068,
+        4053, 4145, 4108, 4043, 4115, 4135, 4057, 4082,
+        4141, 4084, 4060, 4127, 4112, 4057, 4103, 4129,
+        4071, 4079, 4130, 4093, 4065, 4116, 4114, 4066,
+        4096, 4125, 4080, 4077, 4123, 4099, 4069, 4109,
+        4115, 4073, 4091, 4122, 4086, 4076, 4117, 4103,
+        4072, 4103, 4116, 4078, 4087, 4119, 4092, 4076,
+        4112, 4106, 4075, 4098, 4116, 4083, 4084, 4116,
+        4096, 4076, 4107, 4109, 4078, 4094, 4115, 4087,
+        4082, 4113, 4100, 4077, 4103, 4111, 4080, 4091,
+        4115, 4091, 4081, 4110, 4103, 4078, 4099, 4112,
+        4083, 4088, 4113, 4094, 4080, 4107, 4106, 4079,
+        4096, 4113, 4086, 4085, 4112, 4098, 4079, 4104,
+        4108, 4081, 4093, 4113, 4089, 4083, 4110, 4101,
+        4079, 4101, 4110, 4083, 4089, 4113, 4093, 4081,
+        4108, 4104, 4079, 4098, 4112, 4085, 4086, 4113,
+        4096, 4079, 4106, 4107, 4080, 4094, 4113, 4088,
+        4083, 4112, 4099, 4078, 4103, 4110, 4081, 4091,
+        4115, 4091, 4080, 4111, 4103, 4077, 4100, 4113,
+        4082, 4087, 4115, 4094, 4078, 4109, 4107, 4076,
+        4096, 4116, 4084, 4083, 4116, 4098, 4075, 4106,
+        4112, 4076, 4092, 4119, 4087, 4078, 4116, 4103,
+        4072, 4103, 4117, 4076, 4086, 4122, 4091, 4073,
+        4115, 4109, 4069, 4099, 4123, 4077, 4080, 4125,
+        4096, 4066, 4114, 4116, 4065, 4093, 4130, 4079,
+        4071, 4129, 4103, 4057, 4112, 4127, 4060, 4084,
+        4141, 4082, 4057, 4135, 4115, 4043, 4108, 4145,
+        4053, 4068, 4159, 4088, 4032, 4145, 4138, 4016,
+        4099, 4185, 4037, 4031, 4206, 4102, 3961, 4177,
+        4211, 3915, 4071, 4366, 3927, 3799, 4705, 4016,
+        0, -4016,
+    ],
+    [
+        0, -2318, -4016, -4777, -4705, -4221, -3799, -3710,
+        -3927, -4223, -4366, -4282, -4071, -3910, -3914, -4056,
+        -4211, -4260, -4177, -4040, -3960, -3992, -4103, -4198,
+        -4207, -4128, -4030, -3991, -4036, -4126, -4186, -4172,
+        -4099, -4028, -4014, -4066, -4139, -4174, -4146, -4080,
+        -4030, -4034, -4088, -4145, -4162, -4125, -4067, -4034,
+        -4052, -4104, -4148, -4149, -4108, -4059, -4040, -4067,
+        -4116, -4147, -4137, -4094, -4054, -4048, -4081, -4125,
+        -4144, -4125, -4083, -4052, -4057, -4093, -4131, -4140,
+        -4113, -4074, -4053, -4067, -4104, -4134, -4133, -4102,
+        -4067, -4055, -4077, -4113, -4135, -4126, -4092, -4063,
+        -4060, -4086, -4120, -4134, -4117, -4084, -4060, -4066,
+        -4096, -4126, -4131, -4108, -4076, -4060, -4073, -4105,
+        -4129, -4127, -4100, -4070, -4061, -4081, -4112, -4131,
+        -4121, -4091, -4065, -4065, -4089, -4119, -4130, -4114,
+        -4083, -4063, -4069, -4098, -4125, -4128, -4106, -4076,
+        -4062, -4076, -4106, -4128, -4125, -4098, -4069, -4063,
+        -4083, -4114, -4130, -4119, -4089, -4065, -4065, -4091,
+        -4121, -4131, -4112, -4081, -4061, -4070, -4100, -4127,
+        -4129, -4105, -4073, -4060, -4076, -4108, -4131, -4126,
+        -4096, -4066, -4060, -4084, -4117, -4134, -4120, -4086,
+        -4060, -4063, -4092, -4126, -4135, -4113, -4077, -4055,
+        -4067, -4102, -4133, -4134, -4104, -4067, -4053, -4074,
+        -4113, -4140, -4131, -4093, -4057, -4052, -4083, -4125,
+        -4144, -4125, -4081, -4048, -4054, -4094, -4137, -4147,
+        -4116, -4067, -4040, -4059, -4108, -4149, -4148, -4104,
+        -4052, -4034, -4067, -4125, -4162, -4145, -4088, -4034,
+        -4030, -4080, -4146, -4174, -4139, -4066, -4014, -4028,
+        -4099, -4172, -4186, -4126, -4036, -3991, -4030, -4128,
+        -4207, -4198, -4103, -3992, -3960, -4040, -4177, -4260,
+        -4211, -4056, -3914, -3910, -4071, -4282, -4366, -4223,
+        -3927, -3710, -3799, -4221, -4705, -4777, -4016, -2318,
+        0, 2318, 4016, 4777, 4705, 4221, 3799, 3710,
+        3927, 4223, 4366, 4282, 4071, 3910, 3914, 4056,
+        4211, 4260, 4177, 4040, 3960, 3992, 4103, 4198,
+        4207, 4128, 4030, 3991, 4036, 4126, 4186, 4172,
+        4099, 4028, 4014, 4066, 4139, 4174, 4146, 4080,
+        4030, 4034, 4088, 4145, 4162, 4125, 4067, 4034,
+        4052, 4104, 4148, 4149, 4108, 4059, 4040, 4067,
+        4116, 4147, 4137, 4094, 4054, 4048, 4081, 4125,
+        4144, 4125, 4083, 4052, 4057, 4093, 4131, 4140,
+        4113, 4074, 4053, 4067, 4104, 4134, 4133, 4102,
+        4067, 4055, 4077, 4113, 4135, 4126, 4092, 4063,
+        4060, 4086, 4120, 4134, 4117, 4084, 4060, 4066,
+        4096, 4126, 4131, 4108, 4076, 4060, 4073, 4105,
+        4129, 4127, 4100, 4070, 4061, 4081, 4112, 4131,
+        4121, 4091, 4065, 4065, 4089, 4119, 4130, 4114,
+        4083, 4063, 4069, 4098, 4125, 4128, 4106, 4076,
+        4062, 4076, 4106, 4128, 4125, 4098, 4069, 4063,
+        4083, 4114, 4130, 4119, 4089, 4065, 4065, 4091,
+        4121, 4131, 4112, 4081, 4061, 4070, 4100, 4127,
+        4129, 4105, 4073, 4060, 4076, 4108, 4131, 4126,
+        4096, 4066, 4060, 4084, 4117, 4134, 4120, 4086,
+        4060, 4063, 4092, 4126, 4135, 4113, 4077, 4055,
+        4067, 4102, 4133, 4134, 4104, 4067, 4053, 4074,
+        4113, 4140, 4131, 4093, 4057, 4052, 4083, 4125,
+        4144, 4125, 4081, 4048, 4054, 4094, 4137, 4147,
+        4116, 4067, 4040, 4059, 4108, 4149, 4148, 4104,
+        4052, 4034, 4067, 4125, 4162, 4145, 4088, 4034,
+        4030, 4080, 4146, 4174, 4139, 4066, 4014, 4028,
+        4099, 4172, 4186, 4126, 4036, 3991, 4030, 4128,
+        4207, 4198, 4103, 3992, 3960, 4040, 4177, 4260,
+        4211, 4056, 3914, 3910, 4071, 4282, 4366, 4223,
+        3927, 3710, 3799, 4221, 4705, 4777, 4016, 2318,
+        0, -2318,
+    ],
+    [
+        0, -1201, -2318, -3274, -4017, -4518, -4778, -4824,
+        -4705, -4483, -4221, -3978, -3798, -3706, -3708, -3790,
+        -3926, -4082, -4224, -4325, -4369, -4352, -4283, -4181,
+        -4070, -3972, -3908, -3887, -3911, -3973, -4056, -4142,
+        -4214, -4257, -4264, -4235, -4179, -4108, -4038, -3984,
+        -3955, -3958, -3989, -4042, -4103, -4161, -4203, -4221,
+        -4212, -4178, -4129, -4075, -4026, -3994, -3985, -3999,
+        -4033, -4080, -4128, -4169, -4193, -4196, -4177, -4142,
+        -4099, -4055, -4021, -4004, -4007, -4028, -4064, -4105,
+        -4144, -4171, -4183, -4175, -4151, -4116, -4077, -4043,
+        -4020, -4014, -4026, -4052, -4087, -4123, -4154, -4171,
+        -4172, -4158, -4130, -4095, -4061, -4035, -4022, -4025,
+        -4043, -4072, -4106, -4138, -4160, -4168, -4162, -4141,
+        -4111, -4077, -4049, -4030, -4026, -4036, -4060, -4090,
+        -4122, -4149, -4163, -4164, -4150, -4124, -4093, -4062,
+        -4039, -4028, -4031, -4049, -4076, -4108, -4137, -4157,
+        -4165, -4157, -4137, -4108, -4076, -4049, -4031, -4028,
+        -4039, -4062, -4093, -4124, -4150, -4164, -4163, -4149,
+        -4122, -4090, -4060, -4036, -4026, -4030, -4049, -4077,
+        -4111, -4141, -4162, -4168, -4160, -4138, -4106, -4072,
+        -4043, -4025, -4022, -4035, -4061, -4095, -4130, -4158,
+        -4172, -4171, -4154, -4123, -4087, -4052, -4026, -4014,
+        -4020, -4043, -4077, -4116, -4151, -4175, -4183, -4171,
+        -4144, -4105, -4064, -4028, -4007, -4004, -4021, -4055,
+        -4099, -4142, -4177, -4196, -4193, -4169, -4128, -4080,
+        -4033, -3999, -3985, -3994, -4026, -4075, -4129, -4178,
+        -4212, -4221, -4203, -4161, -4103, -4042, -3989, -3958,
+        -3955, -3984, -4038, -4108, -4179, -4235, -4264, -4257,
+        -4214, -4142, -4056, -3973, -3911, -3887, -3908, -3972,
+        -4070, -4181, -4283, -4352, -4369, -4325, -4224, -4082,
+        -3926, -3790, -3708, -3706, -3798, -3978, -4221, -4483,
+        -4705, -4824, -4778, -4518, -4017, -3274, -2318, -1201,
+        0, 1201, 2318, 3274, 4017, 4518, 4778, 4824,
+        4705, 4483, 4221, 3978, 3798, 3706, 3708, 3790,
+        3926, 4082, 4224, 4325, 4369, 4352, 4283, 4181,
+        4070, 3972, 3908, 3887, 3911, 3973, 4056, 4142,
+        4214, 4257, 4264, 4235, 4179, 4108, 4038, 3984,
+        3955, 3958, 3989, 4042, 4103, 4161, 4203, 4221,
+        4212, 4178, 4129, 4075, 4026, 3994, 3985, 3999,
+        4033, 4080, 4128, 4169, 4193, 4196, 4177, 4142,
+        4099, 4055, 4021, 4004, 4007, 4028, 4064, 4105,
+        4144, 4171, 4183, 4175, 4151, 4116, 4077, 4043,
+        4020, 4014, 4026, 4052, 4087, 4123, 4154, 4171,
+        4172, 4158, 4130, 4095, 4061, 4035, 4022, 4025,
+        4043, 4072, 4106, 4138, 4160, 4168, 4162, 4141,
+        4111, 4077, 4049, 4030, 4026, 4036, 4060, 4090,
+        4122, 4149, 4163, 4164, 4150, 4124, 4093, 4062,
+        4039, 4028, 4031, 4049, 4076, 4108, 4137, 4157,
+        4165, 4157, 4137, 4108, 4076, 4049, 4031, 4028,
+        4039, 4062, 4093, 4124, 4150, 4164, 4163, 4149,
+        4122, 4090, 4060, 4036, 4026, 4030, 4049, 4077,
+        4111, 4141, 4162, 4168, 4160, 4138, 4106, 4072,
+        4043, 4025, 4022, 4035, 4061, 4095, 4130, 4158,
+        4172, 4171, 4154, 4123, 4087, 4052, 4026, 4014,
+        4020, 4043, 4077, 4116, 4151, 4175, 4183, 4171,
+        4144, 4105, 4064, 4028, 4007, 4004, 4021, 4055,
+        4099, 4142, 4177, 4196, 4193, 4169, 4128, 4080,
+        4033, 3999, 3985, 3994, 4026, 4075, 4129, 4178,
+        4212, 4221, 4203, 4161, 4103, 4042, 3989, 3958,
+        3955, 3984, 4038, 4108, 4179, 4235, 4264, 4257,
+        4214, 4142, 4056, 3973, 3911, 3887, 3908, 3972,
+        4070, 4181, 4283, 4352, 4369, 4325, 4224, 4082,
+        3926, 3790, 3708, 3706, 3798, 3978, 4221, 4483,
+        4705, 4824, 4778, 4518, 4017, 3274, 2318, 1201,
+        0, -1201,
+    ],
+    [
+        0, -638, -1263, -1863, -2427, -2945, -3407, -3809,
+        -4144, -4411, -4611, -4744, -4816, -4832, -4799, -4726,
+        -4622, -4497, -4360, -4220, -4086, -3964, -3861, -3780,
+        -3725, -3696, -3693, -3715, -3758, -3819, -3893, -3974,
+        -4058, -4140, -4214, -4278, -4327, -4360, -4376, -4375,
+        -4356, -4323, -4278, -4224, -4165, -4103, -4044, -3990,
+        -3944, -3909, -3886, -3877, -3881, -3898, -3926, -3963,
+        -4007, -4055, -4104, -4152, -4194, -4230, -4257, -4273,
+        -4279, -4274, -4258, -4232, -4200, -4161, -4120, -4078,
+        -4038, -4002, -3973, -3951, -3939, -3936, -3943, -3958,
+        -3982, -4012, -4047, -4084, -4121, -4156, -4187, -4213,
+        -4231, -4240, -4241, -4233, -4217, -4194, -4166, -4133,
+        -4099, -4065, -4033, -4005, -3983, -3967, -3960, -3961,
+        -3970, -3986, -4009, -4037, -4068, -4101, -4133, -4163,
+        -4189, -4209, -4222, -4228, -4225, -4215, -4198, -4175,
+        -4147, -4116, -4084, -4052, -4024, -4000, -3981, -3970,
+        -3966, -3970, -3981, -4000, -4024, -4052, -4084, -4116,
+        -4147, -4175, -4198, -4215, -4225, -4228, -4222, -4209,
+        -4189, -4163, -4133, -4101, -4068, -4037, -4009, -3986,
+        -3970, -3961, -3960, -3967, -3983, -4005, -4033, -4065,
+        -4099, -4133, -4166, -4194, -4217, -4233, -4241, -4240,
+        -4231, -4213, -4187, -4156, -4121, -4084, -4047, -4012,
+        -3982, -3958, -3943, -3936, -3939, -3951, -3973, -4002,
+        -4038, -4078, -4120, -4161, -4200, -4232, -4258, -4274,
+        -4279, -4273, -4257, -4230, -4194, -4152, -4104, -4055,
+        -4007, -3963, -3926, -3898, -3881, -3877, -3886, -3909,
+        -3944, -3990, -4044, -4103, -4165, -4224, -4278, -4323,
+        -4356, -4375, -4376, -4360, -4327, -4278, -4214, -4140,
+        -4058, -3974, -3893, -3819, -3758, -3715, -3693, -3696,
+        -3725, -3780, -3861, -3964, -4086, -4220, -4360, -4497,
+        -4622, -4726, -4799, -4832, -4816, -4744, -4611, -4411,
+        -4144, -3809, -3407, -2945, -2427, -1863, -1263, -638,
+        0, 638, 1263, 1863, 2427, 2945, 3407, 3809,
+        4144, 4411, 4611, 4744, 4816, 4832, 4799, 4726,
+        4622, 4497, 4360, 4220, 4086, 3964, 3861, 3780,
+        3725, 3696, 3693, 3715, 3758, 3819, 3893, 3974,
+        4058, 4140, 4214, 4278, 4327, 4360, 4376, 4375,
+        4356, 4323, 4278, 4224, 4165, 4103, 4044, 3990,
+        3944, 3909, 3886, 3877, 3881, 3898, 3926, 3963,
+        4007, 4055, 4104, 4152, 4194, 4230, 4257, 4273,
+        4279, 4274, 4258, 4232, 4200, 4161, 4120, 4078,
+        4038, 4002, 3973, 3951, 3939, 3936, 3943, 3958,
+        3982, 4012, 4047, 4084, 4121, 4156, 4187, 4213,
+        4231, 4240, 4241, 4233, 4217, 4194, 4166, 4133,
+        4099, 4065, 4033, 4005, 3983, 3967, 3960, 3961,
+        3970, 3986, 4009, 4037, 4068, 4101, 4133, 4163,
+        4189, 4209, 4222, 4228, 4225, 4215, 4198, 4175,
+        4147, 4116, 4084, 4052, 4024, 4000, 3981, 3970,
+        3966, 3970, 3981, 4000, 4024, 4052, 4084, 4116,
+        4147, 4175, 4198, 4215, 4225, 4228, 4222, 4209,
+        4189, 4163, 4133, 4101, 4068, 4037, 4009, 3986,
+        3970, 3961, 3960, 3967, 3983, 4005, 4033, 4065,
+        4099, 4133, 4166, 4194, 4217, 4233, 4241, 4240,
+        4231, 4213, 4187, 4156, 4121, 4084, 4047, 4012,
+        3982, 3958, 3943, 3936, 3939, 3951, 3973, 4002,
+        4038, 4078, 4120, 4161, 4200, 4232, 4258, 4274,
+        4279, 4273, 4257, 4230, 4194, 4152, 4104, 4055,
+        4007, 3963, 3926, 3898, 3881, 3877, 3886, 3909,
+        3944, 3990, 4044, 4103, 4165, 4224, 4278, 4323,
+        4356, 4375, 4376, 4360, 4327, 4278, 4214, 4140,
+        4058, 3974, 3893, 3819, 3758, 3715, 3693, 3696,
+        3725, 3780, 3861, 3964, 4086, 4220, 4360, 4497,
+        4622, 4726, 4799, 4832, 4816, 4744, 4611, 4411,
+        4144, 3809, 3407, 2945, 2427, 1863, 1263, 638,
+        0, -638,
+    ],
+    [
+        0, -320, -638, -953, -1263, -1567, -1864, -2151,
+        -2428, -2694, -2946, -3185, -3410, -3619, -3813, -3989,
+        -4150, -4293, -4418, -4527, -4619, -4694, -4754, -4797,
+        -4826, -4840, -4842, -4831, -4809, -4776, -4734, -4685,
+        -4629, -4567, -4501, -4432, -4361, -4289, -4218, -4147,
+        -4079, -4014, -3954, -3897, -3846, -3801, -3762, -3730,
+        -3705, -3686, -3674, -3670, -3672, -3680, -3695, -3715,
+        -3741, -3771, -3805, -3843, -3884, -3927, -3972, -4017,
+        -4062, -4107, -4151, -4193, -4232, -4269, -4302, -4331,
+        -4356, -4377, -4393, -4404, -4411, -4412, -4409, -4401,
+        -4388, -4371, -4351, -4326, -4299, -4269, -4237, -4203,
+        -4167, -4132, -4096, -4060, -4026, -3993, -3962, -3933,
+        -3907, -3884, -3864, -3849, -3837, -3829, -3825, -3826,
+        -3830, -3839, -3851, -3867, -3886, -3909, -3934, -3961,
+        -3991, -4021, -4053, -4086, -4118, -4150, -4181, -4210,
+        -4238, -4264, -4287, -4307, -4323, -4337, -4346, -4352,
+        -4354, -4352, -4346, -4337, -4323, -4307, -4287, -4264,
+        -4238, -4210, -4181, -4150, -4118, -4086, -4053, -4021,
+        -3991, -3961, -3934, -3909, -3886, -3867, -3851, -3839,
+        -3830, -3826, -3825, -3829, -3837, -3849, -3864, -3884,
+        -3907, -3933, -3962, -3993, -4026, -4060, -4096, -4132,
+        -4167, -4203, -4237, -4269, -4299, -4326, -4351, -4371,
+        -4388, -4401, -4409, -4412, -4411, -4404, -4393, -4377,
+        -4356, -4331, -4302, -4269, -4232, -4193, -4151, -4107,
+        -4062, -4017, -3972, -3927, -3884, -3843, -3805, -3771,
+        -3741, -3715, -3695, -3680, -3672, -3670, -3674, -3686,
+        -3705, -3730, -3762, -3801, -3846, -3897, -3954, -4014,
+        -4079, -4147, -4218, -4289, -4361, -4432, -4501, -4567,
+        -4629, -4685, -4734, -4776, -4809, -4831, -4842, -4840,
+        -4826, -4797, -4754, -4694, -4619, -4527, -4418, -4293,
+        -4150, -3989, -3813, -3619, -3410, -3185, -2946, -2694,
+        -2428, -2151, -1864, -1567, -1263, -953, -638, -320,
+        0, 320, 638, 953, 1263, 1567, 1864, 2151,
+        2428, 2694, 2946, 3185, 3410, 3619, 3813, 3989,
+        4150, 4293, 4418, 4527, 4619, 4694, 4754, 4797,
+        4826, 4840, 4842, 4831, 4809, 4776, 4734, 4685,
+        4629, 4567, 4501, 4432, 4361, 4289, 4218, 4147,
+        4079, 4014, 3954, 3897, 3846, 3801, 3762, 3730,
+        3705, 3686, 3674, 3670, 3672, 3680, 3695, 3715,
+        3741, 3771, 3805, 3843, 3884, 3927, 3972, 4017,
+        4062, 4107, 4151, 4193, 4232, 4269, 4302, 4331,
+        4356, 4377, 4393, 4404, 4411, 4412, 4409, 4401,
+        4388, 4371, 4351, 4326, 4299, 4269, 4237, 4203,
+        4167, 4132, 4096, 4060, 4026, 3993, 3962, 3933,
+        3907, 3884, 3864, 3849, 3837, 3829, 3825, 3826,
+        3830, 3839, 3851, 3867, 3886, 3909, 3934, 3961,
+        3991, 4021, 4053, 4086, 4118, 4150, 4181, 4210,
+        4238, 4264, 4287, 4307, 4323, 4337, 4346, 4352,
+        4354, 4352, 4346, 4337, 4323, 4307, 4287, 4264,
+        4238, 4210, 4181, 4150, 4118, 4086, 4053, 4021,
+        3991, 3961, 3934, 3909, 3886, 3867, 3851, 3839,
+        3830, 3826, 3825, 3829, 3837, 3849, 3864, 3884,
+        3907, 3933, 3962, 3993, 4026, 4060, 4096, 4132,
+        4167, 4203, 4237, 4269, 4299, 4326, 4351, 4371,
+        4388, 4401, 4409, 4412, 4411, 4404, 4393, 4377,
+        4356, 4331, 4302, 4269, 4232, 4193, 4151, 4107,
+        4062, 4017, 3972, 3927, 3884, 3843, 3805, 3771,
+        3741, 3715, 3695, 3680, 3672, 3670, 3674, 3686,
+        3705, 3730, 3762, 3801, 3846, 3897, 3954, 4014,
+        4079, 4147, 4218, 4289, 4361, 4432, 4501, 4567,
+        4629, 4685, 4734, 4776, 4809, 4831, 4842, 4840,
+        4826, 4797, 4754, 4694, 4619, 4527, 4418, 4293,
+        4150, 3989, 3813, 3619, 3410, 3185, 2946, 2694,
+        2428, 2151, 1864, 1567, 1263, 953, 638, 320,
+        0, -320,
+    ],
+    [
+        0, -128, -256, -384, -511, -638, -765, -891,
+        -1016, -1140, -1264, -1387, -1508, -1629, -1748, -1867,
+        -1983, -2098, -2212, -2324, -2435, -2543, -2650, -2755,
+        -2858, -2958, -3057, -3154, -3248, -3340, -3430, -3517,
+        -3602, -3684, -3764, -3841, -3916, -3988, -4058, -4124,
+        -4188, -4250, -4308, -4364, -4417, -4468, -4515, -4560,
+        -4602, -4642, -4678, -4712, -4743, -4772, -4798, -4821,
+        -4842, -4860, -4875, -4888, -4899, -4907, -4912, -4916,
+        -4917, -4916, -4913, -4907, -4900, -4890, -4879, -4866,
+        -4851, -4834, -4816, -4796, -4775, -4752, -4728, -4702,
+        -4675, -4648, -4619, -4589, -4559, -4527, -4495, -4462,
+        -4429, -4395, -4361, -4327, -4292, -4257, -4222, -4188,
+        -4153, -4118, -4084, -4050, -4017, -3984, -3951, -3919,
+        -3888, -3857, -3828, -3799, -3771, -3744, -3718, -3693,
+        -3670, -3647, -3626, -3606, -3587, -3570, -3554, -3540,
+        -3527, -3515, -3505, -3496, -3489, -3484, -3480, -3478,
+        -3477, -3478, -3480, -3484, -3489, -3496, -3505, -3515,
+        -3527, -3540, -3554, -3570, -3587, -3606, -3626, -3647,
+        -3670, -3693, -3718, -3744, -3771, -3799, -3828, -3857,
+        -3888, -3919, -3951, -3984, -4017, -4050, -4084, -4118,
+        -4153, -4188, -4222, -4257, -4292, -4327, -4361, -4395,
+        -4429, -4462, -4495, -4527, -4559, -4589, -4619, -4648,
+        -4675, -4702, -4728, -4752, -4775, -4796, -4816, -4834,
+        -4851, -4866, -4879, -4890, -4900, -4907, -4913, -4916,
+        -4917, -4916, -4912, -4907, -4899, -4888, -4875, -4860,
+        -4842, -4821, -4798, -4772, -4743, -4712, -4678, -4642,
+        -4602, -4560, -4515, -4468, -4417, -4364, -4308, -4250,
+        -4188, -4124, -4058, -3988, -3916, -3841, -3764, -3684,
+        -3602, -3517, -3430, -3340, -3248, -3154, -3057, -2958,
+        -2858, -2755, -2650, -2543, -2435, -2324, -2212, -2098,
+        -1983, -1867, -1748, -1629, -1508, -1387, -1264, -1140,
+        -1016, -891, -765, -638, -511, -384, -256, -128,
+        0, 128, 256, 384, 511, 638, 765, 891,
+        1016, 1140, 1264, 1387, 1508, 1629, 1748, 1867,
+        1983, 2098, 2212, 2324, 2435, 2543, 2650, 2755,
+        2858, 2958, 3057, 3154, 3248, 3340, 3430, 3517,
+        3602, 3684, 3764, 3841, 3916, 3988, 4058, 4124,
+        4188, 4250, 4308, 4364, 4417, 4468, 4515, 4560,
+        4602, 4642, 4678, 4712, 4743, 4772, 4798, 4821,
+        4842, 4860, 4875, 4888, 4899, 4907, 4912, 4916,
+        4917, 4916, 4913, 4907, 4900, 4890, 4879, 4866,
+        4851, 4834, 4816, 4796, 4775, 4752, 4728, 4702,
+        4675, 4648, 4619, 4589, 4559, 4527, 4495, 4462,
+        4429, 4395, 4361, 4327, 4292, 4257, 4222, 4188,
+        4153, 4118, 4084, 4050, 4017, 3984, 3951, 3919,
+        3888, 3857, 3828, 3799, 3771, 3744, 3718, 3693,
+        3670, 3647, 3626, 3606, 3587, 3570, 3554, 3540,
+        3527, 3515, 3505, 3496, 3489, 3484, 3480, 3478,
+        3477, 3478, 3480, 3484, 3489, 3496, 3505, 3515,
+        3527, 3540, 3554, 3570, 3587, 3606, 3626, 3647,
+        3670, 3693, 3718, 3744, 3771, 3799, 3828, 3857,
+        3888, 3919, 3951, 3984, 4017, 4050, 4084, 4118,
+        4153, 4188, 4222, 4257, 4292, 4327, 4361, 4395,
+        4429, 4462, 4495, 4527, 4559, 4589, 4619, 4648,
+        4675, 4702, 4728, 4752, 4775, 4796, 4816, 4834,
+        4851, 4866, 4879, 4890, 4900, 4907, 4913, 4916,
+        4917, 4916, 4912, 4907, 4899, 4888, 4875, 4860,
+        4842, 4821, 4798, 4772, 4743, 4712, 4678, 4642,
+        4602, 4560, 4515, 4468, 4417, 4364, 4308, 4250,
+        4188, 4124, 4058, 3988, 3916, 3841, 3764, 3684,
+        3602, 3517, 3430, 3340, 3248, 3154, 3057, 2958,
+        2858, 2755, 2650, 2543, 2435, 2324, 2212, 2098,
+        1983, 1867, 1748, 1629, 1508, 1387, 1264, 1140,
+        1016, 891, 765, 638, 511, 384, 256, 128,
+        0, -128,
+    ],
+    [
+        0, -64, -128, -192, -256, -320, -384, -447,
+        -511, -575, -638, -702, -765, -828, -892, -955,
+        -1017, -1080, -1143, -1205, -1267, -1329, -1391, -1453,
+        -1514, -1575, -1636, -1697, -1757, -1817, -1877, -1936,
+        -1996, -2055, -2113, -2172, -2230, -2287, -2345, -2402,
+        -2458, -2515, -2571, -2626, -2681, -2736, -2790, -2844,
+        -2897, -2950, -3003, -3055, -3107, -3158, -3209, -3259,
+        -3308, -3358, -3406, -3455, -3502, -3549, -3596, -3642,
+        -3688, -3733, -3777, -3821, -3864, -3907, -3949, -3990,
+        -4031, -4072, -4111, -4150, -4189, -4227, -4264, -4300,
+        -4336, -4372, -4406, -4440, -4473, -4506, -4538, -4569,
+        -4599, -4629, -4658, -4687, -4714, -4741, -4768, -4793,
+        -4818, -4842, -4866, -4888, -4910, -4932, -4952, -4972,
+        -4991, -5009, -5026, -5043, -5059, -5074, -5088, -5102,
+        -5115, -5127, -5138, -5149, -5159, -5168, -5176, -5183,
+        -5190, -5196, -5201, -5205, -5209, -5212, -5214, -5215,
+        -5215, -5215, -5214, -5212, -5209, -5205, -5201, -5196,
+        -5190, -5183, -5176, -5168, -5159, -5149, -5138, -5127,
+        -5115, -5102, -5088, -5074, -5059, -5043, -5026, -5009,
+        -4991, -4972, -4952, -4932, -4910, -4888, -4866, -4842,
+        -4818, -4793, -4768, -4741, -4714, -4687, -4658, -4629,
+        -4599, -4569, -4538, -4506, -4473, -4440, -4406, -4372,
+        -4336, -4300, -4264, -4227, -4189, -4150, -4111, -4072,
+        -4031, -3990, -3949, -3907, -3864, -3821, -3777, -3733,
+        -3688, -3642, -3596, -3549, -3502, -3455, -3406, -3358,
+        -3308, -3259, -3209, -3158, -3107, -3055, -3003, -2950,
+        -2897, -2844, -2790, -2736, -2681, -2626, -2571, -2515,
+        -2458, -2402, -2345, -2287, -2230, -2172, -2113, -2055,
+        -1996, -1936, -1877, -1817, -1757, -1697, -1636, -1575,
+        -1514, -1453, -1391, -1329, -1267, -1205, -1143, -1080,
+        -1017, -955, -892, -828, -765, -702, -638, -575,
+        -511, -447, -384, -320, -256, -192, -128, -64,
+        0, 64, 128, 192, 256, 320, 384, 447,
+        511, 575, 638, 702, 765, 828, 892, 955,
+        1017, 1080, 1143, 1205, 1267, 1329, 1391, 1453,
+        1514, 1575, 1636, 1697, 1757, 1817, 1877, 1936,
+        1996, 2055, 2113, 2172, 2230, 2287, 2345, 2402,
+        2458, 2515, 2571, 2626, 2681, 2736, 2790, 2844,
+        2897, 2950, 3003, 3055, 3107, 3158, 3209, 3259,
+        3308, 3358, 3406, 3455, 3502, 3549, 3596, 3642,
+        3688, 3733, 3777, 3821, 3864, 3907, 3949, 3990,
+        4031, 4072, 4111, 4150, 4189, 4227, 4264, 4300,
+        4336, 4372, 4406, 4440, 4473, 4506, 4538, 4569,
+        4599, 4629, 4658, 4687, 4714, 4741, 4768, 4793,
+        4818, 4842, 4866, 4888, 4910, 4932, 4952, 4972,
+        4991, 5009, 5026, 5043, 5059, 5074, 5088, 5102,
+        5115, 5127, 5138, 5149, 5159, 5168, 5176, 5183,
+        5190, 5196, 5201, 5205, 5209, 5212, 5214, 5215,
+        5215, 5215, 5214, 5212, 5209, 5205, 5201, 5196,
+        5190, 5183, 5176, 5168, 5159, 5149, 5138, 5127,
+        5115, 5102, 5088, 5074, 5059, 5043, 5026, 5009,
+        4991, 4972, 4952, 4932, 4910, 4888, 4866, 4842,
+        4818, 4793, 4768, 4741, 4714, 4687, 4658, 4629,
+        4599, 4569, 4538, 4506, 4473, 4440, 4406, 4372,
+        4336, 4300, 4264, 4227, 4189, 4150, 4111, 4072,
+        4031, 3990, 3949, 3907, 3864, 3821, 3777, 3733,
+        3688, 3642, 3596, 3549, 3502, 3455, 3406, 3358,
+        3308, 3259, 3209, 3158, 3107, 3055, 3003, 2950,
+        2897, 2844, 2790, 2736, 2681, 2626, 2571, 2515,
+        2458, 2402, 2345, 2287, 2230, 2172, 2113, 2055,
+        1996, 1936, 1877, 1817, 1757, 1697, 1636, 1575,
+        1514, 1453, 1391, 1329, 1267, 1205, 1143, 1080,
+        1017, 955, 892, 828, 765, 702, 638, 575,
+        511, 447, 384, 320, 256, 192, 128, 64,
+        0, -64,
+    ],
+    [
+        0, -64, -128, -192, -256, -320, -384, -447,
+        -511, -575, -638, -702, -765, -828, -892, -955,
+        -1017, -1080, -1143, -1205, -1267, -1329, -1391, -1453,
+        -1514, -1575, -1636, -1697, -1757, -1817, -1877, -1936,
+        -1996, -2055, -2113, -2172, -2230, -2287, -2345, -2402,
+        -2458, -2515, -2571, -2626, -2681, -2736, -2790, -2844,
+        -2897, -2950, -3003, -3055, -3107, -3158, -3209, -3259,
+        -3308, -3358, -3406, -3455, -3502, -3549, -3596, -3642,
+        -3688, -3733, -3777, -3821, -3864, -3907, -3949, -3990,
+        -4031, -4072, -4111, -4150, -4189, -4227, -4264, -4300,
+        -4336, -4372, -4406, -4440, -4473, -4506, -4538, -4569,
+        -4599, -4629, -4658, -4687, -4714, -4741, -4768, -4793,
+        -4818, -4842, -4866, -4888, -4910, -4932, -4952, -4972,
+        -4991, -5009, -5026, -5043, -5059, -5074, -5088, -5102,
+        -5115, -5127, -5138, -5149, -5159, -5168, -5176, -5183,
+        -5190, -5196, -5201, -5205, -5209, -5212, -5214, -5215,
+        -5215, -5215, -5214, -5212, -5209, -5205, -5201, -5196,
+        -5190, -5183, -5176, -5168, -5159, -5149, -5138, -5127,
+        -5115, -5102, -5088, -5074, -5059, -5043, -5026, -5009,
+        -4991, -4972, -4952, -4932, -4910, -4888, -4866, -4842,
+        -4818, -4793, -4768, -4741, -4714, -4687, -4658, -4629,
+        -4599, -4569, -4538, -4506, -4473, -4440, -4406, -4372,
+        -4336, -4300, -4264, -4227, -4189, -4150, -4111, -4072,
+        -4031, -3990, -3949, -3907, -3864, -3821, -3777, -3733,
+        -3688, -3642, -3596, -3549, -3502, -3455, -3406, -3358,
+        -3308, -3259, -3209, -3158, -3107, -3055, -3003, -2950,
+        -2897, -2844, -2790, -2736, -2681, -2626, -2571, -2515,
+        -2458, -2402, -2345, -2287, -2230, -2172, -2113, -2055,
+        -1996, -1936, -1877, -1817, -1757, -1697, -1636, -1575,
+        -1514, -1453, -1391, -1329, -1267, -1205, -1143, -1080,
+        -1017, -955, -892, -828, -765, -702, -638, -575,
+        -511, -447, -384, -320, -256, -192, -128, -64,
+        0, 64, 128, 192, 256, 320, 384, 447,
+        511, 575, 638, 702, 765, 828, 892, 955,
+        1017, 1080, 1143, 1205, 1267, 1329, 1391, 1453,
+        1514, 1575, 1636, 1697, 1757, 1817, 1877, 1936,
+        1996, 2055, 2113, 2172, 2230, 2287, 2345, 2402,
+        2458, 2515, 2571, 2626, 2681, 2736, 2790, 2844,
+        2897, 2950, 3003, 3055, 3107, 3158, 3209, 3259,
+        3308, 3358, 3406, 3455, 3502, 3549, 3596, 3642,
+        3688, 3733, 3777, 3821, 3864, 3907, 3949, 3990,
+        4031, 4072, 4111, 4150, 4189, 4227, 4264, 4300,
+        4336, 4372, 4406, 4440, 4473, 4506, 4538, 4569,
+        4599, 4629, 4658, 4687, 4714, 4741, 4768, 4793,
+        4818, 4842, 4866, 4888, 4910, 4932, 4952, 4972,
+        4991, 5009, 5026, 5043, 5059, 5074, 5088, 5102,
+        5115, 5127, 5138, 5149, 5159, 5168, 5176, 5183,
+        5190, 5196, 5201, 5205, 5209, 5212, 5214, 5215,
+        5215, 5215, 5214, 5212, 5209, 5205, 5201, 5196,
+        5190, 5183, 5176, 5168, 5159, 5149, 5138, 5127,
+        5115, 5102, 5088, 5074, 5059, 5043, 5026, 5009,
+        4991, 4972, 4952, 4932, 4910, 4888, 4866, 4842,
+        4818, 4793, 4768, 4741, 4714, 4687, 4658, 4629,
+        4599, 4569, 4538, 4506, 4473, 4440, 4406, 4372,
+        4336, 4300, 4264, 4227, 4189, 4150, 4111, 4072,
+        4031, 3990, 3949, 3907, 3864, 3821, 3777, 3733,
+        3688, 3642, 3596, 3549, 3502, 3455, 3406, 3358,
+        3308, 3259, 3209, 3158, 3107, 3055, 3003, 2950,
+        2897, 2844, 2790, 2736, 2681, 2626, 2571, 2515,
+        2458, 2402, 2345, 2287, 2230, 2172, 2113, 2055,
+        1996, 1936, 1877, 1817, 1757, 1697, 1636, 1575,
+        1514, 1453, 1391, 1329, 1267, 1205, 1143, 1080,
+        1017, 955, 892, 828, 765, 702, 638, 575,
+        511, 447, 384, 320, 256, 192, 128, 64,
+        0, -64,
+    ],
+];
+
+#[rustfmt::skip]
+pub(super) static TRI: [[i16; TABLE_LEN + 2]; NUM_MIPS] = [
+    [
+        0, -32, -64, -96, -128, -160, -192, -224,
+        -256, -288, -320, -352, -384, -416, -448, -480,
+        -512, -544, -576, -608, -640, -672, -704, -736,
+        -768, -800, -832, -864, -896, -928, -960, -992,
+        -1024, -1056, -1088, -1120, -1152, -1184, -1216, -1248,
+        -1280, -1312, -1344, -1376, -1408, -1440, -1472, -1504,
+        -1536, -1568, -1600, -1632, -1664, -1696, -1728, -1760,
+        -1792, -1824, -1856, -1888, -1920, -1952, -1984, -2016,
+        -2048, -2080, -2112, -2144, -2176, -2208, -2240, -2272,
+        -2304, -2336, -2368, -2400, -2432, -2464, -2496, -2528,
+        -2560, -2592, -2624, -2656, -2688, -2720, -2752, -2784,
+        -2816, -2848, -2880, -2912, -2944, -2976, -3008, -3040,
+        -3072, -3104, -3136, -3168, -3200, -3232, -3264, -3296,
+        -3328, -3360, -3392, -3424, -3456, -3488, -3520, -3552,
+        -3584, -3616, -3648, -3680, -3712, -3744, -3776, -3808,
+        -3840, -3872, -3904, -3936, -3968, -4000, -4032, -4065,
+        -4090, -4065, -4032, -4000, -3968, -3936, -3904, -3872,
+        -3840, -3808, -3776, -3744, -3712, -3680, -3648, -3616,
+        -3584, -3552, -3520, -3488, -3456, -3424, -3392, -3360,
+        -3328, -3296, -3264, -3232, -3200, -3168, -3136, -3104,
+        -3072, -3040, -3008, -2976, -2944, -2912, -2880, -2848,
+        -2816, -2784, -2752, -2720, -2688, -2656, -2624, -2592,
+        -2560, -2528, -2496, -2464, -2432, -2400, -2368, -2336,
+        -2304, -2272, -2240, -2208, -2176, -2144, -2112, -2080,
+        -2048, -2016, -1984, -1952, -1920, -1888, -1856, -1824,
+        -1792, -1760, -1728, -1696, -1664, -1632, -1600, -1568,
+        -1536, -1504, -1472, -1440, -1408, -1376, -1344, -1312,
+        -1280, -1248, -1216, -1184, -1152, -1120, -1088, -1056,
+        -1024, -992, -960, -928, -896, -864, -832, -800,
+        -768, -736, -704, -672, -640, -608, -576, -544,
+        -512, -480, -448, -416, -384, -352, -320, -288,
+        -256, -224, -192, -160, -128, -96, -64, -32,
+        0, 32, 64, 96, 128, 160, 192, 224,
+        256, 288, 320, 352, 384, 416, 448, 480,
+        512, 544, 576, 608, 640, 672, 704, 736,
+        768, 800, 832, 864, 896, 928, 960, 992,
+        1024, 1056, 1088, 1120, 1152, 1184, 1216, 1248,
+        1280, 1312, 1344, 1376, 1408, 1440, 1472, 1504,
+        1536, 1568, 1600, 1632, 1664, 1696, 1728, 1760,
+        1792, 1824, 1856, 1888, 1920, 1952, 1984, 2016,
+        2048, 2080, 2112, 2144, 2176, 2208, 2240, 2272,
+        2304, 2336, 2368, 2400, 2432, 2464, 2496, 2528,
+        2560, 2592, 2624, 2656, 2688, 2720, 2752, 2784,
+        2816, 2848, 2880, 2912, 2944, 2976, 3008, 3040,
+        3072, 3104, 3136, 3168, 3200, 3232, 3264, 3296,
+        3328, 3360, 3392, 3424, 3456, 3488, 3520, 3552,
+        3584, 3616, 3648, 3680, 3712, 3744, 3776, 3808,
+        3840, 3872, 3904, 3936, 3968, 4000, 4032, 4065,
+        4090, 4065, 4032, 4000, 3968, 3936, 3904, 3872,
+        3840, 3808, 3776, 3744, 3712, 3680, 3648, 3616,
+        3584, 3552, 3520, 3488, 3456, 3424, 3392, 3360,
+        3328, 3296, 3264, 3232, 3200, 3168, 3136, 3104,
+        3072, 3040, 3008, 2976, 2944, 2912, 2880, 2848,
+        2816, 2784, 2752, 2720, 2688, 2656, 2624, 2592,
+        2560, 2528, 2496, 2464, 2432, 2400, 2368, 2336,
+        2304, 2272, 2240, 2208, 2176, 2144, 2112, 2080,
+        2048, 2016, 1984, 1952, 1920, 1888, 1856, 1824,
+        1792, 1760, 1728, 1696, 1664, 1632, 1600, 1568,
+        1536, 1504, 1472, 1440, 1408, 1376, 1344, 1312,
+        1280, 1248, 1216, 1184, 1152, 1120, 1088, 1056,
+        1024, 992, 960, 928, 896, 864, 832, 800,
+        768, 736, 704, 672, 640, 608, 576, 544,
+        512, 480, 448, 416, 384, 352, 320, 288,
+        256, 224, 192, 160, 128, 96, 64, 32,
+        0, -32,
+    ],
+    [
+        0, -32, -64, -96, -128, -160, -192, -224,
+        -256, -288, -320, -352, -384, -416, -448, -480,
+        -512, -544, -576, -608, -640, -672, -704, -736,
+        -768, -800, -832, -864, -896, -928, -960, -992,
+        -1024, -1056, -1088, -1120, -1152, -1184, -1216, -1248,
+        -1280, -1312, -1344, -1376, -1408, -1440, -1472, -1504,
+        -1536, -1568, -1600, -1632, -1664, -1696, -1728, -1760,
+        -1792, -1824, -1856, -1888, -1920, -1952, -1984, -2016,
+        -2048, -2080, -2112, -2144, -2176, -2208, -2240, -2272,
+        -2304, -2336, -2368, -2400, -2432, -2464, -2496, -2528,
+        -2560, -2592, -2624, -2656, -2688, -2720, -2752, -2784,
+        -2816, -2848, -2880, -2912, -2944, -2976, -3008, -3040,
+        -3072, -3104, -3136, -3168, -3200, -3232, -3264, -3296,
+        -3328, -3360, -3392, -3424, -3456, -3488, -3520, -3552,
+        -3584, -3616, -3648, -3680, -3712, -3744, -3776, -3808,
+        -3840, -3872, -3904, -3936, -3968, -4000, -4032, -4065,
+        -4090, -4065, -4032, -4000, -3968, -3936, -3904, -3872,
+        -3840, -3808, -3776, -3744, -3712, -3680, -3648, -3616,
+        -3584, -3552, -3520, -3488, -3456, -3424, -3392, -3360,
+        -3328, -3296, -3264, -3232, -3200, -3168, -3136, -3104,
+        -3072, -3040, -3008, -2976, -2944, -2912, -2880, -2848,
+        -2816, -2784, -2752, -2720, -2688, -2656, -2624, -2592,
+        -2560, -2528, -2496, -2464, -2432, -2400, -2368, -2336,
+        -2304, -2272, -2240, -2208, -2176, -2144, -2112, -2080,
+        -2048, -2016, -1984, -1952, -1920, -1888, -1856, -1824,
+        -1792, -1760, -1728, -1696, -1664, -1632, -1600, -1568,
+        -1536, -1504, -1472, -1440, -1408, -1376, -1344, -1312,
+        -1280, -1248, -1216, -1184, -1152, -1120, -1088, -1056,
+        -1024, -992, -960, -928, -896, -864, -832, -800,
+        -768, -736, -704, -672, -640, -608, -576, -544,
+        -512, -480, -448, -416, -384, -352, -320, -288,
+        -256, -224, -192, -160, -128, -96, -64, -32,
+        0, 32, 64, 96, 128, 160, 192, 224,
+        256, 288, 320, 352, 384, 416, 448, 480,
+        512, 544, 576, 608, 640, 672, 704, 736,
+        768, 800, 832, 864, 896, 928, 960, 992,
+        1024, 1056, 1088, 1120, 1152, 1184, 1216, 1248,
+        1280, 1312, 1344, 1376, 1408, 1440, 1472, 1504,
+        1536, 1568, 1600, 1632, 1664, 1696, 1728, 1760,
+        1792, 1824, 1856, 1888, 1920, 1952, 1984, 2016,
+        2048, 2080, 2112, 2144, 2176, 2208, 2240, 2272,
+        2304, 2336, 2368, 2400, 2432, 2464, 2496, 2528,
+        2560, 2592, 2624, 2656, 2688, 2720, 2752, 2784,
+        2816, 2848, 2880, 2912, 2944, 2976, 3008, 3040,
+        3072, 3104, 3136, 3168, 3200, 3232, 3264, 3296,
+        3328, 3360, 3392, 3424, 3456, 3488, 3520, 3552,
+        3584, 3616, 3648, 3680, 3712, 3744, 3776, 3808,
+        3840, 3872, 3904, 3936, 3968, 4000, 4032, 4065,
+        4090, 4065, 4032, 4000, 3968, 3936, 3904, 3872,
+        3840, 3808, 3776, 3744, 3712, 3680, 3648, 3616,
+        3584, 3552, 3520, 3488, 3456, 3424, 3392, 3360,
+        3328, 3296, 3264, 3232, 3200, 3168, 3136, 3104,
+        3072, 3040, 3008, 2976, 2944, 2912, 2880, 2848,
+        2816, 2784, 2752, 2720, 2688, 2656, 2624, 2592,
+        2560, 2528, 2496, 2464, 2432, 2400, 2368, 2336,
+        2304, 2272, 2240, 2208, 2176, 2144, 2112, 2080,
+        2048, 2016, 1984, 1952, 1920, 1888, 1856, 1824,
+        1792, 1760, 1728, 1696, 1664, 1632, 1600, 1568,
+        1536, 1504, 1472, 1440, 1408, 1376, 1344, 1312,
+        1280, 1248, 1216, 1184, 1152, 1120, 1088, 1056,
+        1024, 992, 960, 928, 896, 864, 832, 800,
+        768, 736, 704, 672, 640, 608, 576, 544,
+        512, 480, 448, 416, 384, 352, 320, 288,
+        256, 224, 192, 160, 128, 96, 64, 32,
+        0, -32,
+    ],
+    [
+        0, -32, -64, -96, -128, -160, -192, -224,
+        -256, -288, -320, -352, -384, -416, -448, -480,
+        -512, -544, -576, -608, -640, -672, -704, -736,
+        -768, -800, -832, -864, -896, -928, -960, -992,
+        -1024, -1056, -1088, -1120, -1152, -1184, -1216, -1248,
+        -1280, -1312, -1344, -1376, -1408, -1440, -1472, -1504,
+        -1536, -1568, -1600, -1632, -1664, -1696, -1728, -1760,
+        -1792, -1824, -1856, -1888, -1920, -1952, -1984, -2016,
+        -2048, -2080, -2112, -2144, -2176, -2208, -2240, -2272,
+        -2304, -2336, -2368, -2400, -2432, -2464, -2496, -2528,
+        -2560, -2592, -2624, -2656, -2688, -2720, -2752, -2784,
+        -2816, -2848, -2880, -2912, -2944, -2976, -3008, -3040,
+        -3072, -3104, -3136, -3168, -3200, -3232, -3264, -3296,
+        -3328, -3360, -3392, -3424, -3456, -3488, -3520, -3552,
+        -3584, -3616, -3648, -3680, -3712, -3744, -3776, -3808,
+        -3840, -3872, -3904, -3936, -3968, -4000, -4032, -4065,
+        -4090, -4065, -4032, -4000, -3968, -3936, -3904, -3872,
+        -3840, -3808, -3776, -3744, -3712, -3680, -3648, -3616,
+        -3584, -3552, -3520, -3488, -3456, -3424, -3392, -3360,
+        -3328, -3296, -3264, -3232, -3200, -3168, -3136, -3104,
+        -3072, -3040, -3008, -2976, -2944, -2912, -2880, -2848,
+        -2816, -2784, -2752, -2720, -2688, -2656, -2624, -2592,
+        -2560, -2528, -2496, -2464, -2432, -2400, -2368, -2336,
+        -2304, -2272, -2240, -2208, -2176, -2144, -2112, -2080,
+        -2048, -2016, -1984, -1952, -1920, -1888, -1856, -1824,
+        -1792, -1760, -1728, -1696, -1664, -1632, -1600, -1568,
+        -1536, -1504, -1472, -1440, -1408, -1376, -1344, -1312,
+        -1280, -1248, -1216, -1184, -1152, -1120, -1088, -1056,
+        -1024, -992, -960, -928, -896, -864, -832, -800,
+        -768, -736, -704, -672, -640, -608, -576, -544,
+        -512, -480, -448, -416, -384, -352, -320, -288,
+        -256, -224, -192, -160, -128, -96, -64, -32,
+        0, 32, 64, 96, 128, 160, 192, 224,
+        256, 288, 320, 352, 384, 416, 448, 480,
+        512, 544, 576, 608, 640, 672, 704, 736,
+        768, 800, 832, 864, 896, 928, 960, 992,
+        1024, 1056, 1088, 1120, 1152, 1184, 1216, 1248,
+        1280, 1312, 1344, 1376, 1408, 1440, 1472, 1504,
+        1536, 1568, 1600, 1632, 1664, 1696, 1728, 1760,
+        1792, 1824, 1856, 1888, 1920, 1952, 1984, 2016,
+        2048, 2080, 2112, 2144, 2176, 2208, 2240, 2272,
+        2304, 2336, 2368, 2400, 2432, 2464, 2496, 2528,
+        2560, 2592, 2624, 2656, 2688, 2720, 2752, 2784,
+        2816, 2848, 2880, 2912, 2944, 2976, 3008, 3040,
+        3072, 3104, 3136, 3168, 3200, 3232, 3264, 3296,
+        3328, 3360, 3392, 3424, 3456, 3488, 3520, 3552,
+        3584, 3616, 3648, 3680, 3712, 3744, 3776, 3808,
+        3840, 3872, 3904, 3936, 3968, 4000, 4032, 4065,
+        4090, 4065, 4032, 4000, 3968, 3936, 3904, 3872,
+        3840, 3808, 3776, 3744, 3712, 3680, 3648, 3616,
+        3584, 3552, 3520, 3488, 3456, 3424, 3392, 3360,
+        3328, 3296, 3264, 3232, 3200, 3168, 3136, 3104,
+        3072, 3040, 3008, 2976, 2944, 2912, 2880, 2848,
+        2816, 2784, 2752, 2720, 2688, 2656, 2624, 2592,
+        2560, 2528, 2496, 2464, 2432, 2400, 2368, 2336,
+        2304, 2272, 2240, 2208, 2176, 2144, 2112, 2080,
+        2048, 2016, 1984, 1952, 1920, 1888, 1856, 1824,
+        1792, 1760, 1728, 1696, 1664, 1632, 1600, 1568,
+        1536, 1504, 1472, 1440, 1408, 1376, 1344, 1312,
+        1280, 1248, 1216, 1184, 1152, 1120, 1088, 1056,
+        1024, 992, 960, 928, 896, 864, 832, 800,
+        768, 736, 704, 672, 640, 608, 576, 544,
+        512, 480, 448, 416, 384, 352, 320, 288,
+        256, 224, 192, 160, 128, 96, 64, 32,
+        0, -32,
+    ],
+    [
+        0, -32, -64, -96, -128, -160, -192, -224,
+        -256, -288, -320, -352, -384, -416, -448, -480,
+        -512, -544, -576, -608, -640, -672, -704, -736,
+        -768, -800, -832, -864, -896, -928, -960, -992,
+        -1024, -1056, -1088, -1120, -1152, -1184, -1216, -1248,
+        -1280, -1312, -1344, -1376, -1408, -1440, -1472, -1504,
+        -1536, -1568, -1600, -1632, -1664, -1696, -1728, -1760,
+        -1792, -1824, -1856, -1888, -1920, -1952, -1984, -2016,
+        -2048, -2080, -2112, -2144, -2176, -2208, -2240, -2272,
+        -2304, -2336, -2368, -2400, -2432, -2464, -2496, -2528,
+        -2560, -2592, -2624, -2656, -2688, -2720, -2752, -2784,
+        -2816, -2848, -2880, -2912, -2944, -2976, -3008, -3040,
+        -3072, -3104, -3136, -3168, -3200, -3232, -3264, -3296,
+        -3328, -3360, -3392, -3424, -3456, -3488, -3520, -3552,
+        -3584, -3616, -3648, -3680, -3712, -3745, -3776, -3807,
+        -3841, -3872, -3903, -3936, -3969, -3999, -4032, -4068,
+        -4085, -4068, -4032, -3999, -3969, -3936, -3903, -3872,
+        -3841, -3807, -3776, -3745, -3712, -3680, -3648, -3616,
+        -3584, -3552, -3520, -3488, -3456, -3424, -3392, -3360,
+        -3328, -3296, -3264, -3232, -3200, -3168, -3136, -3104,
+        -3072, -3040, -3008, -2976, -2944, -2912, -2880, -2848,
+        -2816, -2784, -2752, -2720, -2688, -2656, -2624, -2592,
+        -2560, -2528, -2496, -2464, -2432, -2400, -2368, -2336,
+        -2304, -2272, -2240, -2208, -2176, -2144, -2112, -2080,
+        -2048, -2016, -1984, -1952, -1920, -1888, -1856, -1824,
+        -1792, -1760, -1728, -1696, -1664, -1632, -1600, -1568,
+        -1536, -1504, -1472, -1440, -1408, -1376, -1344, -1312,
+        -1280, -1248, -1216, -1184, -1152, -1120, -1088, -1056,
+        -1024, -992, -960, -928, -896, -864, -832, -800,
+        -768, -736, -704, -672, -640, -608, -576, -544,
+        -512, -480, -448, -416, -384, -352, -320, -288,
+        -256, -224, -192, -160, -128, -96, -64, -32,
+        0, 32, 64, 96, 128, 160, 192, 224,
+        256, 288, 320, 352, 384, 416, 448, 480,
+        512, 544, 576, 608, 640, 672, 704, 736,
+        768, 800, 832, 864, 896, 928, 960, 992,
+        1024, 1056, 1088, 1120, 1152, 1184, 1216, 1248,
+        1280, 1312, 1344, 1376, 1408, 1440, 1472, 1504,
+        1536, 1568, 1600, 1632, 1664, 1696, 1728, 1760,
+        1792, 1824, 1856, 1888, 1920, 1952, 1984, 2016,
+        2048, 2080, 2112, 2144, 2176, 2208, 2240, 2272,
+        2304, 2336, 2368, 2400, 2432, 2464, 2496, 2528,
+        2560, 2592, 2624, 2656, 2688, 2720, 2752, 2784,
+        2816, 2848, 2880, 2912, 2944, 2976, 3008, 3040,
+        3072, 3104, 3136, 3168, 3200, 3232, 3264, 3296,
+        3328, 3360, 3392, 3424, 3456, 3488, 3520, 3552,
+        3584, 3616, 3648, 3680, 3712, 3745, 3776, 3807,
+        3841, 3872, 3903, 3936, 3969, 3999, 4032, 4068,
+        4085, 4068, 4032, 3999, 3969, 3936, 3903, 3872,
+        3841, 3807, 3776, 3745, 3712, 3680, 3648, 3616,
+        3584, 3552, 3520, 3488, 3456, 3424, 3392, 3360,
+        3328, 3296, 3264, 3232, 3200, 3168, 3136, 3104,
+        3072, 3040, 3008, 2976, 2944, 2912, 2880, 2848,
+        2816, 2784, 2752, 2720, 2688, 2656, 2624, 2592,
+        2560, 2528, 2496, 2464, 2432, 2400, 2368, 2336,
+        2304, 2272, 2240, 2208, 2176, 2144, 2112, 2080,
+        2048, 2016, 1984, 1952, 1920, 1888, 1856, 1824,
+        1792, 1760, 1728, 1696, 1664, 1632, 1600, 1568,
+        1536, 1504, 1472, 1440, 1408, 1376, 1344, 1312,
+        1280, 1248, 1216, 1184, 1152, 1120, 1088, 1056,
+        1024, 992, 960, 928, 896, 864, 832, 800,
+        768, 736, 704, 672, 640, 608, 576, 544,
+        512, 480, 448, 416, 384, 352, 320, 288,
+        256, 224, 192, 160, 128, 96, 64, 32,
+        0, -32,
+    ],
+    [
+        0, -32, -64, -96, -128, -160, -192, -224,
+        -256, -288, -320, -352, -384, -416, -448, -480,
+        -512, -544, -576, -608, -640, -672, -704, -736,
+        -768, -800, -832, -864, -896, -928, -960, -992,
+        -1024, -1056, -1088, -1120, -1152, -1184, -1216, -1248,
+        -1280, -1312, -1344, -1376, -1408, -1440, -1472, -1504,
+        -1536, -1568, -1600, -1632, -1664, -1696, -1728, -1760,
+        -1792, -1824, -1856, -1888, -1920, -1952, -1984, -2016,
+        -2048, -2080, -2112, -2144, -2176, -2208, -2240, -2272,
+        -2304, -2336, -2368, -2400, -2432, -2464, -2496, -2529,
+        -2560, -2592, -2624, -2656, -2688, -2720, -2753, -2784,
+        -2816, -2847, -2880, -2912, -2945, -2977, -3008, -3040,
+        -3071, -3104, -3136, -3169, -3201, -3232, -3263, -3295,
+        -3328, -3361, -3393, -3425, -3456, -3487, -3519, -3552,
+        -3585, -3617, -3649, -3679, -3710, -3743, -3777, -3810,
+        -3842, -3872, -3901, -3932, -3967, -4005, -4040, -4065,
+        -4074, -4065, -4040, -4005, -3967, -3932, -3901, -3872,
+        -3842, -3810, -3777, -3743, -3710, -3679, -3649, -3617,
+        -3585, -3552, -3519, -3487, -3456, -3425, -3393, -3361,
+        -3328, -3295, -3263, -3232, -3201, -3169, -3136, -3104,
+        -3071, -3040, -3008, -2977, -2945, -2912, -2880, -2847,
+        -2816, -2784, -2753, -2720, -2688, -2656, -2624, -2592,
+        -2560, -2529, -2496, -2464, -2432, -2400, -2368, -2336,
+        -2304, -2272, -2240, -2208, -2176, -2144, -2112, -2080,
+        -2048, -2016, -1984, -1952, -1920, -1888, -1856, -1824,
+        -1792, -1760, -1728, -1696, -1664, -1632, -1600, -1568,
+        -1536, -1504, -1472, -1440, -1408, -1376, -1344, -1312,
+        -1280, -1248, -1216, -1184, -1152, -1120, -1088, -1056,
+        -1024, -992, -960, -928, -896, -864, -832, -800,
+        -768, -736, -704, -672, -640, -608, -576, -544,
+        -512, -480, -448, -416, -384, -352, -320, -288,
+        -256, -224, -192, -160, -128, -96, -64, -32,
+        0, 32, 64, 96, 128, 160, 192, 224,
+        256, 288, 320, 352, 384, 416, 448, 480,
+        512, 544, 576, 608, 640, 672, 704, 736,
+        768, 800, 832, 864, 896, 928, 960, 992,
+        1024, 1056, 1088, 1120, 1152, 1184, 1216, 1248,
+        1280, 1312, 1344, 1376, 1408, 1440, 1472, 1504,
+        1536, 1568, 1600, 1632, 1664, 1696, 1728, 1760,
+        1792, 1824, 1856, 1888, 1920, 1952, 1984, 2016,
+        2048, 2080, 2112, 2144, 2176, 2208, 2240, 2272,
+        2304, 2336, 2368, 2400, 2432, 2464, 2496, 2529,
+        2560, 2592, 2624, 2656, 2688, 2720, 2753, 2784,
+        2816, 2847, 2880, 2912, 2945, 2977, 3008, 3040,
+        3071, 3104, 3136, 3169, 3201, 3232, 3263, 3295,
+        3328, 3361, 3393, 3425, 3456, 3487, 3519, 3552,
+        3585, 3617, 3649, 3679, 3710, 3743, 3777, 3810,
+        3842, 3872, 3901, 3932, 3967, 4005, 4040, 4065,
+        4074, 4065, 4040, 4005, 3967, 3932, 3901, 3872,
+        3842, 3810, 3777, 3743, 3710, 3679, 3649, 3617,
+        3585, 3552, 3519, 3487, 3456, 3425, 3393, 3361,
+        3328, 3295, 3263, 3232, 3201, 3169, 3136, 3104,
+        3071, 3040, 3008, 2977, 2945, 2912, 2880, 2847,
+        2816, 2784, 2753, 2720, 2688, 2656, 2624, 2592,
+        2560, 2529, 2496, 2464, 2432, 2400, 2368, 2336,
+        2304, 2272, 2240, 2208, 2176, 2144, 2112, 2080,
+        2048, 2016, 1984, 1952, 1920, 1888, 1856, 1824,
+        1792, 1760, 1728, 1696, 1664, 1632, 1600, 1568,
+        1536, 1504, 1472, 1440, 1408, 1376, 1344, 1312,
+        1280, 1248, 1216, 1184, 1152, 1120, 1088, 1056,
+        1024, 992, 960, 928, 896, 864, 832, 800,
+        768, 736, 704, 672, 640, 608, 576, 544,
+        512, 480, 448, 416, 384, 352, 320, 288,
+        256, 224, 192, 160, 128, 96, 64, 32,
+        0, -32,
+    ],
+    [
+        0, -33, -65, -97, -129, -161, -192, -224,
+        -255, -287, -319, -351, -383, -416, -448, -481,
+        -513, -545, -577, -609, -640, -672, -703, -735,
+        -767, -799, -832, -864, -897, -929, -961, -993,
+        -1025, -1056, -1088, -1119, -1151, -1183, -1215, -1247,
+        -1280, -1312, -1345, -1377, -1409, -1441, -1473, -1504,
+        -1535, -1567, -1599, -1631, -1663, -1695, -1728, -1761,
+        -1793, -1825, -1857, -1889, -1920, -1952, -1983, -2015,
+        -2046, -2079, -2111, -2144, -2177, -2209, -2242, -2274,
+        -2305, -2337, -2368, -2399, -2430, -2462, -2494, -2527,
+        -2559, -2592, -2625, -2658, -2690, -2722, -2753, -2784,
+        -2815, -2846, -2878, -2909, -2942, -2975, -3008, -3041,
+        -3074, -3107, -3139, -3170, -3201, -3232, -3262, -3293,
+        -3324, -3356, -3389, -3423, -3457, -3491, -3525, -3557,
+        -3588, -3619, -3648, -3677, -3706, -3736, -3768, -3802,
+        -3838, -3876, -3913, -3950, -3983, -4012, -4034, -4048,
+        -4052, -4048, -4034, -4012, -3983, -3950, -3913, -3876,
+        -3838, -3802, -3768, -3736, -3706, -3677, -3648, -3619,
+        -3588, -3557, -3525, -3491, -3457, -3423, -3389, -3356,
+        -3324, -3293, -3262, -3232, -3201, -3170, -3139, -3107,
+        -3074, -3041, -3008, -2975, -2942, -2909, -2878, -2846,
+        -2815, -2784, -2753, -2722, -2690, -2658, -2625, -2592,
+        -2559, -2527, -2494, -2462, -2430, -2399, -2368, -2337,
+        -2305, -2274, -2242, -2209, -2177, -2144, -2111, -2079,
+        -2046, -2015, -1983, -1952, -1920, -1889, -1857, -1825,
+        -1793, -1761, -1728, -1695, -1663, -1631, -1599, -1567,
+        -1535, -1504, -1473, -1441, -1409, -1377, -1345, -1312,
+        -1280, -1247, -1215, -1183, -1151, -1119, -1088, -1056,
+        -1025, -993, -961, -929, -897, -864, -832, -799,
+        -767, -735, -703, -672, -640, -609, -577, -545,
+        -513, -481, -448, -416, -383, -351, -319, -287,
+        -255, -224, -192, -161, -129, -97, -65, -33,
+        0, 33, 65, 97, 129, 161, 192, 224,
+        255, 287, 319, 351, 383, 416, 448, 481,
+        513, 545, 577, 609, 640, 672, 703, 735,
+        767, 799, 832, 864, 897, 929, 961, 993,
+        1025, 1056, 1088, 1119, 1151, 1183, 1215, 1247,
+        1280, 1312, 1345, 1377, 1409, 1441, 1473, 1504,
+        1535, 1567, 1599, 1631, 1663, 1695, 1728, 1761,
+        1793, 1825, 1857, 1889, 1920, 1952, 1983, 2015,
+        2046, 2079, 2111, 2144, 2177, 2209, 2242, 2274,
+        2305, 2337, 2368, 2399, 2430, 2462, 2494, 2527,
+        2559, 2592, 2625, 2658, 2690, 2722, 2753, 2784,
+        2815, 2846, 2878, 2909, 2942, 2975, 3008, 3041,
+        3074, 3107, 3139, 3170, 3201, 3232, 3262, 3293,
+        3324, 3356, 3389, 3423, 3457, 3491, 3525, 3557,
+        3588, 3619, 3648, 3677, 3706, 3736, 3768, 3802,
+        3838, 3876, 3913, 3950, 3983, 4012, 4034, 4048,
+        4052, 4048, 4034, 4012, 3983, 3950, 3913, 3876,
+        3838, 3802, 3768, 3736, 3706, 3677, 3648, 3619,
+        3588, 3557, 3525, 3491, 3457, 3423, 3389, 3356,
+        3324, 3293, 3262, 3232, 3201, 3170, 3139, 3107,
+        3074, 3041, 3008, 2975, 2942, 2909, 2878, 2846,
+        2815, 2784, 2753, 2722, 2690, 2658, 2625, 2592,
+        2559, 2527, 2494, 2462, 2430, 2399, 2368, 2337,
+        2305, 2274, 2242, 2209, 2177, 2144, 2111, 2079,
+        2046, 2015, 1983, 1952, 1920, 1889, 1857, 1825,
+        1793, 1761, 1728, 1695, 1663, 1631, 1599, 1567,
+        1535, 1504, 1473, 1441, 1409, 1377, 1345, 1312,
+        1280, 1247, 1215, 1183, 1151, 1119, 1088, 1056,
+        1025, 993, 961, 929, 897, 864, 832, 799,
+        767, 735, 703, 672, 640, 609, 577, 545,
+        513, 481, 448, 416, 383, 351, 319, 287,
+        255, 224, 192, 161, 129, 97, 65, 33,
+        0, -33,
+    ],
+    [
+        0, -31, -62, -93, -125, -156, -188, -220,
+        -252, -285, -317, -350, -383, -416, -449, -482,
+        -515, -548, -580, -612, -644, -676, -707, -738,
+        -770, -801, -831, -862, -893, -925, -956, -988,
+        -1020, -1052, -1084, -1117, -1150, -1183, -1216, -1249,
+        -1282, -1315, -1348, -1380, -1413, -1445, -1477, -1508,
+        -1539, -1570, -1601, -1632, -1663, -1693, -1724, -1756,
+        -1787, -1819, -1851, -1883, -1916, -1949, -1982, -2015,
+        -2049, -2082, -2115, -2148, -2181, -2214, -2246, -2278,
+        -2310, -2341, -2372, -2402, -2432, -2463, -2493, -2524,
+        -2554, -2585, -2617, -2648, -2681, -2713, -2747, -2780,
+        -2814, -2848, -2882, -2917, -2951, -2984, -3017, -3050,
+        -3082, -3113, -3144, -3174, -3204, -3233, -3262, -3291,
+        -3320, -3349, -3379, -3409, -3441, -3473, -3507, -3541,
+        -3577, -3614, -3651, -3688, -3726, -3764, -3800, -3835,
+        -3869, -3900, -3928, -3953, -3974, -3991, -4003, -4011,
+        -4013, -4011, -4003, -3991, -3974, -3953, -3928, -3900,
+        -3869, -3835, -3800, -3764, -3726, -3688, -3651, -3614,
+        -3577, -3541, -3507, -3473, -3441, -3409, -3379, -3349,
+        -3320, -3291, -3262, -3233, -3204, -3174, -3144, -3113,
+        -3082, -3050, -3017, -2984, -2951, -2917, -2882, -2848,
+        -2814, -2780, -2747, -2713, -2681, -2648, -2617, -2585,
+        -2554, -2524, -2493, -2463, -2432, -2402, -2372, -2341,
+        -2310, -2278, -2246, -2214, -2181, -2148, -2115, -2082,
+        -2049, -2015, -1982, -1949, -1916, -1883, -1851, -1819,
+        -1787, -1756, -1724, -1693, -1663, -1632, -1601, -1570,
+        -1539, -1508, -1477, -1445, -1413, -1380, -1348, -1315,
+        -1282, -1249, -1216, -1183, -1150, -1117, -1084, -1052,
+        -1020, -988, -956, -925, -893, -862, -831, -801,
+        -770, -738, -707, -676, -644, -612, -580, -548,
+        -515, -482, -449, -416, -383, -350, -317, -285,
+        -252, -220, -188, -156, -125, -93, -62, -31,
+        0, 31, 62, 93, 125, 156, 188, 220,
+        252, 285, 317, 350, 383, 416, 449, 482,
+        515, 548, 580, 612, 644, 676, 707, 738,
+        770, 801, 831, 862, 893, 925, 956, 988,
+        1020, 1052, 1084, 1117, 1150, 1183, 1216, 1249,
+        1282, 1315, 1348, 1380, 1413, 1445, 1477, 1508,
+        1539, 1570, 1601, 1632, 1663, 1693, 1724, 1756,
+        1787, 1819, 1851, 1883, 1916, 1949, 1982, 2015,
+        2049, 2082, 2115, 2148, 2181, 2214, 2246, 2278,
+        2310, 2341, 2372, 2402, 2432, 2463, 2493, 2524,
+        2554, 2585, 2617, 2648, 2681, 2713, 2747, 2780,
+        2814, 2848, 2882, 2917, 2951, 2984, 3017, 3050,
+        3082, 3113, 3144, 3174, 3204, 3233, 3262, 3291,
+        3320, 3349, 3379, 3409, 3441, 3473, 3507, 3541,
+        3577, 3614, 3651, 3688, 3726, 3764, 3800, 3835,
+        3869, 3900, 3928, 3953, 3974, 3991, 4003, 4011,
+        4013, 4011, 4003, 3991, 3974, 3953, 3928, 3900,
+        3869, 3835, 3800, 3764, 3726, 3688, 3651, 3614,
+        3577, 3541, 3507, 3473, 3441, 3409, 3379, 3349,
+        3320, 3291, 3262, 3233, 3204, 3174, 3144, 3113,
+        3082, 3050, 3017, 2984, 2951, 2917, 2882, 2848,
+        2814, 2780, 2747, 2713, 2681, 2648, 2617, 2585,
+        2554, 2524, 2493, 2463, 2432, 2402, 2372, 2341,
+        2310, 2278, 2246, 2214, 2181, 2148, 2115, 2082,
+        2049, 2015, 1982, 1949, 1916, 1883, 1851, 1819,
+        1787, 1756, 1724, 1693, 1663, 1632, 1601, 1570,
+        1539, 1508, 1477, 1445, 1413, 1380, 1348, 1315,
+        1282, 1249, 1216, 1183, 1150, 1117, 1084, 1052,
+        1020, 988, 956, 925, 893, 862, 831, 801,
+        770, 738, 707, 676, 644, 612, 580, 548,
+        515, 482, 449, 416, 383, 350, 317, 285,
+        252, 220, 188, 156, 125, 93, 62, 31,
+        0, -31,
+    ],
+    [
+        0, -34, -68, -102, -136, -169, -203, -236,
+        -270, -303, -335, -368, -400, -432, -464, -496,
+        -527, -558, -589, -619, -650, -680, -710, -740,
+        -770, -800, -830, -860, -890, -920, -950, -980,
+        -1011, -1041, -1072, -1103, -1135, -1166, -1198, -1230,
+        -1263, -1295, -1328, -1362, -1395, -1429, -1463, -1497,
+        -1531, -1565, -1600, -1634, -1669, -1703, -1737, -1772,
+        -1806, -1840, -1873, -1907, -1940, -1973, -2006, -2038,
+        -2070, -2101, -2133, -2163, -2194, -2224, -2254, -2284,
+        -2313, -2342, -2371, -2400, -2428, -2457, -2486, -2515,
+        -2543, -2573, -2602, -2631, -2661, -2691, -2722, -2753,
+        -2785, -2817, -2850, -2883, -2917, -2951, -2986, -3021,
+        -3057, -3094, -3130, -3168, -3205, -3243, -3280, -3318,
+        -3356, -3394, -3431, -3468, -3504, -3540, -3575, -3609,
+        -3642, -3674, -3704, -3733, -3761, -3787, -3811, -3833,
+        -3853, -3871, -3886, -3900, -3911, -3919, -3926, -3929,
+        -3931, -3929, -3926, -3919, -3911, -3900, -3886, -3871,
+        -3853, -3833, -3811, -3787, -3761, -3733, -3704, -3674,
+        -3642, -3609, -3575, -3540, -3504, -3468, -3431, -3394,
+        -3356, -3318, -3280, -3243, -3205, -3168, -3130, -3094,
+        -3057, -3021, -2986, -2951, -2917, -2883, -2850, -2817,
+        -2785, -2753, -2722, -2691, -2661, -2631, -2602, -2573,
+        -2543, -2515, -2486, -2457, -2428, -2400, -2371, -2342,
+        -2313, -2284, -2254, -2224, -2194, -2163, -2133, -2101,
+        -2070, -2038, -2006, -1973, -1940, -1907, -1873, -1840,
+        -1806, -1772, -1737, -1703, -1669, -1634, -1600, -1565,
+        -1531, -1497, -1463, -1429, -1395, -1362, -1328, -1295,
+        -1263, -1230, -1198, -1166, -1135, -1103, -1072, -1041,
+        -1011, -980, -950, -920, -890, -860, -830, -800,
+        -770, -740, -710, -680, -650, -619, -589, -558,
+        -527, -496, -464, -432, -400, -368, -335, -303,
+        -270, -236, -203, -169, -136, -102, -68, -34,
+        0, 34, 68, 102, 136, 169, 203, 236,
+        270, 303, 335, 368, 400, 432, 464, 496,
+        527, 558, 589, 619, 650, 680, 710, 740,
+        770, 800, 830, 860, 890, 920, 950, 980,
+        1011, 1041, 1072, 1103, 1135, 1166, 1198, 1230,
+        1263, 1295, 1328, 1362, 1395, 1429, 1463, 1497,
+        1531, 1565, 1600, 1634, 1669, 1703, 1737, 1772,
+        1806, 1840, 1873, 1907, 1940, 1973, 2006, 2038,
+        2070, 2101, 2133, 2163, 2194, 2224, 2254, 2284,
+        2313, 2342, 2371, 2400, 2428, 2457, 2486, 2515,
+        2543, 2573, 2602, 2631, 2661, 2691, 2722, 2753,
+        2785, 2817, 2850, 2883, 2917, 2951, 2986, 3021,
+        3057, 3094, 3130, 3168, 3205, 3243, 3280, 3318,
+        3356, 3394, 3431, 3468, 3504, 3540, 3575, 3609,
+        3642, 3674, 3704, 3733, 3761, 3787, 3811, 3833,
+        3853, 3871, 3886, 3900, 3911, 3919, 3926, 3929,
+        3931, 3929, 3926, 3919, 3911, 3900, 3886, 3871,
+        3853, 3833, 3811, 3787, 3761, 3733, 3704, 3674,
+        3642, 3609, 3575, 3540, 3504, 3468, 3431, 3394,
+        3356, 3318, 3280, 3243, 3205, 3168, 3130, 3094,
+        3057, 3021, 2986, 2951, 2917, 2883, 2850, 2817,
+        2785, 2753, 2722, 2691, 2661, 2631, 2602, 2573,
+        2543, 2515, 2486, 2457, 2428, 2400, 2371, 2342,
+        2313, 2284, 2254, 2224, 2194, 2163, 2133, 2101,
+        2070, 2038, 2006, 1973, 1940, 1907, 1873, 1840,
+        1806, 1772, 1737, 1703, 1669, 1634, 1600, 1565,
+        1531, 1497, 1463, 1429, 1395, 1362, 1328, 1295,
+        1263, 1230, 1198, 1166, 1135, 1103, 1072, 1041,
+        1011, 980, 950, 920, 890, 860, 830, 800,
+        770, 740, 710, 680, 650, 619, 589, 558,
+        527, 496, 464, 432, 400, 368, 335, 303,
+        270, 236, 203, 169, 136, 102, 68, 34,
+        0, -34,
+    ],
+    [
+        0, -27, -54, -82, -109, -136, -163, -191,
+        -218, -246, -274, -301, -329, -358, -386, -414,
+        -443, -472, -500, -530, -559, -589, -618, -648,
+        -679, -709, -740, -771, -802, -834, -865, -897,
+        -930, -962, -995, -1028, -1062, -1095, -1129, -1163,
+        -1198, -1233, -1268, -1303, -1338, -1374, -1410, -1446,
+        -1483, -1519, -1556, -1593, -1630, -1668, -1705, -1743,
+        -1781, -1819, -1857, -1895, -1933, -1972, -2010, -2048,
+        -2087, -2125, -2164, -2202, -2240, -2279, -2317, -2355,
+        -2393, -2430, -2468, -2505, -2542, -2579, -2616, -2652,
+        -2689, -2724, -2760, -2795, -2830, -2864, -2898, -2931,
+        -2964, -2997, -3029, -3060, -3091, -3121, -3151, -3180,
+        -3209, -3236, -3263, -3290, -3316, -3341, -3365, -3388,
+        -3411, -3433, -3454, -3474, -3494, -3513, -3530, -3547,
+        -3563, -3578, -3592, -3605, -3618, -3629, -3639, -3649,
+        -3657, -3665, -3671, -3677, -3681, -3684, -3687, -3688,
+        -3689, -3688, -3687, -3684, -3681, -3677, -3671, -3665,
+        -3657, -3649, -3639, -3629, -3618, -3605, -3592, -3578,
+        -3563, -3547, -3530, -3513, -3494, -3474, -3454, -3433,
+        -3411, -3388, -3365, -3341, -3316, -3290, -3263, -3236,
+        -3209, -3180, -3151, -3121, -3091, -3060, -3029, -2997,
+        -2964, -2931, -2898, -2864, -2830, -2795, -2760, -2724,
+        -2689, -2652, -2616, -2579, -2542, -2505, -2468, -2430,
+        -2393, -2355, -2317, -2279, -2240, -2202, -2164, -2125,
+        -2087, -2048, -2010, -1972, -1933, -1895, -1857, -1819,
+        -1781, -1743, -1705, -1668, -1630, -1593, -1556, -1519,
+        -1483, -1446, -1410, -1374, -1338, -1303, -1268, -1233,
+        -1198, -1163, -1129, -1095, -1062, -1028, -995, -962,
+        -930, -897, -865, -834, -802, -771, -740, -709,
+        -679, -648, -618, -589, -559, -530, -500, -472,
+        -443, -414, -386, -358, -329, -301, -274, -246,
+        -218, -191, -163, -136, -109, -82, -54, -27,
+        0, 27, 54, 82, 109, 136, 163, 191,
+        218, 246, 274, 301, 329, 358, 386, 414,
+        443, 472, 500, 530, 559, 589, 618, 648,
+        679, 709, 740, 771, 802, 834, 865, 897,
+        930, 962, 995, 1028, 1062, 1095, 1129, 1163,
+        1198, 1233, 1268, 1303, 1338, 1374, 1410, 1446,
+        1483, 1519, 1556, 1593, 1630, 1668, 1705, 1743,
+        1781, 1819, 1857, 1895, 1933, 1972, 2010, 2048,
+        2087, 2125, 2164, 2202, 2240, 2279, 2317, 2355,
+        2393, 2430, 2468, 2505, 2542, 2579, 2616, 2652,
+        2689, 2724, 2760, 2795, 2830, 2864, 2898, 2931,
+        2964, 2997, 3029, 3060, 3091, 3121, 3151, 3180,
+        3209, 3236, 3263, 3290, 3316, 3341, 3365, 3388,
+        3411, 3433, 3454, 3474, 3494, 3513, 3530, 3547,
+        3563, 3578, 3592, 3605, 3618, 3629, 3639, 3649,
+        3657, 3665, 3671, 3677, 3681, 3684, 3687, 3688,
+        3689, 3688, 3687, 3684, 3681, 3677, 3671, 3665,
+        3657, 3649, 3639, 3629, 3618, 3605, 3592, 3578,
+        3563, 3547, 3530, 3513, 3494, 3474, 3454, 3433,
+        3411, 3388, 3365, 3341, 3316, 3290, 3263, 3236,
+        3209, 3180, 3151, 3121, 3091, 3060, 3029, 2997,
+        2964, 2931, 2898, 2864, 2830, 2795, 2760, 2724,
+        2689, 2652, 2616, 2579, 2542, 2505, 2468, 2430,
+        2393, 2355, 2317, 2279, 2240, 2202, 2164, 2125,
+        2087, 2048, 2010, 1972, 1933, 1895, 1857, 1819,
+        1781, 1743, 1705, 1668, 1630, 1593, 1556, 1519,
+        1483, 1446, 1410, 1374, 1338, 1303, 1268, 1233,
+        1198, 1163, 1129, 1095, 1062, 1028, 995, 962,
+        930, 897, 865, 834, 802, 771, 740, 709,
+        679, 648, 618, 589, 559, 530, 500, 472,
+        443, 414, 386, 358, 329, 301, 274, 246,
+        218, 191, 163, 136, 109, 82, 54, 27,
+        0, -27,
+    ],
+    [
+        0, -41, -81, -122, -163, -204, -244, -285,
+        -325, -366, -406, -447, -487, -527, -568, -608,
+        -648, -688, -727, -767, -807, -846, -886, -925,
+        -964, -1003, -1041, -1080, -1119, -1157, -1195, -1233,
+        -1271, -1308, -1345, -1383, -1420, -1456, -1493, -1529,
+        -1565, -1601, -1636, -1672, -1707, -1742, -1776, -1811,
+        -1845, -1878, -1912, -1945, -1978, -2010, -2043, -2075,
+        -2106, -2138, -2169, -2199, -2230, -2260, -2289, -2319,
+        -2348, -2376, -2405, -2432, -2460, -2487, -2514, -2540,
+        -2566, -2592, -2617, -2642, -2667, -2691, -2714, -2738,
+        -2761, -2783, -2805, -2827, -2848, -2868, -2889, -2909,
+        -2928, -2947, -2966, -2984, -3001, -3019, -3035, -3052,
+        -3067, -3083, -3098, -3112, -3126, -3140, -3153, -3165,
+        -3177, -3189, -3200, -3210, -3221, -3230, -3239, -3248,
+        -3256, -3264, -3271, -3278, -3284, -3290, -3295, -3300,
+        -3304, -3308, -3311, -3314, -3316, -3318, -3319, -3320,
+        -3320, -3320, -3319, -3318, -3316, -3314, -3311, -3308,
+        -3304, -3300, -3295, -3290, -3284, -3278, -3271, -3264,
+        -3256, -3248, -3239, -3230, -3221, -3210, -3200, -3189,
+        -3177, -3165, -3153, -3140, -3126, -3112, -3098, -3083,
+        -3067, -3052, -3035, -3019, -3001, -2984, -2966, -2947,
+        -2928, -2909, -2889, -2868, -2848, -2827, -2805, -2783,
+        -2761, -2738, -2714, -2691, -2667, -2642, -2617, -2592,
+        -2566, -2540, -2514, -2487, -2460, -2432, -2405, -2376,
+        -2348, -2319, -2289, -2260, -2230, -2199, -2169, -2138,
+        -2106, -2075, -2043, -2010, -1978, -1945, -1912, -1878,
+        -1845, -1811, -1776, -1742, -1707, -1672, -1636, -1601,
+        -1565, -1529, -1493, -1456, -1420, -1383, -1345, -1308,
+        -1271, -1233, -1195, -1157, -1119, -1080, -1041, -1003,
+        -964, -925, -886, -846, -807, -767, -727, -688,
+        -648, -608, -568, -527, -487, -447, -406, -366,
+        -325, -285, -244, -204, -163, -122, -81, -41,
+        0, 41, 81, 122, 163, 204, 244, 285,
+        325, 366, 406, 447, 487, 527, 568, 608,
+        648, 688, 727, 767, 807, 846, 886, 925,
+        964, 1003, 1041, 1080, 1119, 1157, 1195, 1233,
+        1271, 1308, 1345, 1383, 1420, 1456, 1493, 1529,
+        1565, 1601, 1636, 1672, 1707, 1742, 1776, 1811,
+        1845, 1878, 1912, 1945, 1978, 2010, 2043, 2075,
+        2106, 2138, 2169, 2199, 2230, 2260, 2289, 2319,
+        2348, 2376, 2405, 2432, 2460, 2487, 2514, 2540,
+        2566, 2592, 2617, 2642, 2667, 2691, 2714, 2738,
+        2761, 2783, 2805, 2827, 2848, 2868, 2889, 2909,
+        2928, 2947, 2966, 2984, 3001, 3019, 3035, 3052,
+        3067, 3083, 3098, 3112, 3126, 3140, 3153, 3165,
+        3177, 3189, 3200, 3210, 3221, 3230, 3239, 3248,
+        3256, 3264, 3271, 3278, 3284, 3290, 3295, 3300,
+        3304, 3308, 3311, 3314, 3316, 3318, 3319, 3320,
+        3320, 3320, 3319, 3318, 3316, 3314, 3311, 3308,
+        3304, 3300, 3295, 3290, 3284, 3278, 3271, 3264,
+        3256, 3248, 3239, 3230, 3221, 3210, 3200, 3189,
+        3177, 3165, 3153, 3140, 3126, 3112, 3098, 3083,
+        3067, 3052, 3035, 3019, 3001, 2984, 2966, 2947,
+        2928, 2909, 2889, 2868, 2848, 2827, 2805, 2783,
+        2761, 2738, 2714, 2691, 2667, 2642, 2617, 2592,
+        2566, 2540, 2514, 2487, 2460, 2432, 2405, 2376,
+        2348, 2319, 2289, 2260, 2230, 2199, 2169, 2138,
+        2106, 2075, 2043, 2010, 1978, 1945, 1912, 1878,
+        1845, 1811, 1776, 1742, 1707, 1672, 1636, 1601,
+        1565, 1529, 1493, 1456, 1420, 1383, 1345, 1308,
+        1271, 1233, 1195, 1157, 1119, 1080, 1041, 1003,
+        964, 925, 886, 846, 807, 767, 727, 688,
+        648, 608, 568, 527, 487, 447, 406, 366,
+        325, 285, 244, 204, 163, 122, 81, 41,
+        0, -41,
+    ],
+    [
+        0, -41, -81, -122, -163, -204, -244, -285,
+        -325, -366, -406, -447, -487, -527, -568, -608,
+        -648, -688, -727, -767, -807, -846, -886, -925,
+        -964, -1003, -1041, -1080, -1119, -1157, -1195, -1233,
+        -1271, -1308, -1345, -1383, -1420, -1456, -1493, -1529,
+        -1565, -1601, -1636, -1672, -1707, -1742, -1776, -1811,
+        -1845, -1878, -1912, -1945, -1978, -2010, -2043, -2075,
+        -2106, -2138, -2169, -2199, -2230, -2260, -2289, -2319,
+        -2348, -2376, -2405, -2432, -2460, -2487, -2514, -2540,
+        -2566, -2592, -2617, -2642, -2667, -2691, -2714, -2738,
+        -2761, -2783, -2805, -2827, -2848, -2868, -2889, -2909,
+        -2928, -2947, -2966, -2984, -3001, -3019, -3035, -3052,
+        -3067, -3083, -3098, -3112, -3126, -3140, -3153, -3165,
+        -3177, -3189, -3200, -3210, -3221, -3230, -3239, -3248,
+        -3256, -3264, -3271, -3278, -3284, -3290, -3295, -3300,
+        -3304, -3308, -3311, -3314, -3316, -3318, -3319, -3320,
+        -3320, -3320, -3319, -3318, -3316, -3314, -3311, -3308,
+        -3304, -3300, -3295, -3290, -3284, -3278, -3271, -3264,
+        -3256, -3248, -3239, -3230, -3221, -3210, -3200, -3189,
+        -3177, -3165, -3153, -3140, -3126, -3112, -3098, -3083,
+        -3067, -3052, -3035, -3019, -3001, -2984, -2966, -2947,
+        -2928, -2909, -2889, -2868, -2848, -2827, -2805, -2783,
+        -2761, -2738, -2714, -2691, -2667, -2642, -2617, -2592,
+        -2566, -2540, -2514, -2487, -2460, -2432, -2405, -2376,
+        -2348, -2319, -2289, -2260, -2230, -2199, -2169, -2138,
+        -2106, -2075, -2043, -2010, -1978, -1945, -1912, -1878,
+        -1845, -1811, -1776, -1742, -1707, -1672, -1636, -1601,
+        -1565, -1529, -1493, -1456, -1420, -1383, -1345, -1308,
+        -1271, -1233, -1195, -1157, -1119, -1080, -1041, -1003,
+        -964, -925, -886, -846, -807, -767, -727, -688,
+        -648, -608, -568, -527, -487, -447, -406, -366,
+        -325, -285, -244, -204, -163, -122, -81, -41,
+        0, 41, 81, 122, 163, 204, 244, 285,
+        325, 366, 406, 447, 487, 527, 568, 608,
+        648, 688, 727, 767, 807, 846, 886, 925,
+        964, 1003, 1041, 1080, 1119, 1157, 1195, 1233,
+        1271, 1308, 1345, 1383, 1420, 1456, 1493, 1529,
+        1565, 1601, 1636, 1672, 1707, 1742, 1776, 1811,
+        1845, 1878, 1912, 1945, 1978, 2010, 2043, 2075,
+        2106, 2138, 2169, 2199, 2230, 2260, 2289, 2319,
+        2348, 2376, 2405, 2432, 2460, 2487, 2514, 2540,
+        2566, 2592, 2617, 2642, 2667, 2691, 2714, 2738,
+        2761, 2783, 2805, 2827, 2848, 2868, 2889, 2909,
+        2928, 2947, 2966, 2984, 3001, 3019, 3035, 3052,
+        3067, 3083, 3098, 3112, 3126, 3140, 3153, 3165,
+        3177, 3189, 3200, 3210, 3221, 3230, 3239, 3248,
+        3256, 3264, 3271, 3278, 3284, 3290, 3295, 3300,
+        3304, 3308, 3311, 3314, 3316, 3318, 3319, 3320,
+        3320, 3320, 3319, 3318, 3316, 3314, 3311, 3308,
+        3304, 3300, 3295, 3290, 3284, 3278, 3271, 3264,
+        3256, 3248, 3239, 3230, 3221, 3210, 3200, 3189,
+        3177, 3165, 3153, 3140, 3126, 3112, 3098, 3083,
+        3067, 3052, 3035, 3019, 3001, 2984, 2966, 2947,
+        2928, 2909, 2889, 2868, 2848, 2827, 2805, 2783,
+        2761, 2738, 2714, 2691, 2667, 2642, 2617, 2592,
+        2566, 2540, 2514, 2487, 2460, 2432, 2405, 2376,
+        2348, 2319, 2289, 2260, 2230, 2199, 2169, 2138,
+        2106, 2075, 2043, 2010, 1978, 1945, 1912, 1878,
+        1845, 1811, 1776, 1742, 1707, 1672, 1636, 1601,
+        1565, 1529, 1493, 1456, 1420, 1383, 1345, 1308,
+        1271, 1233, 1195, 1157, 1119, 1080, 1041, 1003,
+        964, 925, 886, 846, 807, 767, 727, 688,
+        648, 608, 568, 527, 487, 447, 406, 366,
+        325, 285, 244, 204, 163, 122, 81, 41,
+        0, -41,
+    ],
+];
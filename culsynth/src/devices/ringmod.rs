@@ -85,12 +85,17 @@ impl<Smp: Float> RingMod<Smp> {
     ) -> &[Smp] {
         let numsamples = min_size(&[params.len(), a.len(), b.len(), STATIC_BUFFER_SIZE]);
         for i in 0..numsamples {
-            let out = a[i] * b[i];
-            self.outbuf[i] =
-                out * params.mix_out[i] + a[i] * params.mix_a[i] + b[i] * params.mix_b[i];
+            self.outbuf[i] = Self::tick(a[i], b[i], &params, i);
         }
         &self.outbuf[0..numsamples]
     }
+    /// Compute a single sample - the per-sample analog of [RingMod::process],
+    /// for callers interleaving several devices in one loop (see
+    /// [crate::voice::Voice])
+    pub(crate) fn tick(a: Smp, b: Smp, params: &RingModParams<Smp>, i: usize) -> Smp {
+        let out = a * b;
+        out * params.mix_out[i] + a * params.mix_a[i] + b * params.mix_b[i]
+    }
 }
 
 impl<Smp: Float> Default for RingMod<Smp> {
@@ -183,14 +188,20 @@ impl RingModFxP {
     ) -> &[SampleFxP] {
         let numsamples = min_size(&[params.len(), a.len(), b.len(), STATIC_BUFFER_SIZE]);
         for i in 0..numsamples {
-            let out = SampleFxP::saturating_from_num(a[i].wide_mul(b[i]));
-            let mixed_32bits = widen_i(apply_scalar_i(out, params.mix_out[i]))
-                + widen_i(apply_scalar_i(a[i], params.mix_a[i]))
-                + widen_i(apply_scalar_i(b[i], params.mix_b[i]));
-            self.outbuf[i] = SampleFxP::saturating_from_num(mixed_32bits);
+            self.outbuf[i] = Self::tick(a[i], b[i], &params, i);
         }
         &self.outbuf[0..numsamples]
     }
+    /// Compute a single sample - the per-sample analog of
+    /// [RingModFxP::process], for callers interleaving several devices in one
+    /// loop (see [crate::voice::VoiceFxP])
+    pub(crate) fn tick(a: SampleFxP, b: SampleFxP, params: &RingModParamsFxP, i: usize) -> SampleFxP {
+        let out = SampleFxP::saturating_from_num(a.wide_mul(b));
+        let mixed_32bits = widen_i(apply_scalar_i(out, params.mix_out[i]))
+            + widen_i(apply_scalar_i(a, params.mix_a[i]))
+            + widen_i(apply_scalar_i(b, params.mix_b[i]));
+        SampleFxP::saturating_from_num(mixed_32bits)
+    }
 }
 
 impl Default for RingModFxP {
@@ -0,0 +1,623 @@
+use super::*;
+
+/// The maximum number of unison sub-oscillators a [UnisonOsc] will run.
+pub const UNISON_MAX: usize = 8;
+
+/// Detune spread for each unison width, as a fraction of the detune amount
+/// in [I7F9](crate::fixedmath::I7F9) semitones (so +/-512 bits == +/-1
+/// semitone at full detune).  Row `v - 1` holds the offsets for `v` voices,
+/// ordered center-out: the sub-oscillators are spaced evenly across the
+/// spread, with entry 0 the centermost voice (exact center for odd widths)
+/// and the outermost pair last.  Unused entries are zero.
+static SPREAD: [[SignedNoteFxP; UNISON_MAX]; UNISON_MAX] = [
+    [
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+    ],
+    [
+        SignedNoteFxP::from_bits(-512),
+        SignedNoteFxP::from_bits(512),
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+    ],
+    [
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::from_bits(-512),
+        SignedNoteFxP::from_bits(512),
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+    ],
+    [
+        SignedNoteFxP::from_bits(-171),
+        SignedNoteFxP::from_bits(171),
+        SignedNoteFxP::from_bits(-512),
+        SignedNoteFxP::from_bits(512),
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+    ],
+    [
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::from_bits(-256),
+        SignedNoteFxP::from_bits(256),
+        SignedNoteFxP::from_bits(-512),
+        SignedNoteFxP::from_bits(512),
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+    ],
+    [
+        SignedNoteFxP::from_bits(-102),
+        SignedNoteFxP::from_bits(102),
+        SignedNoteFxP::from_bits(-307),
+        SignedNoteFxP::from_bits(307),
+        SignedNoteFxP::from_bits(-512),
+        SignedNoteFxP::from_bits(512),
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::ZERO,
+    ],
+    [
+        SignedNoteFxP::ZERO,
+        SignedNoteFxP::from_bits(-171),
+        SignedNoteFxP::from_bits(171),
+        SignedNoteFxP::from_bits(-341),
+        SignedNoteFxP::from_bits(341),
+        SignedNoteFxP::from_bits(-512),
+        SignedNoteFxP::from_bits(512),
+        SignedNoteFxP::ZERO,
+    ],
+    [
+        SignedNoteFxP::from_bits(-73),
+        SignedNoteFxP::from_bits(73),
+        SignedNoteFxP::from_bits(-219),
+        SignedNoteFxP::from_bits(219),
+        SignedNoteFxP::from_bits(-366),
+        SignedNoteFxP::from_bits(366),
+        SignedNoteFxP::from_bits(-512),
+        SignedNoteFxP::from_bits(512),
+    ],
+];
+
+/// The normalization gain for each unison width (1/v at index `v - 1`), so
+/// the summed sub-oscillators keep the same headroom as a single oscillator
+/// without requiring a division.
+static RECIP: [ScalarFxP; UNISON_MAX] = [
+    ScalarFxP::from_bits(0xFFFF),
+    ScalarFxP::from_bits(0x8000),
+    ScalarFxP::from_bits(0x5555),
+    ScalarFxP::from_bits(0x4000),
+    ScalarFxP::from_bits(0x3333),
+    ScalarFxP::from_bits(0x2AAB),
+    ScalarFxP::from_bits(0x2492),
+    ScalarFxP::from_bits(0x2000),
+];
+
+/// A one-entry cache of the floating-point spread offsets and normalization
+/// gain for a unison width, so the conversions and divisions only run when
+/// the number of voices actually changes.
+#[derive(Clone)]
+struct SpreadCache<Smp> {
+    voices: usize,
+    offsets: [Smp; UNISON_MAX],
+    gain: Smp,
+}
+
+impl<Smp: Float> SpreadCache<Smp> {
+    fn new() -> Self {
+        Self {
+            // zero is not a valid width, so the first use always recomputes:
+            voices: 0,
+            offsets: [Smp::ZERO; UNISON_MAX],
+            gain: Smp::ZERO,
+        }
+    }
+    fn update(&mut self, voices: usize) {
+        if voices == self.voices {
+            return;
+        }
+        self.voices = voices;
+        self.gain = Smp::ONE / Smp::from_u16(voices as u16);
+        for k in 0..UNISON_MAX {
+            let bits = SPREAD[voices - 1][k].to_bits();
+            let mag = Smp::from_u16(bits.unsigned_abs()) / Smp::from_u16(512);
+            self.offsets[k] = if bits < 0 { mag.neg() } else { mag };
+        }
+    }
+}
+
+/// A parameter pack for a [UnisonOsc].
+pub struct UnisonOscParams<'a, Smp> {
+    /// The parameters shared by all of the unison sub-oscillators (see
+    /// [MixOscParams]).  The sync input/output applies to the centermost
+    /// sub-oscillator only; the detuned copies always free-run.
+    pub osc: MixOscParams<'a, Smp>,
+    /// The unison detune amount, in semitones - the outermost pair of
+    /// sub-oscillators is offset by this much, and the rest are spaced
+    /// evenly in between
+    pub detune: &'a [Smp],
+    /// The number of unison sub-oscillators to run, clamped to the range
+    /// `[1, UNISON_MAX]`.  One voice is a plain [MixOsc] with no detune
+    /// and no normalization cost.
+    pub voices: usize,
+}
+
+impl<'a, Smp> UnisonOscParams<'a, Smp> {
+    /// The length of this parameter pack, defined as the length of the
+    /// shortest subslice
+    pub fn len(&self) -> usize {
+        core::cmp::min(self.osc.len(), self.detune.len())
+    }
+    /// This is empty if `self.len() == 0`
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+/// A parameter pack for a [UnisonOscFxP].
+pub struct UnisonOscParamsFxP<'a> {
+    /// The parameters shared by all of the unison sub-oscillators (see
+    /// [MixOscParamsFxP]).  The sync input/output applies to the centermost
+    /// sub-oscillator only; the detuned copies always free-run.
+    pub osc: MixOscParamsFxP<'a>,
+    /// The unison detune amount, as a fraction of a semitone - the outermost
+    /// pair of sub-oscillators is offset by this much, and the rest are
+    /// spaced evenly in between
+    pub detune: &'a [ScalarFxP],
+    /// The number of unison sub-oscillators to run, clamped to the range
+    /// `[1, UNISON_MAX]`.  One voice is a plain [MixOscFxP] with no detune
+    /// and no normalization cost.
+    pub voices: usize,
+}
+
+impl<'a> UnisonOscParamsFxP<'a> {
+    /// The length of this parameter pack, defined as the length of the
+    /// shortest subslice
+    pub fn len(&self) -> usize {
+        core::cmp::min(self.osc.len(), self.detune.len())
+    }
+    /// This is empty if `self.len() == 0`
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+/// Mix a single sample of oscillator output down with the supplied wave
+/// gains - the per-sample mixing step shared by every unison sub-oscillator
+fn mix_sample<Smp: Float>(
+    out: OscOutputSample<Smp>,
+    params: &MixOscParams<Smp>,
+    waves: OscWaveforms,
+    i: usize,
+) -> Smp {
+    let mut mixed = Smp::ZERO;
+    if waves.contains(OscWaveforms::SIN) {
+        mixed = mixed + out.sin * params.sin[i];
+    }
+    if waves.contains(OscWaveforms::SQ) {
+        mixed = mixed + out.sq * params.sq[i];
+    }
+    if waves.contains(OscWaveforms::TRI) {
+        mixed = mixed + out.tri * params.tri[i];
+    }
+    if waves.contains(OscWaveforms::SAW) {
+        mixed = mixed + out.saw * params.saw[i];
+    }
+    mixed
+}
+
+/// Mix a single sample of oscillator output down with the supplied wave
+/// gains - the per-sample mixing step shared by every unison sub-oscillator
+fn mix_sample_fxp(
+    out: OscOutputSample<SampleFxP>,
+    params: &MixOscParamsFxP,
+    waves: OscWaveforms,
+    i: usize,
+) -> fixedmath::I4F28 {
+    let mut mixed = fixedmath::I4F28::ZERO;
+    if waves.contains(OscWaveforms::SIN) {
+        mixed += out.sin.wide_mul_unsigned(params.sin[i]);
+    }
+    if waves.contains(OscWaveforms::SQ) {
+        mixed += out.sq.wide_mul_unsigned(params.sq[i]);
+    }
+    if waves.contains(OscWaveforms::TRI) {
+        mixed += out.tri.wide_mul_unsigned(params.tri[i]);
+    }
+    if waves.contains(OscWaveforms::SAW) {
+        mixed += out.saw.wide_mul_unsigned(params.saw[i]);
+    }
+    mixed
+}
+
+/// A unison oscillator: a [MixOsc] that can run up to [UNISON_MAX] detuned
+/// copies of itself while every copy shares the same parameter stream.  Only
+/// the oscillator phase state is duplicated - a voice built on this gets
+/// thick unison from one envelope/filter/mod-section evaluation per key
+/// instead of one per unison copy (see [crate::voice::Voice]).
+///
+/// With a single voice this is exactly a [MixOsc]; detuned copies add only
+/// per-sample oscillator and mixing cost plus one normalization multiply
+/// each, and the output is scaled by the reciprocal of the voice count to
+/// preserve headroom.
+#[derive(Clone)]
+pub struct UnisonOsc<Smp> {
+    center: MixOsc<Smp>,
+    detuned: [Osc<Smp>; UNISON_MAX - 1],
+    spread: SpreadCache<Smp>,
+    outbuf: BufferT<Smp>,
+}
+
+impl<Smp: Float> UnisonOsc<Smp> {
+    /// Constructor
+    pub fn new() -> Self {
+        Self {
+            center: MixOsc::new(),
+            detuned: core::array::from_fn(|_| Osc::new()),
+            spread: SpreadCache::new(),
+            outbuf: [Smp::ZERO; STATIC_BUFFER_SIZE],
+        }
+    }
+    /// Run this oscillator with the supplied note signal and parameters
+    ///
+    /// Note: The output slice from this function may be shorter than the
+    /// input slices.  Callers must check the number of returned samples and
+    /// copy them into their own output buffers before calling this function
+    /// again to process the remainder of the data.
+    pub fn process(
+        &mut self,
+        ctx: &Context<Smp>,
+        note: &[Smp],
+        params: UnisonOscParams<Smp>,
+        scratch: &mut OscScratch<Smp>,
+    ) -> &[Smp] {
+        let voices = params.voices.clamp(1, UNISON_MAX);
+        if voices == 1 {
+            // A single voice keeps the buffer-at-a-time mixing path:
+            return self.center.process(ctx, note, params.osc, scratch);
+        }
+        let numsamples = min_size(&[note.len(), params.len(), STATIC_BUFFER_SIZE]);
+        let waves = params.osc.waveforms();
+        let tau_over_sr = Smp::TAU() / ctx.sample_rate;
+        let MixOscParams {
+            tune,
+            shape,
+            mut sync,
+            sin,
+            sq,
+            tri,
+            saw,
+        } = params.osc;
+        let p = UnisonOscParams {
+            osc: MixOscParams {
+                tune,
+                shape,
+                sync: OscSync::Off,
+                sin,
+                sq,
+                tri,
+                saw,
+            },
+            detune: params.detune,
+            voices,
+        };
+        for i in 0..numsamples {
+            self.outbuf[i] = self.tick(tau_over_sr, note[i], &p, waves, sync.at(i), i);
+        }
+        &self.outbuf[0..numsamples]
+    }
+    /// Run this oscillator for a single sample - the per-sample analog of
+    /// [UnisonOsc::process], for callers interleaving several devices in one
+    /// loop (see [crate::voice::Voice]).  The waveform mask should be
+    /// computed once per block with [MixOscParams::waveforms], and the `sync`
+    /// argument is used in place of `params.osc.sync` (which is ignored).
+    pub(crate) fn tick(
+        &mut self,
+        tau_over_sr: Smp,
+        note: Smp,
+        params: &UnisonOscParams<Smp>,
+        waves: OscWaveforms,
+        sync: OscSyncTick<Smp>,
+        i: usize,
+    ) -> Smp {
+        let voices = params.voices.clamp(1, UNISON_MAX);
+        if voices == 1 {
+            return self
+                .center
+                .tick(tau_over_sr, note, &params.osc, waves, sync, i);
+        }
+        self.spread.update(voices);
+        let detune = params.detune[i];
+        let tune = params.osc.tune[i];
+        let shape = params.osc.shape[i];
+        let out = self.center.engine().tick(
+            tau_over_sr,
+            note,
+            tune + detune * self.spread.offsets[0],
+            shape,
+            waves,
+            sync,
+        );
+        let mut acc = mix_sample(out, &params.osc, waves, i);
+        for k in 1..voices {
+            let out = self.detuned[k - 1].tick(
+                tau_over_sr,
+                note,
+                tune + detune * self.spread.offsets[k],
+                shape,
+                waves,
+                OscSyncTick::Off,
+            );
+            acc = acc + mix_sample(out, &params.osc, waves, i);
+        }
+        acc * self.spread.gain
+    }
+}
+
+impl<Smp: Float> Default for UnisonOsc<Smp> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+/// A unison oscillator: a [MixOscFxP] that can run up to [UNISON_MAX]
+/// detuned copies of itself while every copy shares the same parameter
+/// stream.  Only the oscillator phase state is duplicated - a voice built on
+/// this gets thick unison from one envelope/filter/mod-section evaluation
+/// per key instead of one per unison copy (see [crate::voice::VoiceFxP]).
+///
+/// With a single voice this is exactly a [MixOscFxP]; detuned copies add
+/// only per-sample oscillator and mixing cost plus one normalization
+/// multiply each, and the output is scaled by the reciprocal of the voice
+/// count to preserve headroom.
+#[derive(Clone)]
+pub struct UnisonOscFxP<O: OscEngineFxP = OscFxP> {
+    center: MixOscFxP<O>,
+    detuned: [O; UNISON_MAX - 1],
+    outbuf: BufferT<SampleFxP>,
+}
+
+/// A [UnisonOscFxP] built on the band-limited wavetable engine
+#[cfg(feature = "wavetables")]
+pub type WavetableUnisonOscFxP = UnisonOscFxP<WavetableOscFxP>;
+
+impl<O: OscEngineFxP> UnisonOscFxP<O> {
+    /// Constructor
+    pub fn new() -> Self {
+        Self {
+            center: MixOscFxP::new(),
+            detuned: core::array::from_fn(|_| Default::default()),
+            outbuf: [SampleFxP::ZERO; STATIC_BUFFER_SIZE],
+        }
+    }
+    /// Run this oscillator with the supplied note signal and parameters
+    ///
+    /// Note: The output slice from this function may be shorter than the
+    /// input slices.  Callers must check the number of returned samples and
+    /// copy them into their own output buffers before calling this function
+    /// again to process the remainder of the data.
+    pub fn process(
+        &mut self,
+        ctx: &ContextFxP,
+        note: &[NoteFxP],
+        params: UnisonOscParamsFxP,
+        scratch: &mut OscScratch<SampleFxP>,
+    ) -> &[SampleFxP] {
+        let voices = params.voices.clamp(1, UNISON_MAX);
+        if voices == 1 {
+            // A single voice keeps the buffer-at-a-time mixing path:
+            return self.center.process(ctx, note, params.osc, scratch);
+        }
+        let numsamples = min_size(&[note.len(), params.len(), STATIC_BUFFER_SIZE]);
+        let waves = params.osc.waveforms();
+        let frac_2pi4096_sr = ctx.sample_rate.frac_2pi4096_sr();
+        let MixOscParamsFxP {
+            tune,
+            shape,
+            mut sync,
+            sin,
+            sq,
+            tri,
+            saw,
+        } = params.osc;
+        let p = UnisonOscParamsFxP {
+            osc: MixOscParamsFxP {
+                tune,
+                shape,
+                sync: OscSync::Off,
+                sin,
+                sq,
+                tri,
+                saw,
+            },
+            detune: params.detune,
+            voices,
+        };
+        for i in 0..numsamples {
+            self.outbuf[i] = self.tick(frac_2pi4096_sr, note[i], &p, waves, sync.at(i), i);
+        }
+        &self.outbuf[0..numsamples]
+    }
+    /// Run this oscillator for a single sample - the per-sample analog of
+    /// [UnisonOscFxP::process], for callers interleaving several devices in
+    /// one loop (see [crate::voice::VoiceFxP]).  The waveform mask should be
+    /// computed once per block with [MixOscParamsFxP::waveforms], and the
+    /// `sync` argument is used in place of `params.osc.sync` (which is
+    /// ignored).
+    pub(crate) fn tick(
+        &mut self,
+        frac_2pi4096_sr: ScalarFxP,
+        note: NoteFxP,
+        params: &UnisonOscParamsFxP,
+        waves: OscWaveforms,
+        sync: OscSyncTick<ScalarFxP>,
+        i: usize,
+    ) -> SampleFxP {
+        let voices = params.voices.clamp(1, UNISON_MAX);
+        if voices == 1 {
+            return self
+                .center
+                .tick(frac_2pi4096_sr, note, &params.osc, waves, sync, i);
+        }
+        let spread = &SPREAD[voices - 1];
+        let gain = RECIP[voices - 1];
+        let detune = params.detune[i];
+        let tune = params.osc.tune[i];
+        let shape = params.osc.shape[i];
+        let out = self.center.engine().tick(
+            frac_2pi4096_sr,
+            note,
+            tune.saturating_add(fixedmath::apply_scalar_i(spread[0], detune)),
+            shape,
+            waves,
+            sync,
+        );
+        let mut acc =
+            SampleFxP::from_num(mix_sample_fxp(out, &params.osc, waves, i)).wide_mul_unsigned(gain);
+        for k in 1..voices {
+            let out = self.detuned[k - 1].tick(
+                frac_2pi4096_sr,
+                note,
+                tune.saturating_add(fixedmath::apply_scalar_i(spread[k], detune)),
+                shape,
+                waves,
+                OscSyncTick::Off,
+            );
+            acc += SampleFxP::from_num(mix_sample_fxp(out, &params.osc, waves, i))
+                .wide_mul_unsigned(gain);
+        }
+        SampleFxP::from_num(acc)
+    }
+}
+
+impl<O: OscEngineFxP> Default for UnisonOscFxP<O> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use super::*;
+
+    /// A single unison voice with zero detune must be bit-identical to the
+    /// plain mixing oscillator, since the voice uses this device in place of
+    /// its first [MixOscFxP].
+    #[test]
+    fn single_voice_matches_mixosc() {
+        let ctx = ContextFxP::default();
+        let mut unison = UnisonOscFxP::<OscFxP>::new();
+        let mut mix = MixOscFxP::<OscFxP>::new();
+        let mut scratch = OscScratch::new();
+        let mut unison_out = [SampleFxP::ZERO; STATIC_BUFFER_SIZE];
+        let note = [NoteFxP::lit("69"); STATIC_BUFFER_SIZE];
+        let tune = [SignedNoteFxP::ZERO; STATIC_BUFFER_SIZE];
+        let shape = [ScalarFxP::ZERO; STATIC_BUFFER_SIZE];
+        let gain = [ScalarFxP::MAX; STATIC_BUFFER_SIZE];
+        let zero = [ScalarFxP::ZERO; STATIC_BUFFER_SIZE];
+        let out = unison.process(
+            &ctx,
+            &note,
+            UnisonOscParamsFxP {
+                osc: MixOscParamsFxP {
+                    tune: &tune,
+                    shape: &shape,
+                    sync: OscSync::Off,
+                    sin: &zero,
+                    sq: &zero,
+                    tri: &zero,
+                    saw: &gain,
+                },
+                detune: &zero,
+                voices: 1,
+            },
+            &mut scratch,
+        );
+        let numsamples = out.len();
+        unison_out[..numsamples].copy_from_slice(out);
+        let mix_out = mix.process(
+            &ctx,
+            &note,
+            MixOscParamsFxP {
+                tune: &tune,
+                shape: &shape,
+                sync: OscSync::Off,
+                sin: &zero,
+                sq: &zero,
+                tri: &zero,
+                saw: &gain,
+            },
+            &mut scratch,
+        );
+        assert_eq!(&unison_out[..numsamples], mix_out);
+    }
+
+    /// With zero detune every sub-oscillator is phase-locked, so the
+    /// normalized unison sum must stay within a rounding error of the single
+    /// oscillator output regardless of the voice count.
+    #[test]
+    fn zero_detune_sums_to_unity() {
+        let mut scratch = OscScratch::new();
+        let mut unison_out = [0f32; STATIC_BUFFER_SIZE];
+        for voices in 2..=UNISON_MAX {
+            let ctx = Context::<f32>::default();
+            let mut unison = UnisonOsc::<f32>::new();
+            let mut mix = MixOsc::<f32>::new();
+            let note = [69f32; STATIC_BUFFER_SIZE];
+            let tune = [0f32; STATIC_BUFFER_SIZE];
+            let shape = [0f32; STATIC_BUFFER_SIZE];
+            let gain = [1f32; STATIC_BUFFER_SIZE];
+            let zero = [0f32; STATIC_BUFFER_SIZE];
+            let out = unison.process(
+                &ctx,
+                &note,
+                UnisonOscParams {
+                    osc: MixOscParams {
+                        tune: &tune,
+                        shape: &shape,
+                        sync: OscSync::Off,
+                        sin: &zero,
+                        sq: &zero,
+                        tri: &zero,
+                        saw: &gain,
+                    },
+                    detune: &zero,
+                    voices,
+                },
+                &mut scratch,
+            );
+            let numsamples = out.len();
+            unison_out[..numsamples].copy_from_slice(out);
+            let mix_out = mix.process(
+                &ctx,
+                &note,
+                MixOscParams {
+                    tune: &tune,
+                    shape: &shape,
+                    sync: OscSync::Off,
+                    sin: &zero,
+                    sq: &zero,
+                    tri: &zero,
+                    saw: &gain,
+                },
+                &mut scratch,
+            );
+            for (a, b) in unison_out[..numsamples].iter().zip(mix_out.iter()) {
+                assert!((a - b).abs() < 1e-5);
+            }
+        }
+    }
+}
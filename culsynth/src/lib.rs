@@ -18,8 +18,15 @@
 #![no_std]
 #![warn(missing_docs)]
 
-mod fixedmath;
-mod float_approx;
+#[cfg(feature = "std")]
+extern crate std;
+
+pub mod fixedmath;
+pub mod float_approx;
+#[cfg(feature = "profile")]
+pub mod profiling;
+#[cfg(all(feature = "simd", target_arch = "x86_64"))]
+mod simd;
 pub mod util;
 
 /// True if using libm for floating-point math, false if using internal
@@ -42,10 +49,47 @@ pub mod devices;
 pub mod voice;
 pub use voice::VoiceFxP;
 
-const STATIC_BUFFER_SIZE: usize = 256;
+#[cfg(feature = "std")]
+pub mod render;
+
+/// The size, in samples, of the internal buffer within each device.  No call
+/// to `process()` will handle more than this many samples at a time, so
+/// callers passing longer buffers must check the length of the returned
+/// slice and call again with the remainder (see e.g. [voice::VoiceFxP]).
+///
+/// This defaults to 256 samples; the mutually-exclusive `buffer_size_*`
+/// features select a different size so that each deployment can compile with
+/// its natural block size - smaller to cut RAM and latency on embedded
+/// targets, larger to eliminate the chunking overhead on hosts running
+/// bigger blocks.
+pub const STATIC_BUFFER_SIZE: usize = if cfg!(feature = "buffer_size_32") {
+    32
+} else if cfg!(feature = "buffer_size_64") {
+    64
+} else if cfg!(feature = "buffer_size_128") {
+    128
+} else if cfg!(feature = "buffer_size_512") {
+    512
+} else if cfg!(feature = "buffer_size_1024") {
+    1024
+} else {
+    256
+};
+
+const _: () = assert!(
+    (cfg!(feature = "buffer_size_32") as usize)
+        + (cfg!(feature = "buffer_size_64") as usize)
+        + (cfg!(feature = "buffer_size_128") as usize)
+        + (cfg!(feature = "buffer_size_512") as usize)
+        + (cfg!(feature = "buffer_size_1024") as usize)
+        <= 1,
+    "at most one buffer_size_* feature may be enabled"
+);
+
 type BufferT<T> = [T; STATIC_BUFFER_SIZE];
 
 pub use fixedmath::midi_note_to_frequency;
+pub use fixedmath::{midi_note_to_frequency_lut, note_to_frequency_tuned, TuningTable};
 pub use fixedmath::Note as NoteFxP;
 pub use fixedmath::Sample as SampleFxP;
 pub use fixedmath::Scalar as ScalarFxP;
@@ -0,0 +1,185 @@
+//! Lightweight per-stage timing instrumentation for the voice processing
+//! hot path (enabled with the `profile` feature).
+//!
+//! Each voice accumulates the number of ticks spent in each processing
+//! [Stage] into a [StageProfile], which callers may harvest between blocks
+//! (see `VoiceFxP::take_profile`).  Ticks are read from [ticks]: the
+//! timestamp counter on x86_64, or a caller-installed source on other
+//! targets (see [set_tick_source]) - notably the RP2040's Cortex-M0+ has no
+//! DWT cycle counter, so the firmware should install its microsecond timer.
+//!
+//! When the `profile` feature is disabled none of this code is compiled.
+
+#[cfg(not(target_arch = "x86_64"))]
+use core::sync::atomic::{AtomicUsize, Ordering};
+
+/// The stages of voice processing that are timed, in processing order
+#[repr(usize)]
+#[derive(Clone, Copy, PartialEq)]
+pub enum Stage {
+    /// The modulation section (LFOs, modulation envelopes, and applying
+    /// the modulation matrix to the parameters)
+    ModSection,
+    /// Oscillator 1
+    Osc1,
+    /// Oscillator 2
+    Osc2,
+    /// The ring modulation section
+    RingMod,
+    /// The filter envelope
+    FiltEnv,
+    /// The filter
+    Filt,
+    /// The amplifier envelope
+    AmpEnv,
+    /// The VCA
+    Vca,
+}
+
+impl Stage {
+    /// The number of different stages
+    pub const NUM: usize = 8;
+    /// An array containing all possible `Stage` values, in order
+    pub const ELEM: [Stage; Self::NUM] = [
+        Stage::ModSection,
+        Stage::Osc1,
+        Stage::Osc2,
+        Stage::RingMod,
+        Stage::FiltEnv,
+        Stage::Filt,
+        Stage::AmpEnv,
+        Stage::Vca,
+    ];
+    /// The string representation of the stage
+    pub const fn to_str(&self) -> &'static str {
+        match self {
+            Self::ModSection => "modsection",
+            Self::Osc1 => "osc1",
+            Self::Osc2 => "osc2",
+            Self::RingMod => "ringmod",
+            Self::FiltEnv => "filtenv",
+            Self::Filt => "filt",
+            Self::AmpEnv => "ampenv",
+            Self::Vca => "vca",
+        }
+    }
+}
+
+/// Read the current tick count.  On x86_64 this is the timestamp counter;
+/// on other targets it calls the source installed with [set_tick_source],
+/// or returns zero if none has been installed (disabling the timers).
+#[cfg(target_arch = "x86_64")]
+#[inline(always)]
+pub fn ticks() -> u64 {
+    unsafe { core::arch::x86_64::_rdtsc() }
+}
+
+/// The tick source installed with [set_tick_source], stored as a `usize`
+/// so it can live in an atomic (zero means no source is installed)
+#[cfg(not(target_arch = "x86_64"))]
+static TICK_SOURCE: AtomicUsize = AtomicUsize::new(0);
+
+/// Read the current tick count.  On x86_64 this is the timestamp counter;
+/// on other targets it calls the source installed with [set_tick_source],
+/// or returns zero if none has been installed (disabling the timers).
+#[cfg(not(target_arch = "x86_64"))]
+#[inline(always)]
+pub fn ticks() -> u64 {
+    let f = TICK_SOURCE.load(Ordering::Relaxed);
+    if f == 0 {
+        0
+    } else {
+        // SAFETY: the only nonzero values stored in TICK_SOURCE are
+        // `fn() -> u64` pointers (see set_tick_source)
+        unsafe { core::mem::transmute::<usize, fn() -> u64>(f)() }
+    }
+}
+
+/// Install the tick source used by [ticks] on targets without a built-in
+/// timestamp counter.  The Cortex-M0+ has no DWT cycle counter, so on the
+/// RP2040 this would typically read the (microsecond) timer peripheral.
+#[cfg(not(target_arch = "x86_64"))]
+pub fn set_tick_source(f: fn() -> u64) {
+    TICK_SOURCE.store(f as usize, Ordering::Relaxed);
+}
+
+/// Accumulated tick counts for each [Stage]
+#[derive(Clone, Copy, Default)]
+pub struct StageProfile {
+    /// Total ticks recorded against each stage, indexed by [Stage]
+    pub ticks: [u64; Stage::NUM],
+}
+
+impl StageProfile {
+    /// Add the counts from `other` into this profile
+    pub fn merge(&mut self, other: &StageProfile) {
+        for (acc, t) in self.ticks.iter_mut().zip(other.ticks.iter()) {
+            *acc = acc.wrapping_add(*t);
+        }
+    }
+    /// The sum of the counts for all stages
+    pub fn total(&self) -> u64 {
+        self.ticks.iter().sum()
+    }
+    /// Reset all counts to zero
+    pub fn reset(&mut self) {
+        *self = Default::default();
+    }
+}
+
+/// Attributes the time between successive calls to [StageTimer::mark] to
+/// the given stage, accumulating into a [StageProfile].  The clock starts
+/// at construction.
+pub struct StageTimer<'a> {
+    profile: &'a mut StageProfile,
+    last: u64,
+}
+
+impl<'a> StageTimer<'a> {
+    /// Start a timer accumulating into `profile`
+    pub fn new(profile: &'a mut StageProfile) -> Self {
+        Self {
+            profile,
+            last: ticks(),
+        }
+    }
+    /// Record the ticks elapsed since the previous mark (or construction)
+    /// against `stage`
+    #[inline]
+    pub fn mark(&mut self, stage: Stage) {
+        let now = ticks();
+        self.profile.ticks[stage as usize] = self.profile.ticks[stage as usize]
+            .wrapping_add(now.wrapping_sub(self.last));
+        self.last = now;
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use super::*;
+    #[test]
+    fn profile_merge_total() {
+        let mut a = StageProfile::default();
+        let mut b = StageProfile::default();
+        a.ticks[Stage::Filt as usize] = 100;
+        a.ticks[Stage::Osc1 as usize] = 50;
+        b.ticks[Stage::Filt as usize] = 25;
+        a.merge(&b);
+        assert_eq!(a.ticks[Stage::Filt as usize], 125);
+        assert_eq!(a.total(), 175);
+        a.reset();
+        assert_eq!(a.total(), 0);
+    }
+    #[test]
+    fn timer_marks_stages() {
+        let mut profile = StageProfile::default();
+        let mut timer = StageTimer::new(&mut profile);
+        timer.mark(Stage::ModSection);
+        timer.mark(Stage::Vca);
+        // All time must have been attributed to the two marked stages
+        assert_eq!(
+            profile.total(),
+            profile.ticks[Stage::ModSection as usize] + profile.ticks[Stage::Vca as usize]
+        );
+    }
+}
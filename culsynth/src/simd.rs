@@ -0,0 +1,72 @@
+//! Explicitly vectorized `f32` buffer kernels, used by the [crate::devices]
+//! module when the `simd` feature is enabled (see [crate::devices::Float]).
+//!
+//! These use SSE2, which is part of the x86_64 baseline, so no runtime
+//! feature detection is required and the module stays `no_std`-friendly.
+//! On other architectures the devices fall back to the scalar loops.
+
+use core::arch::x86_64::*;
+
+/// Element-wise multiply `a` and `b` into `dst`, truncating to the shortest
+/// of the three slices.
+pub fn mul(dst: &mut [f32], a: &[f32], b: &[f32]) {
+    let numsamples = crate::min_size(&[dst.len(), a.len(), b.len()]);
+    let mut i: usize = 0;
+    // SAFETY: SSE2 is always available on x86_64, and the loads/stores are
+    // bounded by numsamples, the length of the shortest slice
+    unsafe {
+        while i + 4 <= numsamples {
+            let va = _mm_loadu_ps(a.as_ptr().add(i));
+            let vb = _mm_loadu_ps(b.as_ptr().add(i));
+            _mm_storeu_ps(dst.as_mut_ptr().add(i), _mm_mul_ps(va, vb));
+            i += 4;
+        }
+    }
+    while i < numsamples {
+        dst[i] = a[i] * b[i];
+        i += 1;
+    }
+}
+
+/// Element-wise multiply `a` and `b` and accumulate the products into `dst`,
+/// truncating to the shortest of the three slices.
+pub fn mul_add(dst: &mut [f32], a: &[f32], b: &[f32]) {
+    let numsamples = crate::min_size(&[dst.len(), a.len(), b.len()]);
+    let mut i: usize = 0;
+    // SAFETY: SSE2 is always available on x86_64, and the loads/stores are
+    // bounded by numsamples, the length of the shortest slice
+    unsafe {
+        while i + 4 <= numsamples {
+            let va = _mm_loadu_ps(a.as_ptr().add(i));
+            let vb = _mm_loadu_ps(b.as_ptr().add(i));
+            let vd = _mm_loadu_ps(dst.as_ptr().add(i));
+            _mm_storeu_ps(dst.as_mut_ptr().add(i), _mm_add_ps(vd, _mm_mul_ps(va, vb)));
+            i += 4;
+        }
+    }
+    while i < numsamples {
+        dst[i] += a[i] * b[i];
+        i += 1;
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use super::*;
+    #[test]
+    fn matches_scalar() {
+        // Deliberately not a multiple of the vector width to cover the tail:
+        const N: usize = 19;
+        let a: [f32; N] = core::array::from_fn(|i| i as f32 * 0.25f32 - 2f32);
+        let b: [f32; N] = core::array::from_fn(|i| 1f32 - i as f32 * 0.125f32);
+        let mut dst = [0.5f32; N];
+        mul(&mut dst, &a, &b);
+        for i in 0..N {
+            assert_eq!(dst[i], a[i] * b[i]);
+        }
+        mul_add(&mut dst, &a, &b);
+        for i in 0..N {
+            assert_eq!(dst[i], (a[i] * b[i]) + (a[i] * b[i]));
+        }
+    }
+}
@@ -3,19 +3,37 @@
 
 use crate::context::{Context, ContextFxP};
 use crate::devices::*;
+use crate::fixedmath;
+#[cfg(feature = "profile")]
+use crate::profiling;
 use crate::{min_size, BufferT, STATIC_BUFFER_SIZE};
 use crate::{NoteFxP, SampleFxP, ScalarFxP};
 
 use self::modulation::{ModMatrix, ModMatrixFxP, ModSection, ModSectionFxP};
 
+pub mod bank;
 pub mod modulation;
 
+/// The maximum block size for which [VoiceFxP::process] and [Voice::process]
+/// will use the fused single-pass kernel instead of the buffer-at-a-time
+/// device chain.  At small block sizes the per-device loop overhead and
+/// buffer traffic dominate, so the whole chain is run sample-by-sample in a
+/// single loop with the intermediate signals kept in registers; at larger
+/// sizes the modular path amortizes its overhead and vectorizes better.
+pub const FUSED_BLOCK_MAX: usize = 64;
+
 /// A parameter pack for a [VoiceFxP]
 pub struct VoiceParamsFxP<'a> {
     /// Oscillator sync
     pub sync: &'a mut [ScalarFxP],
     /// Oscillator 1
     pub osc1_p: MutMixOscParamsFxP<'a>,
+    /// The number of unison sub-oscillators to run for oscillator 1, from 1
+    /// (no unison) to [UNISON_MAX]
+    pub unison_voices: usize,
+    /// The unison detune spread for oscillator 1, as a fraction of a
+    /// semitone (see [UnisonOscParamsFxP])
+    pub unison_detune: &'a [ScalarFxP],
     /// Oscillator 2
     pub osc2_p: MutMixOscParamsFxP<'a>,
     /// Ring-Mod
@@ -43,6 +61,7 @@ impl<'a> VoiceParamsFxP<'a> {
         min_size(&[
             self.sync.len(),
             self.osc1_p.len(),
+            self.unison_detune.len(),
             self.osc2_p.len(),
             self.ring_p.len(),
             self.filt_p.len(),
@@ -64,11 +83,12 @@ impl<'a> VoiceParamsFxP<'a> {
 /// a single VCF (with modulation inputs and mixing of low/band/high pass outputs),
 /// a VCA, and two envelopes (one for the VCA and one for the VCF).
 ///
-/// This implementaiton uses fixed point logic.
+/// This implementaiton uses fixed point logic.  The oscillator engine is
+/// generic (defaulting to the arithmetic [OscFxP]) - see [OscEngineFxP].
 #[derive(Clone)]
-pub struct VoiceFxP {
-    osc1: MixOscFxP,
-    osc2: MixOscFxP,
+pub struct VoiceFxP<O: OscEngineFxP = OscFxP> {
+    osc1: UnisonOscFxP<O>,
+    osc2: MixOscFxP<O>,
     ringmod: RingModFxP,
     filt: ModFiltFxP,
     env_amp: EnvFxP,
@@ -77,9 +97,16 @@ pub struct VoiceFxP {
     modsection: ModSectionFxP,
 
     vcabuf: BufferT<SampleFxP>,
+
+    #[cfg(feature = "profile")]
+    profile: profiling::StageProfile,
 }
 
-impl VoiceFxP {
+/// A [VoiceFxP] built on the band-limited wavetable oscillator engine
+#[cfg(feature = "wavetables")]
+pub type WavetableVoiceFxP = VoiceFxP<WavetableOscFxP>;
+
+impl<O: OscEngineFxP> VoiceFxP<O> {
     /// Constructor
     pub fn new() -> Self {
         Self {
@@ -92,13 +119,15 @@ impl VoiceFxP {
             env_filt: Default::default(),
             vca: Default::default(),
             modsection: Default::default(),
+            #[cfg(feature = "profile")]
+            profile: Default::default(),
         }
     }
     /// Constructor
     pub fn new_with_seeds(seeda: u64, seedb: u64) -> Self {
         Self {
             vcabuf: [SampleFxP::ZERO; STATIC_BUFFER_SIZE],
-            osc1: MixOscFxP::new(),
+            osc1: UnisonOscFxP::new(),
             osc2: MixOscFxP::new(),
             ringmod: RingModFxP::new(),
             filt: ModFiltFxP::new(),
@@ -106,6 +135,8 @@ impl VoiceFxP {
             env_filt: EnvFxP::new(),
             vca: AmpFxP::new(),
             modsection: ModSectionFxP::new_with_seeds(seeda, seedb),
+            #[cfg(feature = "profile")]
+            profile: Default::default(),
         }
     }
     /// Process the note/gate inputs, passing the parameters to the relevant
@@ -133,6 +164,7 @@ impl VoiceFxP {
         aftertouch: &[ScalarFxP],
         modwheel: &[ScalarFxP],
         mut params: VoiceParamsFxP,
+        scratch: &mut OscScratch<SampleFxP>,
     ) -> &[SampleFxP] {
         let numsamples = min_size(&[
             note.len(),
@@ -141,6 +173,18 @@ impl VoiceFxP {
             params.len(),
             STATIC_BUFFER_SIZE,
         ]);
+        // Small blocks run the whole chain sample-by-sample in a single fused
+        // loop (see [FUSED_BLOCK_MAX]).  The per-stage timing attribution
+        // below requires the buffer-at-a-time path, so the fused kernel is
+        // not selected when profiling:
+        #[cfg(not(feature = "profile"))]
+        if numsamples <= FUSED_BLOCK_MAX {
+            return self.process_fused(
+                ctx, matrix, note, gate, vel, aftertouch, modwheel, params, numsamples,
+            );
+        }
+        #[cfg(feature = "profile")]
+        let mut timer = profiling::StageTimer::new(&mut self.profile);
         // Build the ModMatrix
         let modparams = modulation::ModSectionParamsFxP {
             velocity: vel,
@@ -161,6 +205,8 @@ impl VoiceFxP {
         modulation.modulate_env(&mut params.filt_env_p, &modulation::ENV_FILT_MOD_DEST);
         modulation.modulate_env(&mut params.amp_env_p, &modulation::ENV_AMP_MOD_DEST);
         modulation.modulate_filt(&mut params.filt_p);
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::ModSection);
         // We don't need any of the params to be mutable now
         let osc1_p: MixOscParamsFxP = params.osc1_p.into();
         let osc2_p: MixOscParamsFxP = params.osc2_p.into();
@@ -172,20 +218,34 @@ impl VoiceFxP {
         let osc1_out = self.osc1.process(
             ctx,
             &note[0..numsamples],
-            osc1_p.with_sync(OscSync::Master(params.sync)),
+            UnisonOscParamsFxP {
+                osc: osc1_p.with_sync(OscSync::Master(params.sync)),
+                detune: params.unison_detune,
+                voices: params.unison_voices,
+            },
+            scratch,
         );
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::Osc1);
         let osc2_out = self.osc2.process(
             ctx,
             &note[0..numsamples],
             osc2_p.with_sync(OscSync::Slave(params.sync)),
+            scratch,
         );
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::Osc2);
         let ring_mod_out = self.ringmod.process(
             ctx,
             &osc1_out[0..numsamples],
             &osc2_out[0..numsamples],
             ring_p,
         );
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::RingMod);
         let filt_env_out = self.env_filt.process(ctx, &gate[0..numsamples], filt_env_p);
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::FiltEnv);
         let filt_out = self.filt.process(
             ctx,
             &ring_mod_out[0..numsamples],
@@ -194,15 +254,135 @@ impl VoiceFxP {
             vel,
             filt_p,
         );
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::Filt);
         let vca_env_out = self.env_amp.process(ctx, &gate[0..numsamples], amp_env_p);
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::AmpEnv);
         for i in 0..numsamples {
             self.vcabuf[i] = SampleFxP::from_num(vca_env_out[i]);
         }
-        self.vca.process(filt_out, &self.vcabuf[0..numsamples])
+        let out = self.vca.process(filt_out, &self.vcabuf[0..numsamples]);
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::Vca);
+        out
+    }
+    /// The fused single-pass implementation of [VoiceFxP::process], used for
+    /// small blocks (see [FUSED_BLOCK_MAX]).  The whole device chain runs
+    /// sample-by-sample in one loop via the devices' `tick` entry points,
+    /// keeping the intermediate signals in registers instead of streaming
+    /// them through per-device buffers (and leaving the [OscScratch]
+    /// untouched).  Not selected when profiling (see [VoiceFxP::process]),
+    /// but still compiled so the fused kernel builds under every feature
+    /// combination.
+    #[cfg_attr(feature = "profile", allow(dead_code))]
+    fn process_fused(
+        &mut self,
+        ctx: &ContextFxP,
+        matrix: &ModMatrixFxP,
+        note: &[NoteFxP],
+        gate: &[SampleFxP],
+        vel: &[ScalarFxP],
+        aftertouch: &[ScalarFxP],
+        modwheel: &[ScalarFxP],
+        mut params: VoiceParamsFxP,
+        numsamples: usize,
+    ) -> &[SampleFxP] {
+        // Build the ModMatrix and modulate the parameters, exactly as in the
+        // buffer-at-a-time path:
+        let modparams = modulation::ModSectionParamsFxP {
+            velocity: vel,
+            aftertouch,
+            modwheel,
+            lfo1_params: params.lfo1_p,
+            lfo2_params: params.lfo2_p,
+            env1_params: params.env1_p,
+            env2_params: params.env2_p,
+        };
+        let modulation = self
+            .modsection
+            .process(ctx, &gate[0..numsamples], modparams, matrix);
+        modulation.modulate_osc(&mut params.osc1_p, &modulation::OSC1_MOD_DEST);
+        modulation.modulate_osc(&mut params.osc2_p, &modulation::OSC2_MOD_DEST);
+        modulation.modulate_ring(&mut params.ring_p);
+        modulation.modulate_env(&mut params.filt_env_p, &modulation::ENV_FILT_MOD_DEST);
+        modulation.modulate_env(&mut params.amp_env_p, &modulation::ENV_AMP_MOD_DEST);
+        modulation.modulate_filt(&mut params.filt_p);
+        // We don't need any of the params to be mutable now
+        let osc1_p = UnisonOscParamsFxP {
+            osc: params.osc1_p.into(),
+            detune: params.unison_detune,
+            voices: params.unison_voices,
+        };
+        let osc2_p: MixOscParamsFxP = params.osc2_p.into();
+        let ring_p: RingModParamsFxP = params.ring_p.into();
+        let filt_env_p: EnvParamsFxP = params.filt_env_p.into();
+        let amp_env_p: EnvParamsFxP = params.amp_env_p.into();
+        let filt_p: ModFiltParamsFxP = params.filt_p.into();
+        // The waveform masks and derived sample rate constants are all
+        // loop-invariant:
+        let waves1 = osc1_p.osc.waveforms();
+        let waves2 = osc2_p.waveforms();
+        let frac_2pi4096_sr = ctx.sample_rate.frac_2pi4096_sr();
+        let half_sr = fixedmath::U16F0::from_bits(ctx.sample_rate.value() >> 1);
+        for i in 0..numsamples {
+            // Oscillator sync only needs the current sample's flag, so the
+            // master/slave handoff happens through a local instead of the
+            // shared sync buffer:
+            let mut sync = params.sync[i];
+            let osc1_out = self.osc1.tick(
+                frac_2pi4096_sr,
+                note[i],
+                &osc1_p,
+                waves1,
+                OscSyncTick::Master(&mut sync),
+                i,
+            );
+            let osc2_out = self.osc2.tick(
+                frac_2pi4096_sr,
+                note[i],
+                &osc2_p,
+                waves2,
+                OscSyncTick::Slave(sync),
+                i,
+            );
+            let ring_out = RingModFxP::tick(osc1_out, osc2_out, &ring_p, i);
+            let filt_env = self.env_filt.tick(half_sr, gate[i], &filt_env_p, i);
+            let filt_out = self.filt.tick(
+                frac_2pi4096_sr,
+                ring_out,
+                filt_env,
+                note[i],
+                vel[i],
+                &filt_p,
+                i,
+            );
+            let amp_env = self.env_amp.tick(half_sr, gate[i], &amp_env_p, i);
+            self.vcabuf[i] = AmpFxP::tick(filt_out, SampleFxP::from_num(amp_env));
+        }
+        &self.vcabuf[0..numsamples]
+    }
+    /// Returns true if the amplifier envelope has been released and decayed
+    /// to silence (see [EnvFxP::is_idle]), so this voice's output is
+    /// inaudible and processing may be skipped until the next note on
+    pub fn is_idle(&self) -> bool {
+        self.env_amp.is_idle()
+    }
+    /// Get the current level of the amplifier envelope - a cheap proxy for
+    /// how loud this voice is, for callers deciding which voice to steal
+    /// or shed
+    pub fn amp_env_value(&self) -> ScalarFxP {
+        self.env_amp.value()
+    }
+    /// Take and reset the per-stage timing profile accumulated by this
+    /// voice's calls to [VoiceFxP::process] (see [crate::profiling])
+    #[cfg(feature = "profile")]
+    pub fn take_profile(&mut self) -> profiling::StageProfile {
+        core::mem::take(&mut self.profile)
     }
 }
 
-impl Default for VoiceFxP {
+impl<O: OscEngineFxP> Default for VoiceFxP<O> {
     fn default() -> Self {
         Self::new()
     }
@@ -214,6 +394,12 @@ pub struct VoiceParams<'a, Smp: Float> {
     pub sync: &'a mut [Smp],
     /// Oscillator 1
     pub osc1_p: MutMixOscParams<'a, Smp>,
+    /// The number of unison sub-oscillators to run for oscillator 1, from 1
+    /// (no unison) to [UNISON_MAX]
+    pub unison_voices: usize,
+    /// The unison detune spread for oscillator 1, in semitones (see
+    /// [UnisonOscParams])
+    pub unison_detune: &'a [Smp],
     /// Oscillator 2
     pub osc2_p: MutMixOscParams<'a, Smp>,
     /// Ring-Mod
@@ -241,6 +427,7 @@ impl<'a, Smp: Float> VoiceParams<'a, Smp> {
         min_size(&[
             self.sync.len(),
             self.osc1_p.len(),
+            self.unison_detune.len(),
             self.osc2_p.len(),
             self.ring_p.len(),
             self.filt_p.len(),
@@ -265,7 +452,7 @@ impl<'a, Smp: Float> VoiceParams<'a, Smp> {
 /// This implementation uses floating point logic
 #[derive(Clone)]
 pub struct Voice<Smp: Float> {
-    osc1: MixOsc<Smp>,
+    osc1: UnisonOsc<Smp>,
     osc2: MixOsc<Smp>,
     ringmod: RingMod<Smp>,
     filt: ModFilt<Smp>,
@@ -273,13 +460,20 @@ pub struct Voice<Smp: Float> {
     env_filt: Env<Smp>,
     vca: Amp<Smp>,
     modsection: ModSection<Smp>,
+
+    // Only written by the fused path, which is not selected when profiling:
+    #[cfg_attr(feature = "profile", allow(dead_code))]
+    outbuf: BufferT<Smp>,
+
+    #[cfg(feature = "profile")]
+    profile: profiling::StageProfile,
 }
 
 impl<Smp: Float> Voice<Smp> {
     /// Constructor
     pub fn new() -> Self {
         Self {
-            osc1: MixOsc::new(),
+            osc1: UnisonOsc::new(),
             osc2: MixOsc::new(),
             ringmod: RingMod::new(),
             filt: ModFilt::new(),
@@ -287,12 +481,15 @@ impl<Smp: Float> Voice<Smp> {
             env_filt: Env::new(),
             vca: Amp::new(),
             modsection: Default::default(),
+            outbuf: [Smp::ZERO; STATIC_BUFFER_SIZE],
+            #[cfg(feature = "profile")]
+            profile: Default::default(),
         }
     }
     /// Constructor
     pub fn new_with_seeds(seeda: u64, seedb: u64) -> Self {
         Self {
-            osc1: MixOsc::new(),
+            osc1: UnisonOsc::new(),
             osc2: MixOsc::new(),
             ringmod: RingMod::new(),
             filt: ModFilt::new(),
@@ -300,6 +497,9 @@ impl<Smp: Float> Voice<Smp> {
             env_filt: Env::new(),
             vca: Amp::new(),
             modsection: ModSection::new_with_seeds(seeda, seedb),
+            outbuf: [Smp::ZERO; STATIC_BUFFER_SIZE],
+            #[cfg(feature = "profile")]
+            profile: Default::default(),
         }
     }
     /// Process the note/gate inputs, passing the parameters to the relevant
@@ -327,6 +527,7 @@ impl<Smp: Float> Voice<Smp> {
         aftertouch: &[Smp],
         modwheel: &[Smp],
         mut params: VoiceParams<Smp>,
+        scratch: &mut OscScratch<Smp>,
     ) -> &[Smp] {
         let numsamples = min_size(&[
             note.len(),
@@ -337,6 +538,18 @@ impl<Smp: Float> Voice<Smp> {
             params.len(),
             STATIC_BUFFER_SIZE,
         ]);
+        // Small blocks run the whole chain sample-by-sample in a single fused
+        // loop (see [FUSED_BLOCK_MAX]).  The per-stage timing attribution
+        // below requires the buffer-at-a-time path, so the fused kernel is
+        // not selected when profiling:
+        #[cfg(not(feature = "profile"))]
+        if numsamples <= FUSED_BLOCK_MAX {
+            return self.process_fused(
+                ctx, matrix, note, gate, vel, aftertouch, modwheel, params, numsamples,
+            );
+        }
+        #[cfg(feature = "profile")]
+        let mut timer = profiling::StageTimer::new(&mut self.profile);
         // Build the ModMatrix
         let modparams = modulation::ModSectionParams {
             velocity: vel,
@@ -357,27 +570,158 @@ impl<Smp: Float> Voice<Smp> {
         modulation.modulate_env(&mut params.filt_env_p, &modulation::ENV_FILT_MOD_DEST);
         modulation.modulate_env(&mut params.amp_env_p, &modulation::ENV_AMP_MOD_DEST);
         modulation.modulate_filt(&mut params.filt_p);
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::ModSection);
         let osc1_out = self.osc1.process(
             ctx,
             &note[0..numsamples],
-            params.osc1_p.with_sync(OscSync::Master(params.sync)).into(),
+            UnisonOscParams {
+                osc: params.osc1_p.with_sync(OscSync::Master(params.sync)).into(),
+                detune: params.unison_detune,
+                voices: params.unison_voices,
+            },
+            scratch,
         );
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::Osc1);
         let osc2_out = self.osc2.process(
             ctx,
             &note[0..numsamples],
             params.osc2_p.with_sync(OscSync::Slave(params.sync)).into(),
+            scratch,
         );
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::Osc2);
         let ring_mod_out = self.ringmod.process(ctx, osc1_out, osc2_out, params.ring_p.into());
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::RingMod);
         let filt_env_out = self
             .env_filt
             .process(ctx, &gate[0..numsamples], params.filt_env_p.into());
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::FiltEnv);
         let filt_out = self
             .filt
             .process(ctx, ring_mod_out, filt_env_out, note, vel, params.filt_p.into());
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::Filt);
         let vca_env_out = self
             .env_amp
             .process(ctx, &gate[0..numsamples], params.amp_env_p.into());
-        self.vca.process(filt_out, vca_env_out)
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::AmpEnv);
+        let out = self.vca.process(filt_out, vca_env_out);
+        #[cfg(feature = "profile")]
+        timer.mark(profiling::Stage::Vca);
+        out
+    }
+    /// The fused single-pass implementation of [Voice::process], used for
+    /// small blocks (see [FUSED_BLOCK_MAX]).  The whole device chain runs
+    /// sample-by-sample in one loop via the devices' `tick` entry points,
+    /// keeping the intermediate signals in registers instead of streaming
+    /// them through per-device buffers (and leaving the [OscScratch]
+    /// untouched).  Not selected when profiling (see [Voice::process]), but
+    /// still compiled so the fused kernel builds under every feature
+    /// combination.
+    #[cfg_attr(feature = "profile", allow(dead_code))]
+    fn process_fused(
+        &mut self,
+        ctx: &Context<Smp>,
+        matrix: &ModMatrix<Smp>,
+        note: &[Smp],
+        gate: &[Smp],
+        vel: &[Smp],
+        aftertouch: &[Smp],
+        modwheel: &[Smp],
+        mut params: VoiceParams<Smp>,
+        numsamples: usize,
+    ) -> &[Smp] {
+        // Build the ModMatrix and modulate the parameters, exactly as in the
+        // buffer-at-a-time path:
+        let modparams = modulation::ModSectionParams {
+            velocity: vel,
+            aftertouch,
+            modwheel,
+            lfo1_params: params.lfo1_p,
+            lfo2_params: params.lfo2_p,
+            env1_params: params.env1_p,
+            env2_params: params.env2_p,
+        };
+        let modulation = self
+            .modsection
+            .process(ctx, &gate[0..numsamples], modparams, matrix);
+        modulation.modulate_osc(&mut params.osc1_p, &modulation::OSC1_MOD_DEST);
+        modulation.modulate_osc(&mut params.osc2_p, &modulation::OSC2_MOD_DEST);
+        modulation.modulate_ring(&mut params.ring_p);
+        modulation.modulate_env(&mut params.filt_env_p, &modulation::ENV_FILT_MOD_DEST);
+        modulation.modulate_env(&mut params.amp_env_p, &modulation::ENV_AMP_MOD_DEST);
+        modulation.modulate_filt(&mut params.filt_p);
+        // We don't need any of the params to be mutable now
+        let osc1_p = UnisonOscParams {
+            osc: params.osc1_p.into(),
+            detune: params.unison_detune,
+            voices: params.unison_voices,
+        };
+        let osc2_p: MixOscParams<Smp> = params.osc2_p.into();
+        let ring_p: RingModParams<Smp> = params.ring_p.into();
+        let filt_env_p: EnvParams<Smp> = params.filt_env_p.into();
+        let amp_env_p: EnvParams<Smp> = params.amp_env_p.into();
+        let filt_p: ModFiltParams<Smp> = params.filt_p.into();
+        // The waveform masks and derived sample rate constants are all
+        // loop-invariant:
+        let waves1 = osc1_p.osc.waveforms();
+        let waves2 = osc2_p.waveforms();
+        let tau_over_sr = Smp::TAU() / ctx.sample_rate;
+        let pi_over_sr = Smp::PI() / ctx.sample_rate;
+        let half_sr = ctx.sample_rate / Smp::TWO;
+        for i in 0..numsamples {
+            // Oscillator sync only needs the current sample's flag, so the
+            // master/slave handoff happens through a local instead of the
+            // shared sync buffer:
+            let mut sync = params.sync[i];
+            let osc1_out = self.osc1.tick(
+                tau_over_sr,
+                note[i],
+                &osc1_p,
+                waves1,
+                OscSyncTick::Master(&mut sync),
+                i,
+            );
+            let osc2_out = self.osc2.tick(
+                tau_over_sr,
+                note[i],
+                &osc2_p,
+                waves2,
+                OscSyncTick::Slave(sync),
+                i,
+            );
+            let ring_out = RingMod::tick(osc1_out, osc2_out, &ring_p, i);
+            let filt_env = self.env_filt.tick(half_sr, gate[i], &filt_env_p, i);
+            let filt_out = self
+                .filt
+                .tick(pi_over_sr, ring_out, filt_env, note[i], vel[i], &filt_p, i);
+            let amp_env = self.env_amp.tick(half_sr, gate[i], &amp_env_p, i);
+            self.outbuf[i] = Amp::tick(filt_out, amp_env);
+        }
+        &self.outbuf[0..numsamples]
+    }
+    /// Returns true if the amplifier envelope has been released and decayed
+    /// to silence (see [Env::is_idle]), so this voice's output is inaudible
+    /// and processing may be skipped until the next note on
+    pub fn is_idle(&self) -> bool {
+        self.env_amp.is_idle()
+    }
+    /// Get the current level of the amplifier envelope - a cheap proxy for
+    /// how loud this voice is, for callers deciding which voice to steal
+    /// or shed
+    pub fn amp_env_value(&self) -> Smp {
+        self.env_amp.value()
+    }
+    /// Take and reset the per-stage timing profile accumulated by this
+    /// voice's calls to [Voice::process] (see [crate::profiling])
+    #[cfg(feature = "profile")]
+    pub fn take_profile(&mut self) -> profiling::StageProfile {
+        core::mem::take(&mut self.profile)
     }
 }
 
@@ -386,3 +730,221 @@ impl<Smp: Float> Default for Voice<Smp> {
         Self::new()
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::{EnvParamFxP, LfoFreqFxP, SignedNoteFxP};
+
+    /// The per-sample absolute tolerance for the fused-vs-modular
+    /// comparison.  The two paths evaluate the same per-sample arithmetic,
+    /// but the fused kernel keeps intermediate signals in registers instead
+    /// of rounding them through the per-device buffers, so individual
+    /// samples may differ by a few ulps of accumulated rounding - well under
+    /// this bound, which is about -40dBFS.
+    const FUSED_TOLERANCE: SampleFxP = SampleFxP::lit("0.01");
+
+    /// Parameter buffers for a basic patch (osc1 saw, full sustain, open
+    /// low-pass filter, zero LFO depth).  Each voice under test gets its own
+    /// instance since the modulation section writes into the mutable
+    /// parameter slices.
+    struct PatchBufs {
+        sync: BufferT<ScalarFxP>,
+        unison_detune: BufferT<ScalarFxP>,
+        tune: [BufferT<SignedNoteFxP>; 2],
+        shape: [BufferT<ScalarFxP>; 2],
+        // sin/sq/tri/saw for osc1 then osc2:
+        mix: [BufferT<ScalarFxP>; 8],
+        // mix_out/mix_a/mix_b:
+        ring: [BufferT<ScalarFxP>; 3],
+        // env_mod/vel_mod/kbd/resonance/low_mix/band_mix/high_mix:
+        filt_scalar: [BufferT<ScalarFxP>; 7],
+        filt_cutoff: BufferT<NoteFxP>,
+        // attack/decay/release for env_filt, env_amp, env1, then env2:
+        env_time: [BufferT<EnvParamFxP>; 12],
+        // sustain for env_filt, env_amp, env1, then env2:
+        env_sus: [BufferT<ScalarFxP>; 4],
+        lfo_freq: [BufferT<LfoFreqFxP>; 2],
+        lfo_depth: [BufferT<ScalarFxP>; 2],
+        lfo_opts: [BufferT<LfoOptions>; 2],
+    }
+
+    impl PatchBufs {
+        fn new() -> Self {
+            let mut mix = [[ScalarFxP::ZERO; STATIC_BUFFER_SIZE]; 8];
+            mix[3] = [ScalarFxP::MAX; STATIC_BUFFER_SIZE]; // osc1 saw
+            let mut ring = [[ScalarFxP::ZERO; STATIC_BUFFER_SIZE]; 3];
+            ring[1] = [ScalarFxP::MAX; STATIC_BUFFER_SIZE]; // mix_a
+            let mut filt_scalar = [[ScalarFxP::ZERO; STATIC_BUFFER_SIZE]; 7];
+            filt_scalar[4] = [ScalarFxP::MAX; STATIC_BUFFER_SIZE]; // low_mix
+            Self {
+                sync: [ScalarFxP::ZERO; STATIC_BUFFER_SIZE],
+                unison_detune: [ScalarFxP::ZERO; STATIC_BUFFER_SIZE],
+                tune: [[SignedNoteFxP::ZERO; STATIC_BUFFER_SIZE]; 2],
+                shape: [[ScalarFxP::ZERO; STATIC_BUFFER_SIZE]; 2],
+                mix,
+                ring,
+                filt_scalar,
+                filt_cutoff: [NoteFxP::lit("127"); STATIC_BUFFER_SIZE],
+                env_time: [[EnvParamFxP::lit("0.1"); STATIC_BUFFER_SIZE]; 12],
+                env_sus: [[ScalarFxP::MAX; STATIC_BUFFER_SIZE]; 4],
+                lfo_freq: [[LfoFreqFxP::ONE; STATIC_BUFFER_SIZE]; 2],
+                lfo_depth: [[ScalarFxP::ZERO; STATIC_BUFFER_SIZE]; 2],
+                lfo_opts: [[LfoOptions::default(); STATIC_BUFFER_SIZE]; 2],
+            }
+        }
+        fn params(&mut self) -> VoiceParamsFxP {
+            let [tune1, tune2] = &mut self.tune;
+            let [shape1, shape2] = &mut self.shape;
+            let [m1_sin, m1_sq, m1_tri, m1_saw, m2_sin, m2_sq, m2_tri, m2_saw] = &mut self.mix;
+            let [ring_out, ring_a, ring_b] = &mut self.ring;
+            let [f_em, f_vm, f_kbd, f_res, f_low, f_band, f_high] = &mut self.filt_scalar;
+            let [fe_a, fe_d, fe_r, ae_a, ae_d, ae_r, e1_a, e1_d, e1_r, e2_a, e2_d, e2_r] =
+                &mut self.env_time;
+            let [filt_sus, amp_sus, env1_sus, env2_sus] = &mut self.env_sus;
+            let [lfo1_freq, lfo2_freq] = &mut self.lfo_freq;
+            let [lfo1_depth, lfo2_depth] = &mut self.lfo_depth;
+            let [lfo1_opts, lfo2_opts] = &mut self.lfo_opts;
+            VoiceParamsFxP {
+                sync: &mut self.sync,
+                osc1_p: MutMixOscParamsFxP {
+                    tune: tune1,
+                    shape: shape1,
+                    sync: OscSync::Off,
+                    sin: m1_sin,
+                    sq: m1_sq,
+                    tri: m1_tri,
+                    saw: m1_saw,
+                },
+                unison_voices: 1,
+                unison_detune: &self.unison_detune,
+                osc2_p: MutMixOscParamsFxP {
+                    tune: tune2,
+                    shape: shape2,
+                    sync: OscSync::Off,
+                    sin: m2_sin,
+                    sq: m2_sq,
+                    tri: m2_tri,
+                    saw: m2_saw,
+                },
+                ring_p: MutRingModParamsFxP {
+                    mix_out: ring_out,
+                    mix_a: ring_a,
+                    mix_b: ring_b,
+                },
+                filt_p: MutModFiltParamsFxP {
+                    env_mod: f_em,
+                    vel_mod: f_vm,
+                    kbd: f_kbd,
+                    cutoff: &mut self.filt_cutoff,
+                    resonance: f_res,
+                    low_mix: f_low,
+                    band_mix: f_band,
+                    high_mix: f_high,
+                    oversample: FiltOversample::Off,
+                },
+                filt_env_p: MutEnvParamsFxP {
+                    attack: fe_a,
+                    decay: fe_d,
+                    sustain: filt_sus,
+                    release: fe_r,
+                },
+                amp_env_p: MutEnvParamsFxP {
+                    attack: ae_a,
+                    decay: ae_d,
+                    sustain: amp_sus,
+                    release: ae_r,
+                },
+                lfo1_p: LfoParamsFxP {
+                    freq: lfo1_freq,
+                    depth: lfo1_depth,
+                    opts: lfo1_opts,
+                },
+                lfo2_p: MutLfoParamsFxP {
+                    freq: lfo2_freq,
+                    depth: lfo2_depth,
+                    opts: lfo2_opts,
+                },
+                env1_p: EnvParamsFxP {
+                    attack: e1_a,
+                    decay: e1_d,
+                    sustain: env1_sus,
+                    release: e1_r,
+                },
+                env2_p: MutEnvParamsFxP {
+                    attack: e2_a,
+                    decay: e2_d,
+                    sustain: env2_sus,
+                    release: e2_r,
+                },
+            }
+        }
+    }
+
+    /// The fused single-pass kernel and the buffer-at-a-time device chain
+    /// must produce the same output for identical inputs, within
+    /// [FUSED_TOLERANCE].  The comparison runs enough blocks to cover the
+    /// attack, sustain, and release segments of the envelopes.
+    #[test]
+    fn fused_matches_modular() {
+        // The modular path is only selected for blocks larger than
+        // [FUSED_BLOCK_MAX], so with small device buffers there is nothing
+        // to compare against:
+        if STATIC_BUFFER_SIZE <= FUSED_BLOCK_MAX {
+            return;
+        }
+        let ctx = ContextFxP::default();
+        let matrix = ModMatrixFxP::default();
+        let mut modular: VoiceFxP = VoiceFxP::new();
+        let mut fused: VoiceFxP = VoiceFxP::new();
+        let mut scratch = OscScratch::new();
+        let mut modular_out = [SampleFxP::ZERO; STATIC_BUFFER_SIZE];
+        let note = [NoteFxP::lit("69"); STATIC_BUFFER_SIZE];
+        let vel = [ScalarFxP::lit("0.8"); STATIC_BUFFER_SIZE];
+        let zero = [ScalarFxP::ZERO; STATIC_BUFFER_SIZE];
+        let gate_on = [SampleFxP::ONE; STATIC_BUFFER_SIZE];
+        let gate_off = [SampleFxP::ZERO; STATIC_BUFFER_SIZE];
+        // Eight gated blocks (attack into sustain), then four released:
+        for block in 0..12 {
+            let gate = if block < 8 { &gate_on } else { &gate_off };
+            // Fresh parameter buffers per block, since the modulation
+            // section writes into them:
+            let mut modular_patch = PatchBufs::new();
+            let mut fused_patch = PatchBufs::new();
+            let out = modular.process(
+                &ctx,
+                &matrix,
+                &note,
+                gate,
+                &vel,
+                &zero,
+                &zero,
+                modular_patch.params(),
+                &mut scratch,
+            );
+            assert_eq!(out.len(), STATIC_BUFFER_SIZE);
+            modular_out.copy_from_slice(out);
+            let fused_out = fused.process_fused(
+                &ctx,
+                &matrix,
+                &note,
+                gate,
+                &vel,
+                &zero,
+                &zero,
+                fused_patch.params(),
+                STATIC_BUFFER_SIZE,
+            );
+            for (i, (a, b)) in modular_out.iter().zip(fused_out.iter()).enumerate() {
+                assert!(
+                    (*a - *b).abs() <= FUSED_TOLERANCE,
+                    "block {} sample {}: modular {} vs. fused {}",
+                    block,
+                    i,
+                    a,
+                    b
+                );
+            }
+        }
+    }
+}
@@ -0,0 +1,789 @@
+//! A fixed-size bank of voices sharing a single parameter stream and
+//! processed in lockstep.
+//!
+//! The typical polyphonic load is many voices running the identical signal
+//! chain against the same parameter data, differing only in their note/gate/
+//! velocity inputs.  Processing each voice over a whole block in turn means
+//! every voice re-streams the full-block parameter buffers through the data
+//! cache.  [VoiceBankFxP] instead advances all of its voices a small chunk
+//! at a time: the chunk of parameter data is copied once into a single
+//! internal scratch pack that stays resident in cache while every voice
+//! consumes it, and the device code stays hot (in the XIP cache on RP2040)
+//! across the voice sweep.
+//!
+//! The voice state itself deliberately remains array-of-structs.  A full
+//! structure-of-arrays layout would require an N-way rewrite of every device
+//! kernel, and the fixed-point kernels do not vectorize across voices anyway
+//! (widening multiplies, per-sample piecewise branches), so the chunked
+//! lockstep captures the locality benefit without duplicating the DSP.
+
+use super::modulation::ModMatrixFxP;
+use super::{VoiceFxP, VoiceParamsFxP};
+use crate::context::ContextFxP;
+use crate::devices::*;
+use crate::{min_size, BufferT, STATIC_BUFFER_SIZE};
+use crate::{EnvParamFxP, LfoFreqFxP, NoteFxP, SampleFxP, ScalarFxP, SignedNoteFxP};
+
+/// The number of samples all voices advance before any voice moves on to the
+/// next chunk.  The shared parameter scratch spans this many samples, so it
+/// should be small enough that the scratch (and each voice's state) stays
+/// cache-resident across the voice sweep.
+const LOCKSTEP_CHUNK: usize = 32;
+
+/// The per-voice control inputs for a [VoiceBankFxP].  The parameters are
+/// shared across the bank (see [VoiceBankParamsFxP]); only these differ from
+/// voice to voice.
+pub struct VoiceBankInputFxP<'a> {
+    /// The MIDI note number signal for this voice
+    pub note: &'a [NoteFxP],
+    /// The gate signal for this voice (see [VoiceFxP::process])
+    pub gate: &'a [SampleFxP],
+    /// The note on velocity signal for this voice
+    pub vel: &'a [ScalarFxP],
+}
+
+impl<'a> VoiceBankInputFxP<'a> {
+    /// The length of this input, defined as the length of the shortest
+    /// subslice
+    pub fn len(&self) -> usize {
+        min_size(&[self.note.len(), self.gate.len(), self.vel.len()])
+    }
+    /// True if any subslice is empty
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+/// The parameter data shared by every voice in a [VoiceBankFxP].  Unlike
+/// [VoiceParamsFxP] all slices here are immutable - the bank copies each
+/// chunk into an internal scratch pack per voice, since the modulation
+/// section writes the modulated values (and the oscillator sync data) in
+/// place and each voice's modulators are independent.
+pub struct VoiceBankParamsFxP<'a> {
+    /// Oscillator sync enable (see [VoiceFxP::process])
+    pub sync: &'a [ScalarFxP],
+    /// Oscillator 1 tuning offset, in semitones
+    pub osc1_tune: &'a [SignedNoteFxP],
+    /// Oscillator 1 shape (phase distortion)
+    pub osc1_shape: &'a [ScalarFxP],
+    /// Oscillator 1 sine wave gain
+    pub osc1_sin: &'a [ScalarFxP],
+    /// Oscillator 1 square wave gain
+    pub osc1_sq: &'a [ScalarFxP],
+    /// Oscillator 1 triangle wave gain
+    pub osc1_tri: &'a [ScalarFxP],
+    /// Oscillator 1 sawtooth wave gain
+    pub osc1_saw: &'a [ScalarFxP],
+    /// Oscillator 2 tuning offset, in semitones
+    pub osc2_tune: &'a [SignedNoteFxP],
+    /// Oscillator 2 shape (phase distortion)
+    pub osc2_shape: &'a [ScalarFxP],
+    /// Oscillator 2 sine wave gain
+    pub osc2_sin: &'a [ScalarFxP],
+    /// Oscillator 2 square wave gain
+    pub osc2_sq: &'a [ScalarFxP],
+    /// Oscillator 2 triangle wave gain
+    pub osc2_tri: &'a [ScalarFxP],
+    /// Oscillator 2 sawtooth wave gain
+    pub osc2_saw: &'a [ScalarFxP],
+    /// Ring modulator wet mix
+    pub ring_mix_out: &'a [ScalarFxP],
+    /// Ring modulator oscillator 1 dry mix
+    pub ring_mix_a: &'a [ScalarFxP],
+    /// Ring modulator oscillator 2 dry mix
+    pub ring_mix_b: &'a [ScalarFxP],
+    /// Filter envelope modulation amount
+    pub filt_env_mod: &'a [ScalarFxP],
+    /// Filter velocity modulation amount
+    pub filt_vel_mod: &'a [ScalarFxP],
+    /// Filter keyboard tracking amount
+    pub filt_kbd: &'a [ScalarFxP],
+    /// Filter cutoff frequency, as a MIDI note number
+    pub filt_cutoff: &'a [NoteFxP],
+    /// Filter resonance
+    pub filt_resonance: &'a [ScalarFxP],
+    /// Filter low-pass output mix
+    pub filt_low_mix: &'a [ScalarFxP],
+    /// Filter band-pass output mix
+    pub filt_band_mix: &'a [ScalarFxP],
+    /// Filter high-pass output mix
+    pub filt_high_mix: &'a [ScalarFxP],
+    /// Filter envelope attack
+    pub env_filt_attack: &'a [EnvParamFxP],
+    /// Filter envelope decay
+    pub env_filt_decay: &'a [EnvParamFxP],
+    /// Filter envelope sustain
+    pub env_filt_sustain: &'a [ScalarFxP],
+    /// Filter envelope release
+    pub env_filt_release: &'a [EnvParamFxP],
+    /// VCA envelope attack
+    pub env_amp_attack: &'a [EnvParamFxP],
+    /// VCA envelope decay
+    pub env_amp_decay: &'a [EnvParamFxP],
+    /// VCA envelope sustain
+    pub env_amp_sustain: &'a [ScalarFxP],
+    /// VCA envelope release
+    pub env_amp_release: &'a [EnvParamFxP],
+    /// LFO 1 frequency, in Hz
+    pub lfo1_freq: &'a [LfoFreqFxP],
+    /// LFO 1 depth
+    pub lfo1_depth: &'a [ScalarFxP],
+    /// LFO 1 options (see [LfoOptions])
+    pub lfo1_opts: &'a [LfoOptions],
+    /// LFO 2 frequency, in Hz
+    pub lfo2_freq: &'a [LfoFreqFxP],
+    /// LFO 2 depth
+    pub lfo2_depth: &'a [ScalarFxP],
+    /// LFO 2 options (see [LfoOptions])
+    pub lfo2_opts: &'a [LfoOptions],
+    /// Modulation envelope 1 attack
+    pub env1_attack: &'a [EnvParamFxP],
+    /// Modulation envelope 1 decay
+    pub env1_decay: &'a [EnvParamFxP],
+    /// Modulation envelope 1 sustain
+    pub env1_sustain: &'a [ScalarFxP],
+    /// Modulation envelope 1 release
+    pub env1_release: &'a [EnvParamFxP],
+    /// Modulation envelope 2 attack
+    pub env2_attack: &'a [EnvParamFxP],
+    /// Modulation envelope 2 decay
+    pub env2_decay: &'a [EnvParamFxP],
+    /// Modulation envelope 2 sustain
+    pub env2_sustain: &'a [ScalarFxP],
+    /// Modulation envelope 2 release
+    pub env2_release: &'a [EnvParamFxP],
+}
+
+impl<'a> VoiceBankParamsFxP<'a> {
+    /// The length of this parameter pack, defined as the length of the
+    /// shortest subslice
+    pub fn len(&self) -> usize {
+        min_size(&[
+            self.sync.len(),
+            self.osc1_tune.len(),
+            self.osc1_shape.len(),
+            self.osc1_sin.len(),
+            self.osc1_sq.len(),
+            self.osc1_tri.len(),
+            self.osc1_saw.len(),
+            self.osc2_tune.len(),
+            self.osc2_shape.len(),
+            self.osc2_sin.len(),
+            self.osc2_sq.len(),
+            self.osc2_tri.len(),
+            self.osc2_saw.len(),
+            self.ring_mix_out.len(),
+            self.ring_mix_a.len(),
+            self.ring_mix_b.len(),
+            self.filt_env_mod.len(),
+            self.filt_vel_mod.len(),
+            self.filt_kbd.len(),
+            self.filt_cutoff.len(),
+            self.filt_resonance.len(),
+            self.filt_low_mix.len(),
+            self.filt_band_mix.len(),
+            self.filt_high_mix.len(),
+            self.env_filt_attack.len(),
+            self.env_filt_decay.len(),
+            self.env_filt_sustain.len(),
+            self.env_filt_release.len(),
+            self.env_amp_attack.len(),
+            self.env_amp_decay.len(),
+            self.env_amp_sustain.len(),
+            self.env_amp_release.len(),
+            self.lfo1_freq.len(),
+            self.lfo1_depth.len(),
+            self.lfo1_opts.len(),
+            self.lfo2_freq.len(),
+            self.lfo2_depth.len(),
+            self.lfo2_opts.len(),
+            self.env1_attack.len(),
+            self.env1_decay.len(),
+            self.env1_sustain.len(),
+            self.env1_release.len(),
+            self.env2_attack.len(),
+            self.env2_decay.len(),
+            self.env2_sustain.len(),
+            self.env2_release.len(),
+        ])
+    }
+    /// True if any subslice is empty
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+/// One [LOCKSTEP_CHUNK]-sized copy of every mutable parameter buffer, shared
+/// by all of the voices in the bank.  Grouping related buffers into arrays
+/// keeps this from being forty-odd named fields; the borrows are split back
+/// apart in `voice_params`.
+#[derive(Clone)]
+struct ParamScratch {
+    sync: [ScalarFxP; LOCKSTEP_CHUNK],
+    tune: [[SignedNoteFxP; LOCKSTEP_CHUNK]; 2],
+    shape: [[ScalarFxP; LOCKSTEP_CHUNK]; 2],
+    // sin/sq/tri/saw for osc1 then osc2:
+    mix: [[ScalarFxP; LOCKSTEP_CHUNK]; 8],
+    // mix_out/mix_a/mix_b:
+    ring: [[ScalarFxP; LOCKSTEP_CHUNK]; 3],
+    // env_mod/vel_mod/kbd/resonance/low_mix/band_mix/high_mix:
+    filt_scalar: [[ScalarFxP; LOCKSTEP_CHUNK]; 7],
+    filt_cutoff: [NoteFxP; LOCKSTEP_CHUNK],
+    // attack/decay/release for env_filt, env_amp, then env2:
+    env_time: [[EnvParamFxP; LOCKSTEP_CHUNK]; 9],
+    // sustain for env_filt, env_amp, then env2:
+    env_sus: [[ScalarFxP; LOCKSTEP_CHUNK]; 3],
+    lfo2_freq: [LfoFreqFxP; LOCKSTEP_CHUNK],
+    lfo2_depth: [ScalarFxP; LOCKSTEP_CHUNK],
+    lfo2_opts: [LfoOptions; LOCKSTEP_CHUNK],
+}
+
+impl ParamScratch {
+    fn new() -> Self {
+        Self {
+            sync: [ScalarFxP::ZERO; LOCKSTEP_CHUNK],
+            tune: [[SignedNoteFxP::ZERO; LOCKSTEP_CHUNK]; 2],
+            shape: [[ScalarFxP::ZERO; LOCKSTEP_CHUNK]; 2],
+            mix: [[ScalarFxP::ZERO; LOCKSTEP_CHUNK]; 8],
+            ring: [[ScalarFxP::ZERO; LOCKSTEP_CHUNK]; 3],
+            filt_scalar: [[ScalarFxP::ZERO; LOCKSTEP_CHUNK]; 7],
+            filt_cutoff: [NoteFxP::ZERO; LOCKSTEP_CHUNK],
+            env_time: [[EnvParamFxP::ZERO; LOCKSTEP_CHUNK]; 9],
+            env_sus: [[ScalarFxP::ZERO; LOCKSTEP_CHUNK]; 3],
+            lfo2_freq: [LfoFreqFxP::ZERO; LOCKSTEP_CHUNK],
+            lfo2_depth: [ScalarFxP::ZERO; LOCKSTEP_CHUNK],
+            lfo2_opts: [LfoOptions::default(); LOCKSTEP_CHUNK],
+        }
+    }
+    /// Copy `len` samples of parameter data starting at `offset` out of the
+    /// shared source into this scratch pack
+    fn copy_from(&mut self, src: &VoiceBankParamsFxP, offset: usize, len: usize) {
+        let r = offset..(offset + len);
+        self.sync[..len].copy_from_slice(&src.sync[r.clone()]);
+        self.tune[0][..len].copy_from_slice(&src.osc1_tune[r.clone()]);
+        self.tune[1][..len].copy_from_slice(&src.osc2_tune[r.clone()]);
+        self.shape[0][..len].copy_from_slice(&src.osc1_shape[r.clone()]);
+        self.shape[1][..len].copy_from_slice(&src.osc2_shape[r.clone()]);
+        self.mix[0][..len].copy_from_slice(&src.osc1_sin[r.clone()]);
+        self.mix[1][..len].copy_from_slice(&src.osc1_sq[r.clone()]);
+        self.mix[2][..len].copy_from_slice(&src.osc1_tri[r.clone()]);
+        self.mix[3][..len].copy_from_slice(&src.osc1_saw[r.clone()]);
+        self.mix[4][..len].copy_from_slice(&src.osc2_sin[r.clone()]);
+        self.mix[5][..len].copy_from_slice(&src.osc2_sq[r.clone()]);
+        self.mix[6][..len].copy_from_slice(&src.osc2_tri[r.clone()]);
+        self.mix[7][..len].copy_from_slice(&src.osc2_saw[r.clone()]);
+        self.ring[0][..len].copy_from_slice(&src.ring_mix_out[r.clone()]);
+        self.ring[1][..len].copy_from_slice(&src.ring_mix_a[r.clone()]);
+        self.ring[2][..len].copy_from_slice(&src.ring_mix_b[r.clone()]);
+        self.filt_scalar[0][..len].copy_from_slice(&src.filt_env_mod[r.clone()]);
+        self.filt_scalar[1][..len].copy_from_slice(&src.filt_vel_mod[r.clone()]);
+        self.filt_scalar[2][..len].copy_from_slice(&src.filt_kbd[r.clone()]);
+        self.filt_scalar[3][..len].copy_from_slice(&src.filt_resonance[r.clone()]);
+        self.filt_scalar[4][..len].copy_from_slice(&src.filt_low_mix[r.clone()]);
+        self.filt_scalar[5][..len].copy_from_slice(&src.filt_band_mix[r.clone()]);
+        self.filt_scalar[6][..len].copy_from_slice(&src.filt_high_mix[r.clone()]);
+        self.filt_cutoff[..len].copy_from_slice(&src.filt_cutoff[r.clone()]);
+        self.env_time[0][..len].copy_from_slice(&src.env_filt_attack[r.clone()]);
+        self.env_time[1][..len].copy_from_slice(&src.env_filt_decay[r.clone()]);
+        self.env_time[2][..len].copy_from_slice(&src.env_filt_release[r.clone()]);
+        self.env_time[3][..len].copy_from_slice(&src.env_amp_attack[r.clone()]);
+        self.env_time[4][..len].copy_from_slice(&src.env_amp_decay[r.clone()]);
+        self.env_time[5][..len].copy_from_slice(&src.env_amp_release[r.clone()]);
+        self.env_time[6][..len].copy_from_slice(&src.env2_attack[r.clone()]);
+        self.env_time[7][..len].copy_from_slice(&src.env2_decay[r.clone()]);
+        self.env_time[8][..len].copy_from_slice(&src.env2_release[r.clone()]);
+        self.env_sus[0][..len].copy_from_slice(&src.env_filt_sustain[r.clone()]);
+        self.env_sus[1][..len].copy_from_slice(&src.env_amp_sustain[r.clone()]);
+        self.env_sus[2][..len].copy_from_slice(&src.env2_sustain[r.clone()]);
+        self.lfo2_freq[..len].copy_from_slice(&src.lfo2_freq[r.clone()]);
+        self.lfo2_depth[..len].copy_from_slice(&src.lfo2_depth[r.clone()]);
+        self.lfo2_opts[..len].copy_from_slice(&src.lfo2_opts[r]);
+    }
+    /// Reborrow this scratch pack (truncated to `len` samples) as a
+    /// [VoiceParamsFxP], with the immutable pass-through parameters sliced
+    /// directly out of the shared source
+    fn voice_params<'a>(
+        &'a mut self,
+        src: &VoiceBankParamsFxP<'a>,
+        offset: usize,
+        len: usize,
+    ) -> VoiceParamsFxP<'a> {
+        let r = offset..(offset + len);
+        let [tune1, tune2] = &mut self.tune;
+        let [shape1, shape2] = &mut self.shape;
+        let [m1_sin, m1_sq, m1_tri, m1_saw, m2_sin, m2_sq, m2_tri, m2_saw] = &mut self.mix;
+        let [ring_out, ring_a, ring_b] = &mut self.ring;
+        let [f_em, f_vm, f_kbd, f_res, f_low, f_band, f_high] = &mut self.filt_scalar;
+        let [fe_a, fe_d, fe_r, ae_a, ae_d, ae_r, e2_a, e2_d, e2_r] = &mut self.env_time;
+        let [filt_sus, amp_sus, env2_sus] = &mut self.env_sus;
+        VoiceParamsFxP {
+            sync: &mut self.sync[..len],
+            osc1_p: MutMixOscParamsFxP {
+                tune: &mut tune1[..len],
+                shape: &mut shape1[..len],
+                sync: OscSync::Off,
+                sin: &mut m1_sin[..len],
+                sq: &mut m1_sq[..len],
+                tri: &mut m1_tri[..len],
+                saw: &mut m1_saw[..len],
+            },
+            unison_voices: 1,
+            unison_detune: fixed_zerobuf::<ScalarFxP>(),
+            osc2_p: MutMixOscParamsFxP {
+                tune: &mut tune2[..len],
+                shape: &mut shape2[..len],
+                sync: OscSync::Off,
+                sin: &mut m2_sin[..len],
+                sq: &mut m2_sq[..len],
+                tri: &mut m2_tri[..len],
+                saw: &mut m2_saw[..len],
+            },
+            ring_p: MutRingModParamsFxP {
+                mix_out: &mut ring_out[..len],
+                mix_a: &mut ring_a[..len],
+                mix_b: &mut ring_b[..len],
+            },
+            filt_p: MutModFiltParamsFxP {
+                env_mod: &mut f_em[..len],
+                vel_mod: &mut f_vm[..len],
+                kbd: &mut f_kbd[..len],
+                cutoff: &mut self.filt_cutoff[..len],
+                resonance: &mut f_res[..len],
+                low_mix: &mut f_low[..len],
+                band_mix: &mut f_band[..len],
+                high_mix: &mut f_high[..len],
+                oversample: FiltOversample::Off,
+            },
+            filt_env_p: MutEnvParamsFxP {
+                attack: &mut fe_a[..len],
+                decay: &mut fe_d[..len],
+                sustain: &mut filt_sus[..len],
+                release: &mut fe_r[..len],
+            },
+            amp_env_p: MutEnvParamsFxP {
+                attack: &mut ae_a[..len],
+                decay: &mut ae_d[..len],
+                sustain: &mut amp_sus[..len],
+                release: &mut ae_r[..len],
+            },
+            lfo1_p: LfoParamsFxP {
+                freq: &src.lfo1_freq[r.clone()],
+                depth: &src.lfo1_depth[r.clone()],
+                opts: &src.lfo1_opts[r.clone()],
+            },
+            lfo2_p: MutLfoParamsFxP {
+                freq: &mut self.lfo2_freq[..len],
+                depth: &mut self.lfo2_depth[..len],
+                opts: &mut self.lfo2_opts[..len],
+            },
+            env1_p: EnvParamsFxP {
+                attack: &src.env1_attack[r.clone()],
+                decay: &src.env1_decay[r.clone()],
+                sustain: &src.env1_sustain[r.clone()],
+                release: &src.env1_release[r],
+            },
+            env2_p: MutEnvParamsFxP {
+                attack: &mut e2_a[..len],
+                decay: &mut e2_d[..len],
+                sustain: &mut env2_sus[..len],
+                release: &mut e2_r[..len],
+            },
+        }
+    }
+}
+
+/// A fixed-size bank of [VoiceFxP]s processed in lockstep against a shared
+/// parameter stream (see the module-level documentation).  The voice outputs
+/// are accumulated with saturation into a single internal buffer - callers
+/// are responsible for any headroom scaling appropriate to the bank size.
+#[derive(Clone)]
+pub struct VoiceBankFxP<const N: usize> {
+    voices: [VoiceFxP; N],
+    params: ParamScratch,
+    scratch: OscScratch<SampleFxP>,
+    outbuf: BufferT<SampleFxP>,
+}
+
+impl<const N: usize> VoiceBankFxP<N> {
+    /// Constructor
+    pub fn new() -> Self {
+        Self {
+            voices: core::array::from_fn(|_| VoiceFxP::new()),
+            params: ParamScratch::new(),
+            scratch: OscScratch::new(),
+            outbuf: [SampleFxP::ZERO; STATIC_BUFFER_SIZE],
+        }
+    }
+    /// Access the voices in the bank, e.g. to check [VoiceFxP::is_idle]
+    pub fn voices(&self) -> &[VoiceFxP; N] {
+        &self.voices
+    }
+    /// Process all of the voices in the bank, accumulating their outputs
+    /// into a single internal buffer and returning a reference to it.
+    ///
+    /// Note: The output slice from this function may be shorter than the
+    /// input slices.  Callers must check the number of returned samples and
+    /// copy them into their own output buffers before calling this function
+    /// again to process the remainder of the data.
+    pub fn process(
+        &mut self,
+        ctx: &ContextFxP,
+        matrix: &ModMatrixFxP,
+        inputs: &[VoiceBankInputFxP; N],
+        aftertouch: &[ScalarFxP],
+        modwheel: &[ScalarFxP],
+        params: &VoiceBankParamsFxP,
+    ) -> &[SampleFxP] {
+        let mut numsamples = min_size(&[
+            params.len(),
+            aftertouch.len(),
+            modwheel.len(),
+            STATIC_BUFFER_SIZE,
+        ]);
+        for input in inputs.iter() {
+            numsamples = core::cmp::min(numsamples, input.len());
+        }
+        for smp in self.outbuf[0..numsamples].iter_mut() {
+            *smp = SampleFxP::ZERO;
+        }
+        let mut processed: usize = 0;
+        while processed < numsamples {
+            let chunk = core::cmp::min(LOCKSTEP_CHUNK, numsamples - processed);
+            let end = processed + chunk;
+            for (voice, input) in self.voices.iter_mut().zip(inputs.iter()) {
+                self.params.copy_from(params, processed, chunk);
+                let out = voice.process(
+                    ctx,
+                    matrix,
+                    &input.note[processed..end],
+                    &input.gate[processed..end],
+                    &input.vel[processed..end],
+                    &aftertouch[processed..end],
+                    &modwheel[processed..end],
+                    self.params.voice_params(params, processed, chunk),
+                    &mut self.scratch,
+                );
+                for (acc, smp) in self.outbuf[processed..end].iter_mut().zip(out.iter()) {
+                    *acc = acc.saturating_add(*smp);
+                }
+            }
+            processed = end;
+        }
+        &self.outbuf[0..numsamples]
+    }
+}
+
+impl<const N: usize> Default for VoiceBankFxP<N> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::voice::FUSED_BLOCK_MAX;
+
+    const NUM_VOICES: usize = 3;
+    /// The largest block fed to the bank in one driver iteration - big
+    /// enough to span multiple lockstep chunks plus a partial one.
+    const MAX_BLOCK: usize = 2 * LOCKSTEP_CHUNK + 7;
+
+    /// Parameter buffers for a basic patch (osc1 saw, full sustain, open
+    /// low-pass filter, zero LFO depth) - the same patch as the
+    /// fused-vs-modular test in the parent module.  One instance backs the
+    /// shared [VoiceBankParamsFxP] (which the bank never mutates); each
+    /// reference voice call gets its own fresh instance since the modulation
+    /// section writes into the mutable parameter slices.
+    struct PatchBufs {
+        sync: BufferT<ScalarFxP>,
+        unison_detune: BufferT<ScalarFxP>,
+        tune: [BufferT<SignedNoteFxP>; 2],
+        shape: [BufferT<ScalarFxP>; 2],
+        // sin/sq/tri/saw for osc1 then osc2:
+        mix: [BufferT<ScalarFxP>; 8],
+        // mix_out/mix_a/mix_b:
+        ring: [BufferT<ScalarFxP>; 3],
+        // env_mod/vel_mod/kbd/resonance/low_mix/band_mix/high_mix:
+        filt_scalar: [BufferT<ScalarFxP>; 7],
+        filt_cutoff: BufferT<NoteFxP>,
+        // attack/decay/release for env_filt, env_amp, env1, then env2:
+        env_time: [BufferT<EnvParamFxP>; 12],
+        // sustain for env_filt, env_amp, env1, then env2:
+        env_sus: [BufferT<ScalarFxP>; 4],
+        lfo_freq: [BufferT<LfoFreqFxP>; 2],
+        lfo_depth: [BufferT<ScalarFxP>; 2],
+        lfo_opts: [BufferT<LfoOptions>; 2],
+    }
+
+    impl PatchBufs {
+        fn new() -> Self {
+            let mut mix = [[ScalarFxP::ZERO; STATIC_BUFFER_SIZE]; 8];
+            mix[3] = [ScalarFxP::MAX; STATIC_BUFFER_SIZE]; // osc1 saw
+            let mut ring = [[ScalarFxP::ZERO; STATIC_BUFFER_SIZE]; 3];
+            ring[1] = [ScalarFxP::MAX; STATIC_BUFFER_SIZE]; // mix_a
+            let mut filt_scalar = [[ScalarFxP::ZERO; STATIC_BUFFER_SIZE]; 7];
+            filt_scalar[4] = [ScalarFxP::MAX; STATIC_BUFFER_SIZE]; // low_mix
+            Self {
+                sync: [ScalarFxP::ZERO; STATIC_BUFFER_SIZE],
+                unison_detune: [ScalarFxP::ZERO; STATIC_BUFFER_SIZE],
+                tune: [[SignedNoteFxP::ZERO; STATIC_BUFFER_SIZE]; 2],
+                shape: [[ScalarFxP::ZERO; STATIC_BUFFER_SIZE]; 2],
+                mix,
+                ring,
+                filt_scalar,
+                filt_cutoff: [NoteFxP::lit("127"); STATIC_BUFFER_SIZE],
+                env_time: [[EnvParamFxP::lit("0.1"); STATIC_BUFFER_SIZE]; 12],
+                env_sus: [[ScalarFxP::MAX; STATIC_BUFFER_SIZE]; 4],
+                lfo_freq: [[LfoFreqFxP::ONE; STATIC_BUFFER_SIZE]; 2],
+                lfo_depth: [[ScalarFxP::ZERO; STATIC_BUFFER_SIZE]; 2],
+                lfo_opts: [[LfoOptions::default(); STATIC_BUFFER_SIZE]; 2],
+            }
+        }
+        fn bank_params(&self) -> VoiceBankParamsFxP {
+            VoiceBankParamsFxP {
+                sync: &self.sync,
+                osc1_tune: &self.tune[0],
+                osc1_shape: &self.shape[0],
+                osc1_sin: &self.mix[0],
+                osc1_sq: &self.mix[1],
+                osc1_tri: &self.mix[2],
+                osc1_saw: &self.mix[3],
+                osc2_tune: &self.tune[1],
+                osc2_shape: &self.shape[1],
+                osc2_sin: &self.mix[4],
+                osc2_sq: &self.mix[5],
+                osc2_tri: &self.mix[6],
+                osc2_saw: &self.mix[7],
+                ring_mix_out: &self.ring[0],
+                ring_mix_a: &self.ring[1],
+                ring_mix_b: &self.ring[2],
+                filt_env_mod: &self.filt_scalar[0],
+                filt_vel_mod: &self.filt_scalar[1],
+                filt_kbd: &self.filt_scalar[2],
+                filt_cutoff: &self.filt_cutoff,
+                filt_resonance: &self.filt_scalar[3],
+                filt_low_mix: &self.filt_scalar[4],
+                filt_band_mix: &self.filt_scalar[5],
+                filt_high_mix: &self.filt_scalar[6],
+                env_filt_attack: &self.env_time[0],
+                env_filt_decay: &self.env_time[1],
+                env_filt_sustain: &self.env_sus[0],
+                env_filt_release: &self.env_time[2],
+                env_amp_attack: &self.env_time[3],
+                env_amp_decay: &self.env_time[4],
+                env_amp_sustain: &self.env_sus[1],
+                env_amp_release: &self.env_time[5],
+                lfo1_freq: &self.lfo_freq[0],
+                lfo1_depth: &self.lfo_depth[0],
+                lfo1_opts: &self.lfo_opts[0],
+                lfo2_freq: &self.lfo_freq[1],
+                lfo2_depth: &self.lfo_depth[1],
+                lfo2_opts: &self.lfo_opts[1],
+                env1_attack: &self.env_time[6],
+                env1_decay: &self.env_time[7],
+                env1_sustain: &self.env_sus[2],
+                env1_release: &self.env_time[8],
+                env2_attack: &self.env_time[9],
+                env2_decay: &self.env_time[10],
+                env2_sustain: &self.env_sus[3],
+                env2_release: &self.env_time[11],
+            }
+        }
+        fn voice_params(&mut self) -> VoiceParamsFxP {
+            let [tune1, tune2] = &mut self.tune;
+            let [shape1, shape2] = &mut self.shape;
+            let [m1_sin, m1_sq, m1_tri, m1_saw, m2_sin, m2_sq, m2_tri, m2_saw] = &mut self.mix;
+            let [ring_out, ring_a, ring_b] = &mut self.ring;
+            let [f_em, f_vm, f_kbd, f_res, f_low, f_band, f_high] = &mut self.filt_scalar;
+            let [fe_a, fe_d, fe_r, ae_a, ae_d, ae_r, e1_a, e1_d, e1_r, e2_a, e2_d, e2_r] =
+                &mut self.env_time;
+            let [filt_sus, amp_sus, env1_sus, env2_sus] = &mut self.env_sus;
+            let [lfo1_freq, lfo2_freq] = &mut self.lfo_freq;
+            let [lfo1_depth, lfo2_depth] = &mut self.lfo_depth;
+            let [lfo1_opts, lfo2_opts] = &mut self.lfo_opts;
+            VoiceParamsFxP {
+                sync: &mut self.sync,
+                osc1_p: MutMixOscParamsFxP {
+                    tune: tune1,
+                    shape: shape1,
+                    sync: OscSync::Off,
+                    sin: m1_sin,
+                    sq: m1_sq,
+                    tri: m1_tri,
+                    saw: m1_saw,
+                },
+                unison_voices: 1,
+                unison_detune: &self.unison_detune,
+                osc2_p: MutMixOscParamsFxP {
+                    tune: tune2,
+                    shape: shape2,
+                    sync: OscSync::Off,
+                    sin: m2_sin,
+                    sq: m2_sq,
+                    tri: m2_tri,
+                    saw: m2_saw,
+                },
+                ring_p: MutRingModParamsFxP {
+                    mix_out: ring_out,
+                    mix_a: ring_a,
+                    mix_b: ring_b,
+                },
+                filt_p: MutModFiltParamsFxP {
+                    env_mod: f_em,
+                    vel_mod: f_vm,
+                    kbd: f_kbd,
+                    cutoff: &mut self.filt_cutoff,
+                    resonance: f_res,
+                    low_mix: f_low,
+                    band_mix: f_band,
+                    high_mix: f_high,
+                    oversample: FiltOversample::Off,
+                },
+                filt_env_p: MutEnvParamsFxP {
+                    attack: fe_a,
+                    decay: fe_d,
+                    sustain: filt_sus,
+                    release: fe_r,
+                },
+                amp_env_p: MutEnvParamsFxP {
+                    attack: ae_a,
+                    decay: ae_d,
+                    sustain: amp_sus,
+                    release: ae_r,
+                },
+                lfo1_p: LfoParamsFxP {
+                    freq: lfo1_freq,
+                    depth: lfo1_depth,
+                    opts: lfo1_opts,
+                },
+                lfo2_p: MutLfoParamsFxP {
+                    freq: lfo2_freq,
+                    depth: lfo2_depth,
+                    opts: lfo2_opts,
+                },
+                env1_p: EnvParamsFxP {
+                    attack: e1_a,
+                    decay: e1_d,
+                    sustain: env1_sus,
+                    release: e1_r,
+                },
+                env2_p: MutEnvParamsFxP {
+                    attack: e2_a,
+                    decay: e2_d,
+                    sustain: env2_sus,
+                    release: e2_r,
+                },
+            }
+        }
+    }
+
+    /// The bank's chunked lockstep sweep (parameter scratch copy, in-place
+    /// borrow splitting, and saturating accumulation) must be equivalent to
+    /// running each voice independently over the same inputs.  The reference
+    /// voices are driven in blocks no larger than [FUSED_BLOCK_MAX] so that
+    /// both sides select the same (fused) kernel and the comparison is
+    /// bit-exact: the expected mix is the saturating sum of the reference
+    /// outputs in voice order, exactly as the bank accumulates them.  Block
+    /// lengths are chosen to straddle the lockstep chunk boundary, and the
+    /// gate drops partway through to cover the release segment.
+    #[test]
+    fn bank_matches_independent_voices() {
+        let ctx = ContextFxP::default();
+        let matrix = ModMatrixFxP::default();
+        let mut bank = VoiceBankFxP::<NUM_VOICES>::new();
+        let mut voices: [VoiceFxP; NUM_VOICES] = core::array::from_fn(|_| VoiceFxP::new());
+        let mut scratch = OscScratch::new();
+        let bank_patch = PatchBufs::new();
+        let notes = [NoteFxP::lit("57"), NoteFxP::lit("64"), NoteFxP::lit("69")];
+        let vels = [
+            ScalarFxP::lit("0.8"),
+            ScalarFxP::lit("0.6"),
+            ScalarFxP::lit("0.4"),
+        ];
+        let notebufs: [[NoteFxP; MAX_BLOCK]; NUM_VOICES] =
+            core::array::from_fn(|v| [notes[v]; MAX_BLOCK]);
+        let velbufs: [[ScalarFxP; MAX_BLOCK]; NUM_VOICES] =
+            core::array::from_fn(|v| [vels[v]; MAX_BLOCK]);
+        let zero = [ScalarFxP::ZERO; MAX_BLOCK];
+        let gate_on = [SampleFxP::ONE; MAX_BLOCK];
+        let gate_off = [SampleFxP::ZERO; MAX_BLOCK];
+        // Gated blocks (attack into sustain) straddling the chunk boundary
+        // from both sides, then released ones for the decay to silence:
+        let blocks = [
+            (LOCKSTEP_CHUNK - 1, true),
+            (LOCKSTEP_CHUNK, true),
+            (LOCKSTEP_CHUNK + 1, true),
+            (2 * LOCKSTEP_CHUNK + 7, true),
+            (LOCKSTEP_CHUNK / 2, true),
+            (LOCKSTEP_CHUNK + 3, false),
+            (2 * LOCKSTEP_CHUNK, false),
+            (LOCKSTEP_CHUNK - 5, false),
+        ];
+        let mut bank_out = [SampleFxP::ZERO; MAX_BLOCK];
+        let mut expected = [SampleFxP::ZERO; MAX_BLOCK];
+        for (block, &(len, gated)) in blocks.iter().enumerate() {
+            let gate = if gated { &gate_on } else { &gate_off };
+            // Drive the bank, honoring the short-return contract:
+            let mut filled = 0usize;
+            while filled < len {
+                let inputs: [VoiceBankInputFxP; NUM_VOICES] =
+                    core::array::from_fn(|v| VoiceBankInputFxP {
+                        note: &notebufs[v][filled..len],
+                        gate: &gate[filled..len],
+                        vel: &velbufs[v][filled..len],
+                    });
+                let out = bank.process(
+                    &ctx,
+                    &matrix,
+                    &inputs,
+                    &zero[filled..len],
+                    &zero[filled..len],
+                    &bank_patch.bank_params(),
+                );
+                assert!(!out.is_empty());
+                bank_out[filled..filled + out.len()].copy_from_slice(out);
+                filled += out.len();
+            }
+            // Accumulate the independent reference voices.  Fresh parameter
+            // buffers per call, since the modulation section writes into
+            // them (just as the bank re-copies its scratch every chunk):
+            for smp in expected[0..len].iter_mut() {
+                *smp = SampleFxP::ZERO;
+            }
+            for (voice, v) in voices.iter_mut().zip(0..NUM_VOICES) {
+                let mut filled = 0usize;
+                while filled < len {
+                    let end = core::cmp::min(len, filled + FUSED_BLOCK_MAX);
+                    let mut patch = PatchBufs::new();
+                    let out = voice.process(
+                        &ctx,
+                        &matrix,
+                        &notebufs[v][filled..end],
+                        &gate[filled..end],
+                        &velbufs[v][filled..end],
+                        &zero[filled..end],
+                        &zero[filled..end],
+                        patch.voice_params(),
+                        &mut scratch,
+                    );
+                    assert!(!out.is_empty());
+                    for (acc, smp) in expected[filled..filled + out.len()]
+                        .iter_mut()
+                        .zip(out.iter())
+                    {
+                        *acc = acc.saturating_add(*smp);
+                    }
+                    filled += out.len();
+                }
+            }
+            for (i, (a, b)) in bank_out[0..len].iter().zip(expected[0..len].iter()).enumerate() {
+                assert_eq!(
+                    a, b,
+                    "block {} sample {}: bank {} vs. independent voices {}",
+                    block, i, a, b
+                );
+            }
+        }
+    }
+}
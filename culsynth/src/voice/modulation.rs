@@ -1,7 +1,7 @@
 //! This module contains data to allow modulation of a `Voice`
 use tinyvec::ArrayVec;
 
-use crate::context::{Context, ContextFxP};
+use crate::context::{Context, ContextFxP, ModInterval};
 use crate::devices::*;
 use crate::{min_size, STATIC_BUFFER_SIZE};
 use crate::{EnvParamFxP, IScalarFxP, LfoFreqFxP, SampleFxP, ScalarFxP, SignedNoteFxP};
@@ -353,6 +353,8 @@ pub struct ModulatorFxP<'a> {
     env1: &'a [ScalarFxP],
     env2: &'a [ScalarFxP],
     matrix: &'a ModMatrixFxP,
+    dest_mask: u64,
+    interval: ModInterval,
 }
 
 impl<'a> ModulatorFxP<'a> {
@@ -382,6 +384,11 @@ impl<'a> ModulatorFxP<'a> {
     {
         use crate::fixedmath::{I16F16, I17F15, I1F31};
         use fixed::FixedI32;
+        // In the common case the matrix has no routes at all to this
+        // destination, so check the precomputed mask before scanning the slots
+        if self.dest_mask & (1u64 << (dest as u64)) == 0 {
+            return false;
+        }
         let modulation = ModSrc::ELEM.map(|src| self.matrix.get_modulation(src, dest));
         // All the modulation sources that are not LFOs are ScalarFxPs
         let non_lfos = [
@@ -409,31 +416,58 @@ impl<'a> ModulatorFxP<'a> {
         if non_lfos_filt.is_empty() && lfos_filt.is_empty() {
             return false;
         }
-        for i in 0..core::cmp::min(self.len(), buf.len()) {
-            // All of the modulations for this sample, chain()ed together
-            let modulations = non_lfos_filt
+        // Sum all of the modulations for sample `i`.  We'll do some bit twiddling
+        // so 100% modulation will correspond to the maximum value of the type, and
+        // do all our math in 32 bit signed arithmetic so we can model multiple
+        // modulations canceling each other out then check for saturation at the end
+        let offset = |i: usize| -> FixedI32<T::Frac> {
+            non_lfos_filt
                 .into_iter()
                 .map(|(slc, val)| slc[i].wide_mul_signed(val))
                 .chain(
                     lfos_filt
                         .into_iter()
                         .map(|(slc, val)| I1F31::saturating_from_num(slc[i].wide_mul(val))),
-                );
-            // Add all the modulations.  We'll do some bit twiddling so 100% modulation will
-            // correspond to the maximum value of the type, and do all our math in 32 bit signed
-            // arithmetic so we can model multiple modulations canceling each other out then
-            // check for saturation at the end
-            buf[i] = T::saturating_from_num(
-                modulations
-                    .map(|x| {
-                        FixedI32::<T::Frac>::from_bits(if T::IS_SIGNED {
-                            I17F15::from_num(x).to_bits()
-                        } else {
-                            I16F16::from_num(x).to_bits()
-                        })
+                )
+                .map(|x| {
+                    FixedI32::<T::Frac>::from_bits(if T::IS_SIGNED {
+                        I17F15::from_num(x).to_bits()
+                    } else {
+                        I16F16::from_num(x).to_bits()
                     })
-                    .fold(FixedI32::<T::Frac>::from_num(buf[i]), |acc, val| acc + val),
-            );
+                })
+                .fold(FixedI32::<T::Frac>::ZERO, |acc, val| acc + val)
+        };
+        let numsamples = core::cmp::min(self.len(), buf.len());
+        let interval = self.interval.value();
+        if interval == 1 {
+            for i in 0..numsamples {
+                buf[i] =
+                    T::saturating_from_num(FixedI32::<T::Frac>::from_num(buf[i]) + offset(i));
+            }
+        } else {
+            // Control-rate processing: evaluate the modulation offset once per
+            // interval and linearly interpolate between control points.  The
+            // interval is a power of two, so the interpolation is a shift.
+            let mut base = offset(0);
+            let mut i = 0usize;
+            while i + interval <= numsamples {
+                let next = offset(i + interval - 1);
+                let delta = (next - base).unwrapped_shr(self.interval.log2());
+                let mut cur = base;
+                for smp in buf[i..i + interval].iter_mut() {
+                    *smp = T::saturating_from_num(FixedI32::<T::Frac>::from_num(*smp) + cur);
+                    cur += delta;
+                }
+                base = next;
+                i += interval;
+            }
+            // Process any partial interval at the end of the buffer exactly
+            for (k, smp) in buf[i..numsamples].iter_mut().enumerate() {
+                *smp = T::saturating_from_num(
+                    FixedI32::<T::Frac>::from_num(*smp) + offset(i + k),
+                );
+            }
         }
         true
     }
@@ -554,6 +588,24 @@ impl ModMatrixFxP {
             .iter()
             .find_map(|x| if x.0 == dest { Some(x.1) } else { None })
     }
+    /// A bitmask with the bit corresponding to each [ModDest] discriminant set
+    /// if and only if this matrix contains a route to that destination with a
+    /// nonzero depth.  This lets a modulator skip destinations with no active
+    /// routes without rescanning every slot of the matrix for each parameter,
+    /// since the typical patch only uses a few slots.
+    pub fn dest_mask(&self) -> u64 {
+        // This relies on all of the destinations fitting in a u64:
+        const _: () = assert!((ModDest::max() as u32) < 64);
+        let mut mask = 0u64;
+        for (_src, slots) in self.rows.iter() {
+            for (dest, depth) in slots.iter() {
+                if *dest != ModDest::Null && *depth != IScalarFxP::ZERO {
+                    mask |= 1u64 << (*dest as u64);
+                }
+            }
+        }
+        mask
+    }
 }
 
 /// The actual modulation section, containing the modulation LFOs and Envelopes and
@@ -604,6 +656,8 @@ impl ModSectionFxP {
             env1: env1_out,
             env2: fixed_zerobuf::<ScalarFxP>(),
             matrix: entries,
+            dest_mask: entries.dest_mask(),
+            interval: ctx.mod_interval,
         };
         modulator.modulate(
             ModDest::Lfo2Rate,
@@ -662,6 +716,8 @@ pub struct Modulator<'a, Smp: Float> {
     env1: &'a [Smp],
     env2: &'a [Smp],
     matrix: &'a ModMatrix<Smp>,
+    dest_mask: u64,
+    interval: ModInterval,
 }
 
 impl<'a, Smp: Float> Modulator<'a, Smp> {
@@ -694,6 +750,11 @@ impl<'a, Smp: Float> Modulator<'a, Smp> {
     ///
     /// Returns true if any modulation was performed, or false otherwise
     pub fn modulate(&self, dest: ModDest, buf: &mut [Smp], coeff: Smp) -> bool {
+        // In the common case the matrix has no routes at all to this
+        // destination, so check the precomputed mask before scanning the slots
+        if self.dest_mask & (1u64 << (dest as u64)) == 0 {
+            return false;
+        }
         let modulation = ModSrc::ELEM.map(|src| self.matrix.get_modulation(src, dest));
         let mod_params = [
             (self.velocity, modulation[ModSrc::Velocity as usize]),
@@ -713,11 +774,40 @@ impl<'a, Smp: Float> Modulator<'a, Smp> {
         if mod_params_filt.is_empty() {
             return false;
         }
-        for i in 0..core::cmp::min(self.len(), buf.len()) {
-            // All of the modulations for this sample
-            let modulations = mod_params_filt.into_iter().map(|(slc, val)| slc[i] * val);
-            // FIXME: Add scaling!!
-            buf[i] = modulations.fold(buf[i], |acc, val| acc + val);
+        // Sum all of the modulations for sample `i`
+        let offset = |i: usize| {
+            mod_params_filt
+                .into_iter()
+                .map(|(slc, val)| slc[i] * val)
+                .fold(Smp::ZERO, |acc, val| acc + val)
+        };
+        let numsamples = core::cmp::min(self.len(), buf.len());
+        let interval = self.interval.value();
+        if interval == 1 {
+            for (i, smp) in buf[0..numsamples].iter_mut().enumerate() {
+                *smp = *smp + offset(i);
+            }
+        } else {
+            // Control-rate processing: evaluate the modulation offset once per
+            // interval and linearly interpolate between control points
+            let recip = Smp::ONE / Smp::from_u16(interval as u16);
+            let mut base = offset(0);
+            let mut i = 0usize;
+            while i + interval <= numsamples {
+                let next = offset(i + interval - 1);
+                let delta = (next - base) * recip;
+                let mut cur = base;
+                for smp in buf[i..i + interval].iter_mut() {
+                    *smp = *smp + cur;
+                    cur = cur + delta;
+                }
+                base = next;
+                i += interval;
+            }
+            // Process any partial interval at the end of the buffer exactly
+            for (k, smp) in buf[i..numsamples].iter_mut().enumerate() {
+                *smp = *smp + offset(i + k);
+            }
         }
         true
     }
@@ -809,6 +899,20 @@ impl<Smp: Float> ModMatrix<Smp> {
             .iter()
             .find_map(|x| if x.0 == dest { Some(x.1) } else { None })
     }
+    /// A bitmask with the bit corresponding to each [ModDest] discriminant set
+    /// if and only if this matrix contains a route to that destination with a
+    /// nonzero depth (see [ModMatrixFxP::dest_mask])
+    pub fn dest_mask(&self) -> u64 {
+        let mut mask = 0u64;
+        for (_src, slots) in self.rows.iter() {
+            for (dest, depth) in slots.iter() {
+                if *dest != ModDest::Null && *depth != Smp::ZERO {
+                    mask |= 1u64 << (*dest as u64);
+                }
+            }
+        }
+        mask
+    }
 }
 
 /// The actual modulation section, containing the modulation LFOs and Envelopes and
@@ -853,6 +957,8 @@ impl<Smp: Float> ModSection<Smp> {
             env1: env1_out,
             env2: Smp::zerobuf(),
             matrix: entries,
+            dest_mask: entries.dest_mask(),
+            interval: ctx.mod_interval,
         };
         let env_coeff = Modulator::coeff_from_fixed::<EnvParamFxP>();
         let lfo_coeff = Modulator::coeff_from_fixed::<LfoFreqFxP>();
@@ -6,25 +6,25 @@ use rp_pico::entry;
 
 use core::mem::MaybeUninit;
 
-use arrayvec::ArrayVec;
-use culsynth::VoiceFxP;
+use culsynth::voice::bank::VoiceBankFxP;
 
 mod run;
 
-const NUM_VOICES: usize = 2;
+/// The total number of voices, split evenly across the two cores
+const NUM_VOICES: usize = 8;
+const VOICES_PER_CORE: usize = NUM_VOICES / 2;
 
-static mut VOICES: [MaybeUninit<VoiceFxP>; NUM_VOICES] =
+static mut BANKS: [MaybeUninit<VoiceBankFxP<VOICES_PER_CORE>>; 2] =
     [MaybeUninit::uninit(), MaybeUninit::uninit()];
 
 #[entry]
 fn start() -> ! {
-    const SIZE_OF_VOICE: usize = core::mem::size_of::<VoiceFxP>();
-    let mut voices = unsafe {
-        VOICES
-            .iter_mut()
-            .map(|x| x.write(VoiceFxP::new()))
-            .collect::<ArrayVec<&mut VoiceFxP, NUM_VOICES>>()
-            .into_inner_unchecked()
+    let (core0_bank, core1_bank) = unsafe {
+        let [bank0, bank1] = &mut BANKS;
+        (
+            bank0.write(VoiceBankFxP::new()),
+            bank1.write(VoiceBankFxP::new()),
+        )
     };
-    run::run(&mut voices)
+    run::run(core0_bank, core1_bank)
 }
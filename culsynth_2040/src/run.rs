@@ -1,21 +1,275 @@
-use culsynth::{VoiceFxP, voice::VoiceParamsFxP, voice::modulation::ModMatrixFxP};
+//! The audio rendering and output pipeline.
+//!
+//! Rendering is split across both cores: each core owns a [VoiceBankFxP]
+//! holding half of the voices.  Core0 kicks core1 through the SIO FIFO at
+//! the top of each block, renders its own bank while core1 renders the
+//! other half into a shared mix buffer, then combines the two halves into
+//! one of the DMA ping-pong buffers.  A pair of chained DMA channels stream
+//! the ping-pong buffers into a PIO state machine generating I2S, so the
+//! cores only ever block in the FIFO/DMA wait primitives instead of
+//! busy-waiting on the sample clock.
+
 use culsynth::context::ContextFxP;
+use culsynth::devices::{fixed_zerobuf, LfoOptions};
+use culsynth::voice::bank::{VoiceBankFxP, VoiceBankInputFxP, VoiceBankParamsFxP};
+use culsynth::voice::modulation::ModMatrixFxP;
+use culsynth::{EnvParamFxP, NoteFxP, SampleFxP, ScalarFxP};
+
+use hal::clocks::Clock;
+use hal::dma::{double_buffer, DMAExt};
+use hal::multicore::{Multicore, Stack};
+use hal::pac;
+use hal::pio::PIOExt;
+use rp_pico::hal;
+
+use crate::VOICES_PER_CORE;
+
+/// The number of samples in each block handed off between the cores and to
+/// the DMA engine.  The ping-pong gives two blocks of output latency
+/// (about 2.7ms at 48kHz).  This is independent of
+/// [culsynth::STATIC_BUFFER_SIZE]: the render loops below chunk their calls
+/// to [VoiceBankFxP::process], which may return fewer samples than it was
+/// given (see its documentation).
+const BLOCK_SIZE: usize = 64;
+
+/// The audio sample rate, in Hz.  Must match [ContextFxP::new_480].
+const SAMPLE_RATE: u32 = 48_000;
+
+/// The I2S GPIO pins.  BCLK and LRCLK must be consecutive since they are
+/// driven from the state machine's side-set.
+const I2S_DATA_PIN: u8 = 9;
+const I2S_BCLK_PIN: u8 = 10;
+const I2S_LRCLK_PIN: u8 = 11;
+
+static mut CORE1_STACK: Stack<4096> = Stack::new();
 
-fn synth_params<'a>() -> VoiceParamsFxP<'a> {
-    todo!()
+/// The mix buffer written by core1 and read by core0.  Access is serialized
+/// by the SIO FIFO handoff: core1 only writes it between receiving a kick
+/// and sending its done token, and core0 only reads it after receiving that
+/// token.
+static mut CORE1_MIX: [SampleFxP; BLOCK_SIZE] = [SampleFxP::ZERO; BLOCK_SIZE];
+
+/// The DMA ping-pong buffers, holding one 32-bit I2S frame (16-bit
+/// left/right pair) per sample.
+static mut PING: [u32; BLOCK_SIZE] = [0u32; BLOCK_SIZE];
+static mut PONG: [u32; BLOCK_SIZE] = [0u32; BLOCK_SIZE];
+
+static SCALAR_MAX: [ScalarFxP; BLOCK_SIZE] = [ScalarFxP::MAX; BLOCK_SIZE];
+static NOTE_MAX: [NoteFxP; BLOCK_SIZE] = [NoteFxP::MAX; BLOCK_SIZE];
+static ENV_TIME: [EnvParamFxP; BLOCK_SIZE] = [EnvParamFxP::lit("0.01"); BLOCK_SIZE];
+
+/// A placeholder parameter set until a real MIDI/control source exists: a
+/// single saw oscillator into a fully open low-pass filter.
+fn synth_params(lfo_opts: &[LfoOptions]) -> VoiceBankParamsFxP {
+    VoiceBankParamsFxP {
+        sync: fixed_zerobuf(),
+        osc1_tune: fixed_zerobuf(),
+        osc1_shape: fixed_zerobuf(),
+        osc1_sin: fixed_zerobuf(),
+        osc1_sq: fixed_zerobuf(),
+        osc1_tri: fixed_zerobuf(),
+        osc1_saw: &SCALAR_MAX,
+        osc2_tune: fixed_zerobuf(),
+        osc2_shape: fixed_zerobuf(),
+        osc2_sin: fixed_zerobuf(),
+        osc2_sq: fixed_zerobuf(),
+        osc2_tri: fixed_zerobuf(),
+        osc2_saw: fixed_zerobuf(),
+        ring_mix_out: fixed_zerobuf(),
+        ring_mix_a: &SCALAR_MAX,
+        ring_mix_b: fixed_zerobuf(),
+        filt_env_mod: fixed_zerobuf(),
+        filt_vel_mod: fixed_zerobuf(),
+        filt_kbd: fixed_zerobuf(),
+        filt_cutoff: &NOTE_MAX,
+        filt_resonance: fixed_zerobuf(),
+        filt_low_mix: &SCALAR_MAX,
+        filt_band_mix: fixed_zerobuf(),
+        filt_high_mix: fixed_zerobuf(),
+        env_filt_attack: &ENV_TIME,
+        env_filt_decay: &ENV_TIME,
+        env_filt_sustain: &SCALAR_MAX,
+        env_filt_release: &ENV_TIME,
+        env_amp_attack: &ENV_TIME,
+        env_amp_decay: &ENV_TIME,
+        env_amp_sustain: &SCALAR_MAX,
+        env_amp_release: &ENV_TIME,
+        lfo1_freq: fixed_zerobuf(),
+        lfo1_depth: fixed_zerobuf(),
+        lfo1_opts: lfo_opts,
+        lfo2_freq: fixed_zerobuf(),
+        lfo2_depth: fixed_zerobuf(),
+        lfo2_opts: lfo_opts,
+        env1_attack: &ENV_TIME,
+        env1_decay: &ENV_TIME,
+        env1_sustain: &SCALAR_MAX,
+        env1_release: &ENV_TIME,
+        env2_attack: &ENV_TIME,
+        env2_decay: &ENV_TIME,
+        env2_sustain: &SCALAR_MAX,
+        env2_release: &ENV_TIME,
+    }
 }
 
-pub fn run(voices: &mut [&mut VoiceFxP; crate::NUM_VOICES]) -> ! {
+/// Placeholder per-voice inputs until a real MIDI/control source exists
+fn synth_inputs() -> [VoiceBankInputFxP<'static>; VOICES_PER_CORE] {
+    core::array::from_fn(|_| VoiceBankInputFxP {
+        note: fixed_zerobuf(),
+        gate: fixed_zerobuf(),
+        vel: fixed_zerobuf(),
+    })
+}
+
+/// The rendering loop for core1: wait for the kick from core0, render our
+/// half of the voices into the shared mix buffer, and signal completion.
+fn core1_task(bank: &mut VoiceBankFxP<VOICES_PER_CORE>) -> ! {
     const CONTEXT: ContextFxP = ContextFxP::new_480();
+    // SAFETY: core0 has already taken the peripherals; we only construct
+    // the (core-local) SIO FIFO access from this.
+    let pac = unsafe { pac::Peripherals::steal() };
+    let mut sio = hal::Sio::new(pac.SIO);
     let matrix = ModMatrixFxP::default();
-    let notebuf = culsynth::devices::fixed_zerobuf::<culsynth::NoteFxP>();
-    let gatebuf = culsynth::devices::fixed_zerobuf::<culsynth::SampleFxP>();
-    let velbuf = culsynth::devices::fixed_zerobuf::<culsynth::ScalarFxP>();
-    let aftertouchbuf = culsynth::devices::fixed_zerobuf::<culsynth::ScalarFxP>();
-    let modwheelbuf = culsynth::devices::fixed_zerobuf::<culsynth::ScalarFxP>();
+    let lfo_opts = [LfoOptions::default(); BLOCK_SIZE];
+    let params = synth_params(&lfo_opts);
+    let inputs = synth_inputs();
+    let zero = fixed_zerobuf::<ScalarFxP>();
     loop {
-        for voice in voices.iter_mut() {
-            voice.process(&CONTEXT, &matrix, notebuf, gatebuf, velbuf, aftertouchbuf, modwheelbuf, synth_params());
+        sio.fifo.read_blocking();
+        // process() may return fewer than BLOCK_SIZE samples (it is bounded
+        // by the device buffer size), so call it until the block is full.
+        // The control inputs are block-constant, so we do not need to
+        // advance them between chunks.
+        let mut filled = 0usize;
+        while filled < BLOCK_SIZE {
+            let out = bank.process(&CONTEXT, &matrix, &inputs, zero, zero, &params);
+            let n = out.len().min(BLOCK_SIZE - filled);
+            // SAFETY: core0 will not read CORE1_MIX until it receives the
+            // done token below.
+            unsafe {
+                CORE1_MIX[filled..filled + n].copy_from_slice(&out[..n]);
+            }
+            filled += n;
         }
+        sio.fifo.write_blocking(1);
     }
-}
\ No newline at end of file
+}
+
+pub fn run(
+    core0_bank: &'static mut VoiceBankFxP<VOICES_PER_CORE>,
+    core1_bank: &'static mut VoiceBankFxP<VOICES_PER_CORE>,
+) -> ! {
+    const CONTEXT: ContextFxP = ContextFxP::new_480();
+    let mut pac = pac::Peripherals::take().unwrap();
+    let mut watchdog = hal::Watchdog::new(pac.WATCHDOG);
+    let clocks = hal::clocks::init_clocks_and_plls(
+        rp_pico::XOSC_CRYSTAL_FREQ,
+        pac.XOSC,
+        pac.PLL_SYS,
+        pac.PLL_USB,
+        &mut pac.RESETS,
+        &mut watchdog,
+    )
+    .ok()
+    .unwrap();
+    let mut sio = hal::Sio::new(pac.SIO);
+    let pins = rp_pico::Pins::new(
+        pac.IO_BANK0,
+        pac.PADS_BANK0,
+        sio.gpio_bank0,
+        &mut pac.RESETS,
+    );
+    // Hand the I2S pins (see I2S_*_PIN) to PIO0:
+    let _i2s_data = pins.gpio9.into_function::<hal::gpio::FunctionPio0>();
+    let _i2s_bclk = pins.gpio10.into_function::<hal::gpio::FunctionPio0>();
+    let _i2s_lrclk = pins.gpio11.into_function::<hal::gpio::FunctionPio0>();
+
+    // Bring up core1 first; it parks in read_blocking() until the first
+    // block is kicked off below.
+    {
+        let mut mc = Multicore::new(&mut pac.PSM, &mut pac.PPB, &mut sio.fifo);
+        let cores = mc.cores();
+        cores[1]
+            .spawn(unsafe { &mut CORE1_STACK.mem }, move || {
+                core1_task(core1_bank)
+            })
+            .unwrap();
+    }
+
+    // The I2S transmitter (standard two side-set pin I2S master, MSB first,
+    // 16 bits per channel, one bit per two PIO clocks).  Side-set bit 0 is
+    // BCLK, bit 1 is LRCLK.
+    let (mut pio, sm0, _, _, _) = pac.PIO0.split(&mut pac.RESETS);
+    let program = pio_proc::pio_asm!(
+        ".side_set 2",
+        "bitloop1:",
+        "    out pins, 1        side 0b10",
+        "    jmp x-- bitloop1   side 0b11",
+        "    out pins, 1        side 0b00",
+        "    set x, 14          side 0b01",
+        "bitloop0:",
+        "    out pins, 1        side 0b00",
+        "    jmp x-- bitloop0   side 0b01",
+        "    out pins, 1        side 0b10",
+        "public entry_point:",
+        "    set x, 14          side 0b11",
+    );
+    let installed = pio.install(&program.program).unwrap();
+    // One frame is 32 bits at two PIO clocks per bit:
+    let sys_freq = clocks.system_clock.freq().to_Hz();
+    let bit_freq = SAMPLE_RATE * 64;
+    let div_int = (sys_freq / bit_freq) as u16;
+    let div_frac = ((sys_freq % bit_freq) * 256 / bit_freq) as u8;
+    let (mut sm, _rx, tx) = hal::pio::PIOBuilder::from_program(installed)
+        .out_pins(I2S_DATA_PIN, 1)
+        .side_set_pin_base(I2S_BCLK_PIN)
+        .out_shift_direction(hal::pio::ShiftDirection::Left)
+        .autopull(true)
+        .pull_threshold(32)
+        .buffers(hal::pio::Buffers::OnlyTx)
+        .clock_divisor_fixed_point(div_int, div_frac)
+        .build(sm0);
+    sm.set_pindirs([
+        (I2S_DATA_PIN, hal::pio::PinDir::Output),
+        (I2S_BCLK_PIN, hal::pio::PinDir::Output),
+        (I2S_LRCLK_PIN, hal::pio::PinDir::Output),
+    ]);
+    let _sm = sm.start();
+
+    let dma = pac.DMA.split(&mut pac.RESETS);
+    // SAFETY: PING/PONG are only ever accessed through the double-buffered
+    // transfer from here on.
+    let (ping, pong) = unsafe { (&mut PING, &mut PONG) };
+    let tx_transfer = double_buffer::Config::new((dma.ch0, dma.ch1), ping, tx).start();
+    let mut tx_transfer = tx_transfer.read_next(pong);
+
+    let matrix = ModMatrixFxP::default();
+    let lfo_opts = [LfoOptions::default(); BLOCK_SIZE];
+    let params = synth_params(&lfo_opts);
+    let inputs = synth_inputs();
+    let zero = fixed_zerobuf::<ScalarFxP>();
+    let mut core0_mix = [SampleFxP::ZERO; BLOCK_SIZE];
+    loop {
+        sio.fifo.write_blocking(0); // kick core1 for this block
+        // As in core1_task, process() may return short blocks, so chunk our
+        // half into a local mix buffer until BLOCK_SIZE samples are ready.
+        let mut filled = 0usize;
+        while filled < BLOCK_SIZE {
+            let out = core0_bank.process(&CONTEXT, &matrix, &inputs, zero, zero, &params);
+            let n = out.len().min(BLOCK_SIZE - filled);
+            core0_mix[filled..filled + n].copy_from_slice(&out[..n]);
+            filled += n;
+        }
+        sio.fifo.read_blocking(); // wait for core1's half
+        let (buf, next_transfer) = tx_transfer.wait();
+        // SAFETY: core1 is parked in read_blocking() and will not touch
+        // CORE1_MIX again until the next kick.
+        let core1_mix = unsafe { &CORE1_MIX };
+        for (frame, (a, b)) in buf.iter_mut().zip(core0_mix.iter().zip(core1_mix.iter())) {
+            // Saturate the two halves into a single I4F12 - its 16 bits map
+            // exactly onto a full-scale i16 sample - and duplicate to L/R.
+            let smp = a.saturating_add(*b).to_bits() as u16 as u32;
+            *frame = (smp << 16) | smp;
+        }
+        tx_transfer = next_transfer.read_next(buf);
+    }
+}
@@ -1,6 +1,8 @@
 use culsynth::context::{Context, ContextFxP};
 use culsynth::devices::*;
-use culsynth::{EnvParamFxP, NoteFxP, SampleFxP, ScalarFxP, SignedNoteFxP};
+use culsynth::voice::modulation::{ModDest, ModMatrix, ModMatrixFxP};
+use culsynth::voice::{Voice, VoiceFxP, VoiceParams, VoiceParamsFxP};
+use culsynth::{EnvParamFxP, IScalarFxP, LfoFreqFxP, NoteFxP, SampleFxP, ScalarFxP, SignedNoteFxP};
 
 #[no_mangle]
 pub extern "C" fn culsynth_amp_u16_new() -> *mut AmpFxP {
@@ -136,6 +138,53 @@ pub unsafe extern "C" fn culsynth_env_u16_process(
     out.len() as i32
 }
 
+/// Process an arbitrarily long signal in a single call, writing the output
+/// into a caller-provided buffer of `samples` elements - see
+/// [culsynth_osc_u16_process_batch].  Returns the number of samples
+/// processed, or -1 if any pointer is null.
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_env_u16_process_batch(
+    p: *mut EnvFxP,
+    samples: u32,
+    gate: *const i16,
+    attack: *const u16,
+    decay: *const u16,
+    sustain: *const u16,
+    release: *const u16,
+    signal: *mut u16,
+) -> i32 {
+    if p.is_null()
+        || gate.is_null()
+        || attack.is_null()
+        || decay.is_null()
+        || sustain.is_null()
+        || release.is_null()
+        || signal.is_null()
+    {
+        return -1;
+    }
+    let ctx = ContextFxP::default();
+    let mut processed = 0u32;
+    while processed < samples {
+        let remaining = samples - processed;
+        let params = EnvParamsFxP {
+            attack: slice(attack.cast::<EnvParamFxP>(), remaining, processed),
+            decay: slice(decay.cast::<EnvParamFxP>(), remaining, processed),
+            sustain: slice(sustain.cast::<ScalarFxP>(), remaining, processed),
+            release: slice(release.cast::<EnvParamFxP>(), remaining, processed),
+        };
+        let out = (*p).process(
+            &ctx,
+            slice(gate.cast::<SampleFxP>(), remaining, processed),
+            params,
+        );
+        let n = out.len() as u32;
+        slice_mut(signal.cast::<ScalarFxP>(), n, processed).copy_from_slice(out);
+        processed += n;
+    }
+    processed as i32
+}
+
 #[no_mangle]
 pub extern "C" fn culsynth_env_f32_new() -> *mut Env<f32> {
     Box::into_raw(Box::new(Env::new()))
@@ -182,14 +231,56 @@ pub unsafe extern "C" fn culsynth_env_f32_process(
         release: r,
     };
     //FIXME
-    let ctx = Context::<f32> {
-        sample_rate: 44100f32,
-    };
+    let ctx = Context::<f32>::new(44100f32);
     let out = (*p).process(&ctx, g, params);
     *signal = out.as_ptr().cast();
     out.len() as i32
 }
 
+/// Process an arbitrarily long signal in a single call, writing the output
+/// into a caller-provided buffer of `samples` elements - see
+/// [culsynth_osc_u16_process_batch].  Returns the number of samples
+/// processed, or -1 if any pointer is null.
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_env_f32_process_batch(
+    p: *mut Env<f32>,
+    samples: u32,
+    gate: *const f32,
+    attack: *const f32,
+    decay: *const f32,
+    sustain: *const f32,
+    release: *const f32,
+    signal: *mut f32,
+) -> i32 {
+    if p.is_null()
+        || gate.is_null()
+        || attack.is_null()
+        || decay.is_null()
+        || sustain.is_null()
+        || release.is_null()
+        || signal.is_null()
+    {
+        return -1;
+    }
+    //FIXME
+    let ctx = Context::<f32>::new(44100f32);
+    let mut processed = 0u32;
+    while processed < samples {
+        let remaining = samples - processed;
+        let params = EnvParams::<f32> {
+            attack: slice(attack, remaining, processed),
+            decay: slice(decay, remaining, processed),
+            sustain: slice(sustain, remaining, processed),
+            release: slice(release, remaining, processed),
+        };
+        let out = (*p).process(&ctx, slice(gate, remaining, processed), params);
+        let n = out.len() as u32;
+        slice_mut(signal, n, processed).copy_from_slice(out);
+        processed += n;
+    }
+    processed as i32
+}
+
 #[no_mangle]
 pub extern "C" fn culsynth_filt_u16_new() -> *mut FiltFxP {
     Box::into_raw(Box::new(FiltFxP::new()))
@@ -239,6 +330,7 @@ pub unsafe extern "C" fn culsynth_filt_u16_process(
     let params = FiltParamsFxP {
         cutoff: c,
         resonance: r,
+        oversample: FiltOversample::Off,
     };
     //FIXME
     let ctx = ContextFxP::default();
@@ -249,6 +341,55 @@ pub unsafe extern "C" fn culsynth_filt_u16_process(
     out.low.len() as i32
 }
 
+/// Process an arbitrarily long signal in a single call, writing the filter
+/// outputs into caller-provided buffers of `samples` elements each - see
+/// [culsynth_osc_u16_process_batch].  Returns the number of samples
+/// processed, or -1 if any pointer is null.
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_filt_u16_process_batch(
+    p: *mut FiltFxP,
+    samples: u32,
+    input: *const i16,
+    cutoff: *const u16,
+    resonance: *const u16,
+    low: *mut i16,
+    band: *mut i16,
+    high: *mut i16,
+) -> i32 {
+    if p.is_null()
+        || input.is_null()
+        || cutoff.is_null()
+        || resonance.is_null()
+        || low.is_null()
+        || band.is_null()
+        || high.is_null()
+    {
+        return -1;
+    }
+    //FIXME
+    let ctx = ContextFxP::default();
+    let mut processed = 0u32;
+    while processed < samples {
+        let remaining = samples - processed;
+        let params = FiltParamsFxP {
+            cutoff: slice(cutoff.cast::<NoteFxP>(), remaining, processed),
+            resonance: slice(resonance.cast::<ScalarFxP>(), remaining, processed),
+            oversample: FiltOversample::Off,
+        };
+        let out = (*p).process(
+            &ctx,
+            slice(input.cast::<SampleFxP>(), remaining, processed),
+            params,
+        );
+        let n = out.low.len() as u32;
+        slice_mut(low.cast::<SampleFxP>(), n, processed).copy_from_slice(out.low);
+        slice_mut(band.cast::<SampleFxP>(), n, processed).copy_from_slice(out.band);
+        slice_mut(high.cast::<SampleFxP>(), n, processed).copy_from_slice(out.high);
+        processed += n;
+    }
+    processed as i32
+}
+
 #[no_mangle]
 pub extern "C" fn culsynth_filt_f32_new() -> *mut Filt<f32> {
     Box::into_raw(Box::new(Filt::new()))
@@ -289,11 +430,10 @@ pub unsafe extern "C" fn culsynth_filt_f32_process(
     let params = FiltParams::<f32> {
         cutoff: c,
         resonance: r,
+        oversample: FiltOversample::Off,
     };
     //FIXME
-    let ctx = Context::<f32> {
-        sample_rate: 44100f32,
-    };
+    let ctx = Context::<f32>::new(44100f32);
     let out = (*p).process(&ctx, i, params);
     *low = out.low.as_ptr().cast();
     *band = out.band.as_ptr().cast();
@@ -301,13 +441,68 @@ pub unsafe extern "C" fn culsynth_filt_f32_process(
     out.low.len() as i32
 }
 
+/// Process an arbitrarily long signal in a single call, writing the filter
+/// outputs into caller-provided buffers of `samples` elements each - see
+/// [culsynth_osc_u16_process_batch].  Returns the number of samples
+/// processed, or -1 if any pointer is null.
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_filt_f32_process_batch(
+    p: *mut Filt<f32>,
+    samples: u32,
+    input: *const f32,
+    cutoff: *const f32,
+    resonance: *const f32,
+    low: *mut f32,
+    band: *mut f32,
+    high: *mut f32,
+) -> i32 {
+    if p.is_null()
+        || input.is_null()
+        || cutoff.is_null()
+        || resonance.is_null()
+        || low.is_null()
+        || band.is_null()
+        || high.is_null()
+    {
+        return -1;
+    }
+    //FIXME
+    let ctx = Context::<f32>::new(44100f32);
+    let mut processed = 0u32;
+    while processed < samples {
+        let remaining = samples - processed;
+        let params = FiltParams::<f32> {
+            cutoff: slice(cutoff, remaining, processed),
+            resonance: slice(resonance, remaining, processed),
+            oversample: FiltOversample::Off,
+        };
+        let out = (*p).process(&ctx, slice(input, remaining, processed), params);
+        let n = out.low.len() as u32;
+        slice_mut(low, n, processed).copy_from_slice(out.low);
+        slice_mut(band, n, processed).copy_from_slice(out.band);
+        slice_mut(high, n, processed).copy_from_slice(out.high);
+        processed += n;
+    }
+    processed as i32
+}
+
+/// An [OscFxP] bundled with its own [OscScratch], since the C API has no
+/// notion of a caller-provided scratch buffer
+pub struct OscU16 {
+    osc: OscFxP,
+    scratch: OscScratch<SampleFxP>,
+}
+
 #[no_mangle]
-pub extern "C" fn culsynth_osc_u16_new() -> *mut OscFxP {
-    Box::into_raw(Box::new(OscFxP::new()))
+pub extern "C" fn culsynth_osc_u16_new() -> *mut OscU16 {
+    Box::into_raw(Box::new(OscU16 {
+        osc: OscFxP::new(),
+        scratch: OscScratch::new(),
+    }))
 }
 
 #[no_mangle]
-pub unsafe extern "C" fn culsynth_osc_u16_free(p: *mut OscFxP) {
+pub unsafe extern "C" fn culsynth_osc_u16_free(p: *mut OscU16) {
     if !p.is_null() {
         let _ = Box::from_raw(p);
     }
@@ -315,7 +510,7 @@ pub unsafe extern "C" fn culsynth_osc_u16_free(p: *mut OscFxP) {
 
 #[no_mangle]
 pub unsafe extern "C" fn culsynth_osc_u16_process(
-    p: *mut OscFxP,
+    p: *mut OscU16,
     samples: u32,
     note: *const u16,
     tune: *const i16,
@@ -352,10 +547,11 @@ pub unsafe extern "C" fn culsynth_osc_u16_process(
         tune: tune_s,
         shape: shape_s,
         sync: OscSync::Off,
+        waves: OscWaveforms::ALL,
     };
     //FIXME
     let ctx = ContextFxP::default();
-    let out = (*p).process(&ctx, note_s, params);
+    let out = (*p).osc.process(&ctx, note_s, params, &mut (*p).scratch);
     *sin = out.sin.as_ptr().cast();
     *tri = out.tri.as_ptr().cast();
     *sq = out.sq.as_ptr().cast();
@@ -363,13 +559,80 @@ pub unsafe extern "C" fn culsynth_osc_u16_process(
     out.sin.len() as i32
 }
 
+/// Process an arbitrarily long signal in a single call.  Unlike
+/// [culsynth_osc_u16_process], the output pointers reference caller-provided
+/// buffers holding `samples` elements each; this function loops over
+/// internally-sized chunks and copies each chunk's output into them, so
+/// callers need not re-invoke per chunk.  The output buffers may not alias
+/// the inputs.  Returns the number of samples processed, or -1 if any
+/// pointer is null.
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_osc_u16_process_batch(
+    p: *mut OscU16,
+    samples: u32,
+    note: *const u16,
+    tune: *const i16,
+    shape: *const u16,
+    sin: *mut i16,
+    tri: *mut i16,
+    sq: *mut i16,
+    saw: *mut i16,
+) -> i32 {
+    if p.is_null()
+        || note.is_null()
+        || tune.is_null()
+        || shape.is_null()
+        || sin.is_null()
+        || tri.is_null()
+        || sq.is_null()
+        || saw.is_null()
+    {
+        return -1;
+    }
+    //FIXME
+    let ctx = ContextFxP::default();
+    let mut processed = 0u32;
+    while processed < samples {
+        let remaining = samples - processed;
+        let params = OscParamsFxP {
+            tune: slice(tune.cast::<SignedNoteFxP>(), remaining, processed),
+            shape: slice(shape.cast::<ScalarFxP>(), remaining, processed),
+            sync: OscSync::Off,
+            waves: OscWaveforms::ALL,
+        };
+        let out = (*p).osc.process(
+            &ctx,
+            slice(note.cast::<NoteFxP>(), remaining, processed),
+            params,
+            &mut (*p).scratch,
+        );
+        let n = out.sin.len() as u32;
+        slice_mut(sin.cast::<SampleFxP>(), n, processed).copy_from_slice(out.sin);
+        slice_mut(tri.cast::<SampleFxP>(), n, processed).copy_from_slice(out.tri);
+        slice_mut(sq.cast::<SampleFxP>(), n, processed).copy_from_slice(out.sq);
+        slice_mut(saw.cast::<SampleFxP>(), n, processed).copy_from_slice(out.saw);
+        processed += n;
+    }
+    processed as i32
+}
+
+/// An [Osc] bundled with its own [OscScratch], since the C API has no
+/// notion of a caller-provided scratch buffer
+pub struct OscF32 {
+    osc: Osc<f32>,
+    scratch: OscScratch<f32>,
+}
+
 #[no_mangle]
-pub extern "C" fn culsynth_osc_f32_new() -> *mut Osc<f32> {
-    Box::into_raw(Box::new(Osc::<f32>::new()))
+pub extern "C" fn culsynth_osc_f32_new() -> *mut OscF32 {
+    Box::into_raw(Box::new(OscF32 {
+        osc: Osc::<f32>::new(),
+        scratch: OscScratch::new(),
+    }))
 }
 
 #[no_mangle]
-pub unsafe extern "C" fn culsynth_osc_f32_free(p: *mut Osc<f32>) {
+pub unsafe extern "C" fn culsynth_osc_f32_free(p: *mut OscF32) {
     if !p.is_null() {
         let _ = Box::from_raw(p);
     }
@@ -377,7 +640,7 @@ pub unsafe extern "C" fn culsynth_osc_f32_free(p: *mut Osc<f32>) {
 
 #[no_mangle]
 pub unsafe extern "C" fn culsynth_osc_f32_process(
-    p: *mut Osc<f32>,
+    p: *mut OscF32,
     samples: u32,
     note: *const f32,
     tune: *const f32,
@@ -406,15 +669,1712 @@ pub unsafe extern "C" fn culsynth_osc_f32_process(
         tune: tune_s,
         shape: shape_s,
         sync: OscSync::Off,
+        waves: OscWaveforms::ALL,
     };
     //FIXME
-    let ctx = Context::<f32> {
-        sample_rate: 44100f32,
-    };
-    let out = (*p).process(&ctx, note_s, params);
+    let ctx = Context::<f32>::new(44100f32);
+    let out = (*p).osc.process(&ctx, note_s, params, &mut (*p).scratch);
     *sin = out.sin.as_ptr().cast();
     *tri = out.tri.as_ptr().cast();
     *sq = out.sq.as_ptr().cast();
     *saw = out.saw.as_ptr().cast();
     out.sin.len() as i32
 }
+
+/// Process an arbitrarily long signal in a single call, writing the
+/// waveform outputs into caller-provided buffers of `samples` elements each
+/// - see [culsynth_osc_u16_process_batch].  Returns the number of samples
+/// processed, or -1 if any pointer is null.
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_osc_f32_process_batch(
+    p: *mut OscF32,
+    samples: u32,
+    note: *const f32,
+    tune: *const f32,
+    shape: *const f32,
+    sin: *mut f32,
+    tri: *mut f32,
+    sq: *mut f32,
+    saw: *mut f32,
+) -> i32 {
+    if p.is_null()
+        || note.is_null()
+        || tune.is_null()
+        || shape.is_null()
+        || sin.is_null()
+        || tri.is_null()
+        || sq.is_null()
+        || saw.is_null()
+    {
+        return -1;
+    }
+    //FIXME
+    let ctx = Context::<f32>::new(44100f32);
+    let mut processed = 0u32;
+    while processed < samples {
+        let remaining = samples - processed;
+        let params = OscParams::<f32> {
+            tune: slice(tune, remaining, processed),
+            shape: slice(shape, remaining, processed),
+            sync: OscSync::Off,
+            waves: OscWaveforms::ALL,
+        };
+        let out = (*p).osc.process(
+            &ctx,
+            slice(note, remaining, processed),
+            params,
+            &mut (*p).scratch,
+        );
+        let n = out.sin.len() as u32;
+        slice_mut(sin, n, processed).copy_from_slice(out.sin);
+        slice_mut(tri, n, processed).copy_from_slice(out.tri);
+        slice_mut(sq, n, processed).copy_from_slice(out.sq);
+        slice_mut(saw, n, processed).copy_from_slice(out.saw);
+        processed += n;
+    }
+    processed as i32
+}
+
+/// Build a slice from a raw pointer, an offset, and a length.
+///
+/// # Safety
+///
+/// `p.offset(offset)` must be valid for reads of `samples` elements for the
+/// duration of the lifetime `'a`
+unsafe fn slice<'a, T>(p: *const T, samples: u32, offset: u32) -> &'a [T] {
+    std::slice::from_raw_parts(p.offset(offset as isize), samples as usize)
+}
+
+/// Build a mutable slice from a raw pointer, an offset, and a length.
+///
+/// # Safety
+///
+/// `p.offset(offset)` must be valid for reads and writes of `samples`
+/// elements for the duration of the lifetime `'a`, and may not be aliased
+unsafe fn slice_mut<'a, T>(p: *mut T, samples: u32, offset: u32) -> &'a mut [T] {
+    std::slice::from_raw_parts_mut(p.offset(offset as isize), samples as usize)
+}
+
+/// A C mirror of [VoiceParamsFxP], holding one pointer per parameter buffer.
+/// Each pointer must reference at least `offset + samples` elements.  The
+/// buffers are mutable because the modulation section writes the modulated
+/// parameter values back in place (see [culsynth::voice::modulation]); the
+/// `lfo1_*` and `env1_*` buffers are not modulation targets and are read-only.
+#[repr(C)]
+pub struct VoiceParamsU16 {
+    sync: *mut u16,
+    osc1_tune: *mut i16,
+    osc1_shape: *mut u16,
+    osc1_sin: *mut u16,
+    osc1_sq: *mut u16,
+    osc1_tri: *mut u16,
+    osc1_saw: *mut u16,
+    osc2_tune: *mut i16,
+    osc2_shape: *mut u16,
+    osc2_sin: *mut u16,
+    osc2_sq: *mut u16,
+    osc2_tri: *mut u16,
+    osc2_saw: *mut u16,
+    ring_mix_out: *mut u16,
+    ring_mix_a: *mut u16,
+    ring_mix_b: *mut u16,
+    filt_env_mod: *mut u16,
+    filt_vel_mod: *mut u16,
+    filt_kbd: *mut u16,
+    filt_cutoff: *mut u16,
+    filt_resonance: *mut u16,
+    filt_low_mix: *mut u16,
+    filt_band_mix: *mut u16,
+    filt_high_mix: *mut u16,
+    env_filt_attack: *mut u16,
+    env_filt_decay: *mut u16,
+    env_filt_sustain: *mut u16,
+    env_filt_release: *mut u16,
+    env_amp_attack: *mut u16,
+    env_amp_decay: *mut u16,
+    env_amp_sustain: *mut u16,
+    env_amp_release: *mut u16,
+    lfo1_freq: *const u16,
+    lfo1_depth: *const u16,
+    lfo1_opts: *const u16,
+    lfo2_freq: *mut u16,
+    lfo2_depth: *mut u16,
+    lfo2_opts: *mut u16,
+    env1_attack: *const u16,
+    env1_decay: *const u16,
+    env1_sustain: *const u16,
+    env1_release: *const u16,
+    env2_attack: *mut u16,
+    env2_decay: *mut u16,
+    env2_sustain: *mut u16,
+    env2_release: *mut u16,
+}
+
+impl VoiceParamsU16 {
+    fn has_null(&self) -> bool {
+        self.sync.is_null()
+            || self.osc1_tune.is_null()
+            || self.osc1_shape.is_null()
+            || self.osc1_sin.is_null()
+            || self.osc1_sq.is_null()
+            || self.osc1_tri.is_null()
+            || self.osc1_saw.is_null()
+            || self.osc2_tune.is_null()
+            || self.osc2_shape.is_null()
+            || self.osc2_sin.is_null()
+            || self.osc2_sq.is_null()
+            || self.osc2_tri.is_null()
+            || self.osc2_saw.is_null()
+            || self.ring_mix_out.is_null()
+            || self.ring_mix_a.is_null()
+            || self.ring_mix_b.is_null()
+            || self.filt_env_mod.is_null()
+            || self.filt_vel_mod.is_null()
+            || self.filt_kbd.is_null()
+            || self.filt_cutoff.is_null()
+            || self.filt_resonance.is_null()
+            || self.filt_low_mix.is_null()
+            || self.filt_band_mix.is_null()
+            || self.filt_high_mix.is_null()
+            || self.env_filt_attack.is_null()
+            || self.env_filt_decay.is_null()
+            || self.env_filt_sustain.is_null()
+            || self.env_filt_release.is_null()
+            || self.env_amp_attack.is_null()
+            || self.env_amp_decay.is_null()
+            || self.env_amp_sustain.is_null()
+            || self.env_amp_release.is_null()
+            || self.lfo1_freq.is_null()
+            || self.lfo1_depth.is_null()
+            || self.lfo1_opts.is_null()
+            || self.lfo2_freq.is_null()
+            || self.lfo2_depth.is_null()
+            || self.lfo2_opts.is_null()
+            || self.env1_attack.is_null()
+            || self.env1_decay.is_null()
+            || self.env1_sustain.is_null()
+            || self.env1_release.is_null()
+            || self.env2_attack.is_null()
+            || self.env2_decay.is_null()
+            || self.env2_sustain.is_null()
+            || self.env2_release.is_null()
+    }
+    /// Reborrow all of the parameter buffers as a [VoiceParamsFxP]
+    ///
+    /// # Safety
+    ///
+    /// All pointers must be non-null, unaliased, and valid for
+    /// `offset + samples` elements for the duration of the lifetime `'a`
+    unsafe fn params<'a>(&self, samples: u32, offset: u32) -> VoiceParamsFxP<'a> {
+        VoiceParamsFxP {
+            sync: slice_mut(self.sync.cast::<ScalarFxP>(), samples, offset),
+            osc1_p: MutMixOscParamsFxP {
+                tune: slice_mut(self.osc1_tune.cast::<SignedNoteFxP>(), samples, offset),
+                shape: slice_mut(self.osc1_shape.cast::<ScalarFxP>(), samples, offset),
+                sync: OscSync::Off,
+                sin: slice_mut(self.osc1_sin.cast::<ScalarFxP>(), samples, offset),
+                sq: slice_mut(self.osc1_sq.cast::<ScalarFxP>(), samples, offset),
+                tri: slice_mut(self.osc1_tri.cast::<ScalarFxP>(), samples, offset),
+                saw: slice_mut(self.osc1_saw.cast::<ScalarFxP>(), samples, offset),
+            },
+            unison_voices: 1,
+            unison_detune: fixed_zerobuf::<ScalarFxP>(),
+            osc2_p: MutMixOscParamsFxP {
+                tune: slice_mut(self.osc2_tune.cast::<SignedNoteFxP>(), samples, offset),
+                shape: slice_mut(self.osc2_shape.cast::<ScalarFxP>(), samples, offset),
+                sync: OscSync::Off,
+                sin: slice_mut(self.osc2_sin.cast::<ScalarFxP>(), samples, offset),
+                sq: slice_mut(self.osc2_sq.cast::<ScalarFxP>(), samples, offset),
+                tri: slice_mut(self.osc2_tri.cast::<ScalarFxP>(), samples, offset),
+                saw: slice_mut(self.osc2_saw.cast::<ScalarFxP>(), samples, offset),
+            },
+            ring_p: MutRingModParamsFxP {
+                mix_out: slice_mut(self.ring_mix_out.cast::<ScalarFxP>(), samples, offset),
+                mix_a: slice_mut(self.ring_mix_a.cast::<ScalarFxP>(), samples, offset),
+                mix_b: slice_mut(self.ring_mix_b.cast::<ScalarFxP>(), samples, offset),
+            },
+            filt_p: MutModFiltParamsFxP {
+                env_mod: slice_mut(self.filt_env_mod.cast::<ScalarFxP>(), samples, offset),
+                vel_mod: slice_mut(self.filt_vel_mod.cast::<ScalarFxP>(), samples, offset),
+                kbd: slice_mut(self.filt_kbd.cast::<ScalarFxP>(), samples, offset),
+                cutoff: slice_mut(self.filt_cutoff.cast::<NoteFxP>(), samples, offset),
+                resonance: slice_mut(self.filt_resonance.cast::<ScalarFxP>(), samples, offset),
+                low_mix: slice_mut(self.filt_low_mix.cast::<ScalarFxP>(), samples, offset),
+                band_mix: slice_mut(self.filt_band_mix.cast::<ScalarFxP>(), samples, offset),
+                high_mix: slice_mut(self.filt_high_mix.cast::<ScalarFxP>(), samples, offset),
+                oversample: FiltOversample::Off,
+            },
+            filt_env_p: MutEnvParamsFxP {
+                attack: slice_mut(self.env_filt_attack.cast::<EnvParamFxP>(), samples, offset),
+                decay: slice_mut(self.env_filt_decay.cast::<EnvParamFxP>(), samples, offset),
+                sustain: slice_mut(self.env_filt_sustain.cast::<ScalarFxP>(), samples, offset),
+                release: slice_mut(self.env_filt_release.cast::<EnvParamFxP>(), samples, offset),
+            },
+            amp_env_p: MutEnvParamsFxP {
+                attack: slice_mut(self.env_amp_attack.cast::<EnvParamFxP>(), samples, offset),
+                decay: slice_mut(self.env_amp_decay.cast::<EnvParamFxP>(), samples, offset),
+                sustain: slice_mut(self.env_amp_sustain.cast::<ScalarFxP>(), samples, offset),
+                release: slice_mut(self.env_amp_release.cast::<EnvParamFxP>(), samples, offset),
+            },
+            lfo1_p: LfoParamsFxP {
+                freq: slice(self.lfo1_freq.cast::<LfoFreqFxP>(), samples, offset),
+                depth: slice(self.lfo1_depth.cast::<ScalarFxP>(), samples, offset),
+                opts: slice(self.lfo1_opts.cast::<LfoOptions>(), samples, offset),
+            },
+            lfo2_p: MutLfoParamsFxP {
+                freq: slice_mut(self.lfo2_freq.cast::<LfoFreqFxP>(), samples, offset),
+                depth: slice_mut(self.lfo2_depth.cast::<ScalarFxP>(), samples, offset),
+                opts: slice_mut(self.lfo2_opts.cast::<LfoOptions>(), samples, offset),
+            },
+            env1_p: EnvParamsFxP {
+                attack: slice(self.env1_attack.cast::<EnvParamFxP>(), samples, offset),
+                decay: slice(self.env1_decay.cast::<EnvParamFxP>(), samples, offset),
+                sustain: slice(self.env1_sustain.cast::<ScalarFxP>(), samples, offset),
+                release: slice(self.env1_release.cast::<EnvParamFxP>(), samples, offset),
+            },
+            env2_p: MutEnvParamsFxP {
+                attack: slice_mut(self.env2_attack.cast::<EnvParamFxP>(), samples, offset),
+                decay: slice_mut(self.env2_decay.cast::<EnvParamFxP>(), samples, offset),
+                sustain: slice_mut(self.env2_sustain.cast::<ScalarFxP>(), samples, offset),
+                release: slice_mut(self.env2_release.cast::<EnvParamFxP>(), samples, offset),
+            },
+        }
+    }
+}
+
+/// Build a [ModMatrixFxP] from flat arrays of destinations and depths, both
+/// holding one entry per slot, row-major by [culsynth::voice::modulation::ModSrc].
+/// Unrecognized destination values are treated as no modulation.
+///
+/// # Safety
+///
+/// `dests` and `depths` must be valid for reads of `ModSrc::numel()` times
+/// the number of slots per source (currently 28 total) elements each
+unsafe fn build_matrix_u16(dests: *const u16, depths: *const i16) -> ModMatrixFxP {
+    let mut matrix = ModMatrixFxP::default();
+    for (row, (_src, slots)) in matrix.rows.iter_mut().enumerate() {
+        let nslots = slots.len();
+        for (slot, entry) in slots.iter_mut().enumerate() {
+            let i = ((row * nslots) + slot) as isize;
+            entry.0 = ModDest::try_from(*dests.offset(i)).unwrap_or(ModDest::Null);
+            entry.1 = IScalarFxP::from_bits(*depths.offset(i));
+        }
+    }
+    matrix
+}
+
+/// A [VoiceFxP] bundled with its own [OscScratch], since the C API has no
+/// notion of a caller-provided scratch buffer
+pub struct VoiceU16 {
+    voice: VoiceFxP,
+    scratch: OscScratch<SampleFxP>,
+}
+
+#[no_mangle]
+pub extern "C" fn culsynth_voice_u16_new() -> *mut VoiceU16 {
+    Box::into_raw(Box::new(VoiceU16 {
+        voice: VoiceFxP::new(),
+        scratch: OscScratch::new(),
+    }))
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_voice_u16_free(p: *mut VoiceU16) {
+    if !p.is_null() {
+        let _ = Box::from_raw(p);
+    }
+}
+
+/// Process an entire voice in a single call, avoiding one FFI round-trip
+/// (and one intermediate buffer copy) per device per block.
+///
+/// `mod_dests` and `mod_depths` describe the modulation matrix - see
+/// [build_matrix_u16].  All parameter buffers in `params` must hold at least
+/// `offset + samples` elements; modulated parameters are written back in
+/// place.  On success, `*out` is set to an internal buffer holding the
+/// rendered samples (valid until the next call on this voice) and the number
+/// of samples rendered is returned, which may be less than `samples` -
+/// callers must check it and call again to process the remainder.  Returns
+/// -1 if any pointer is null.
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_voice_u16_process(
+    p: *mut VoiceU16,
+    samples: u32,
+    note: *const u16,
+    gate: *const i16,
+    vel: *const u16,
+    aftertouch: *const u16,
+    modwheel: *const u16,
+    params: *const VoiceParamsU16,
+    mod_dests: *const u16,
+    mod_depths: *const i16,
+    out: *mut *const i16,
+    offset: u32,
+) -> i32 {
+    if p.is_null()
+        || note.is_null()
+        || gate.is_null()
+        || vel.is_null()
+        || aftertouch.is_null()
+        || modwheel.is_null()
+        || params.is_null()
+        || mod_dests.is_null()
+        || mod_depths.is_null()
+        || out.is_null()
+        || (*params).has_null()
+    {
+        return -1;
+    }
+    let note_s = slice(note.cast::<NoteFxP>(), samples, offset);
+    let gate_s = slice(gate.cast::<SampleFxP>(), samples, offset);
+    let vel_s = slice(vel.cast::<ScalarFxP>(), samples, offset);
+    let aftertouch_s = slice(aftertouch.cast::<ScalarFxP>(), samples, offset);
+    let modwheel_s = slice(modwheel.cast::<ScalarFxP>(), samples, offset);
+    let matrix = build_matrix_u16(mod_dests, mod_depths);
+    //FIXME
+    let ctx = ContextFxP::default();
+    let out_slice = (*p).voice.process(
+        &ctx,
+        &matrix,
+        note_s,
+        gate_s,
+        vel_s,
+        aftertouch_s,
+        modwheel_s,
+        (*params).params(samples, offset),
+        &mut (*p).scratch,
+    );
+    *out = out_slice.as_ptr().cast();
+    out_slice.len() as i32
+}
+
+/// Process an arbitrarily long signal through an entire voice in a single
+/// call.  Unlike [culsynth_voice_u16_process], `out` references a
+/// caller-provided buffer holding `samples` elements; this function loops
+/// over internally-sized chunks and copies each chunk's output into it, so
+/// callers need not re-invoke per chunk.  The modulation matrix is built
+/// once up front and held constant over the whole signal.  Returns the
+/// number of samples processed, or -1 if any pointer is null.
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_voice_u16_process_batch(
+    p: *mut VoiceU16,
+    samples: u32,
+    note: *const u16,
+    gate: *const i16,
+    vel: *const u16,
+    aftertouch: *const u16,
+    modwheel: *const u16,
+    params: *const VoiceParamsU16,
+    mod_dests: *const u16,
+    mod_depths: *const i16,
+    out: *mut i16,
+) -> i32 {
+    if p.is_null()
+        || note.is_null()
+        || gate.is_null()
+        || vel.is_null()
+        || aftertouch.is_null()
+        || modwheel.is_null()
+        || params.is_null()
+        || mod_dests.is_null()
+        || mod_depths.is_null()
+        || out.is_null()
+        || (*params).has_null()
+    {
+        return -1;
+    }
+    let matrix = build_matrix_u16(mod_dests, mod_depths);
+    //FIXME
+    let ctx = ContextFxP::default();
+    let mut processed = 0u32;
+    while processed < samples {
+        let remaining = samples - processed;
+        let out_slice = (*p).voice.process(
+            &ctx,
+            &matrix,
+            slice(note.cast::<NoteFxP>(), remaining, processed),
+            slice(gate.cast::<SampleFxP>(), remaining, processed),
+            slice(vel.cast::<ScalarFxP>(), remaining, processed),
+            slice(aftertouch.cast::<ScalarFxP>(), remaining, processed),
+            slice(modwheel.cast::<ScalarFxP>(), remaining, processed),
+            (*params).params(remaining, processed),
+            &mut (*p).scratch,
+        );
+        let n = out_slice.len() as u32;
+        slice_mut(out.cast::<SampleFxP>(), n, processed).copy_from_slice(out_slice);
+        processed += n;
+    }
+    processed as i32
+}
+
+/// A C mirror of [VoiceParams] for `f32`, holding one pointer per parameter
+/// buffer.  Each pointer must reference at least `offset + samples` elements.
+/// The buffers are mutable because the modulation section writes the
+/// modulated parameter values back in place; the `lfo1_*` and `env1_*`
+/// buffers are not modulation targets and are read-only.  LFO options are
+/// packed `u16` values as in [LfoOptions] regardless of sample type.
+#[repr(C)]
+pub struct VoiceParamsF32 {
+    sync: *mut f32,
+    osc1_tune: *mut f32,
+    osc1_shape: *mut f32,
+    osc1_sin: *mut f32,
+    osc1_sq: *mut f32,
+    osc1_tri: *mut f32,
+    osc1_saw: *mut f32,
+    osc2_tune: *mut f32,
+    osc2_shape: *mut f32,
+    osc2_sin: *mut f32,
+    osc2_sq: *mut f32,
+    osc2_tri: *mut f32,
+    osc2_saw: *mut f32,
+    ring_mix_out: *mut f32,
+    ring_mix_a: *mut f32,
+    ring_mix_b: *mut f32,
+    filt_env_mod: *mut f32,
+    filt_vel_mod: *mut f32,
+    filt_kbd: *mut f32,
+    filt_cutoff: *mut f32,
+    filt_resonance: *mut f32,
+    filt_low_mix: *mut f32,
+    filt_band_mix: *mut f32,
+    filt_high_mix: *mut f32,
+    env_filt_attack: *mut f32,
+    env_filt_decay: *mut f32,
+    env_filt_sustain: *mut f32,
+    env_filt_release: *mut f32,
+    env_amp_attack: *mut f32,
+    env_amp_decay: *mut f32,
+    env_amp_sustain: *mut f32,
+    env_amp_release: *mut f32,
+    lfo1_freq: *const f32,
+    lfo1_depth: *const f32,
+    lfo1_opts: *const u16,
+    lfo2_freq: *mut f32,
+    lfo2_depth: *mut f32,
+    lfo2_opts: *mut u16,
+    env1_attack: *const f32,
+    env1_decay: *const f32,
+    env1_sustain: *const f32,
+    env1_release: *const f32,
+    env2_attack: *mut f32,
+    env2_decay: *mut f32,
+    env2_sustain: *mut f32,
+    env2_release: *mut f32,
+}
+
+impl VoiceParamsF32 {
+    fn has_null(&self) -> bool {
+        self.sync.is_null()
+            || self.osc1_tune.is_null()
+            || self.osc1_shape.is_null()
+            || self.osc1_sin.is_null()
+            || self.osc1_sq.is_null()
+            || self.osc1_tri.is_null()
+            || self.osc1_saw.is_null()
+            || self.osc2_tune.is_null()
+            || self.osc2_shape.is_null()
+            || self.osc2_sin.is_null()
+            || self.osc2_sq.is_null()
+            || self.osc2_tri.is_null()
+            || self.osc2_saw.is_null()
+            || self.ring_mix_out.is_null()
+            || self.ring_mix_a.is_null()
+            || self.ring_mix_b.is_null()
+            || self.filt_env_mod.is_null()
+            || self.filt_vel_mod.is_null()
+            || self.filt_kbd.is_null()
+            || self.filt_cutoff.is_null()
+            || self.filt_resonance.is_null()
+            || self.filt_low_mix.is_null()
+            || self.filt_band_mix.is_null()
+            || self.filt_high_mix.is_null()
+            || self.env_filt_attack.is_null()
+            || self.env_filt_decay.is_null()
+            || self.env_filt_sustain.is_null()
+            || self.env_filt_release.is_null()
+            || self.env_amp_attack.is_null()
+            || self.env_amp_decay.is_null()
+            || self.env_amp_sustain.is_null()
+            || self.env_amp_release.is_null()
+            || self.lfo1_freq.is_null()
+            || self.lfo1_depth.is_null()
+            || self.lfo1_opts.is_null()
+            || self.lfo2_freq.is_null()
+            || self.lfo2_depth.is_null()
+            || self.lfo2_opts.is_null()
+            || self.env1_attack.is_null()
+            || self.env1_decay.is_null()
+            || self.env1_sustain.is_null()
+            || self.env1_release.is_null()
+            || self.env2_attack.is_null()
+            || self.env2_decay.is_null()
+            || self.env2_sustain.is_null()
+            || self.env2_release.is_null()
+    }
+    /// Reborrow all of the parameter buffers as a [VoiceParams]
+    ///
+    /// # Safety
+    ///
+    /// All pointers must be non-null, unaliased, and valid for
+    /// `offset + samples` elements for the duration of the lifetime `'a`
+    unsafe fn params<'a>(&self, samples: u32, offset: u32) -> VoiceParams<'a, f32> {
+        VoiceParams {
+            sync: slice_mut(self.sync, samples, offset),
+            osc1_p: MutMixOscParams {
+                tune: slice_mut(self.osc1_tune, samples, offset),
+                shape: slice_mut(self.osc1_shape, samples, offset),
+                sync: OscSync::Off,
+                sin: slice_mut(self.osc1_sin, samples, offset),
+                sq: slice_mut(self.osc1_sq, samples, offset),
+                tri: slice_mut(self.osc1_tri, samples, offset),
+                saw: slice_mut(self.osc1_saw, samples, offset),
+            },
+            unison_voices: 1,
+            unison_detune: f32::zerobuf(),
+            osc2_p: MutMixOscParams {
+                tune: slice_mut(self.osc2_tune, samples, offset),
+                shape: slice_mut(self.osc2_shape, samples, offset),
+                sync: OscSync::Off,
+                sin: slice_mut(self.osc2_sin, samples, offset),
+                sq: slice_mut(self.osc2_sq, samples, offset),
+                tri: slice_mut(self.osc2_tri, samples, offset),
+                saw: slice_mut(self.osc2_saw, samples, offset),
+            },
+            ring_p: MutRingModParams {
+                mix_out: slice_mut(self.ring_mix_out, samples, offset),
+                mix_a: slice_mut(self.ring_mix_a, samples, offset),
+                mix_b: slice_mut(self.ring_mix_b, samples, offset),
+            },
+            filt_p: MutModFiltParams {
+                env_mod: slice_mut(self.filt_env_mod, samples, offset),
+                vel_mod: slice_mut(self.filt_vel_mod, samples, offset),
+                kbd: slice_mut(self.filt_kbd, samples, offset),
+                cutoff: slice_mut(self.filt_cutoff, samples, offset),
+                resonance: slice_mut(self.filt_resonance, samples, offset),
+                low_mix: slice_mut(self.filt_low_mix, samples, offset),
+                band_mix: slice_mut(self.filt_band_mix, samples, offset),
+                high_mix: slice_mut(self.filt_high_mix, samples, offset),
+                oversample: FiltOversample::Off,
+            },
+            filt_env_p: MutEnvParams {
+                attack: slice_mut(self.env_filt_attack, samples, offset),
+                decay: slice_mut(self.env_filt_decay, samples, offset),
+                sustain: slice_mut(self.env_filt_sustain, samples, offset),
+                release: slice_mut(self.env_filt_release, samples, offset),
+            },
+            amp_env_p: MutEnvParams {
+                attack: slice_mut(self.env_amp_attack, samples, offset),
+                decay: slice_mut(self.env_amp_decay, samples, offset),
+                sustain: slice_mut(self.env_amp_sustain, samples, offset),
+                release: slice_mut(self.env_amp_release, samples, offset),
+            },
+            lfo1_p: LfoParams {
+                freq: slice(self.lfo1_freq, samples, offset),
+                depth: slice(self.lfo1_depth, samples, offset),
+                opts: slice(self.lfo1_opts.cast::<LfoOptions>(), samples, offset),
+            },
+            lfo2_p: MutLfoParams {
+                freq: slice_mut(self.lfo2_freq, samples, offset),
+                depth: slice_mut(self.lfo2_depth, samples, offset),
+                opts: slice_mut(self.lfo2_opts.cast::<LfoOptions>(), samples, offset),
+            },
+            env1_p: EnvParams {
+                attack: slice(self.env1_attack, samples, offset),
+                decay: slice(self.env1_decay, samples, offset),
+                sustain: slice(self.env1_sustain, samples, offset),
+                release: slice(self.env1_release, samples, offset),
+            },
+            env2_p: MutEnvParams {
+                attack: slice_mut(self.env2_attack, samples, offset),
+                decay: slice_mut(self.env2_decay, samples, offset),
+                sustain: slice_mut(self.env2_sustain, samples, offset),
+                release: slice_mut(self.env2_release, samples, offset),
+            },
+        }
+    }
+}
+
+/// Build a [ModMatrix] from flat arrays of destinations and depths, both
+/// holding one entry per slot, row-major by [culsynth::voice::modulation::ModSrc].
+/// Unrecognized destination values are treated as no modulation.
+///
+/// # Safety
+///
+/// `dests` and `depths` must be valid for reads of `ModSrc::numel()` times
+/// the number of slots per source (currently 28 total) elements each
+unsafe fn build_matrix_f32(dests: *const u16, depths: *const f32) -> ModMatrix<f32> {
+    let mut matrix = ModMatrix::<f32>::default();
+    for (row, (_src, slots)) in matrix.rows.iter_mut().enumerate() {
+        let nslots = slots.len();
+        for (slot, entry) in slots.iter_mut().enumerate() {
+            let i = ((row * nslots) + slot) as isize;
+            entry.0 = ModDest::try_from(*dests.offset(i)).unwrap_or(ModDest::Null);
+            entry.1 = *depths.offset(i);
+        }
+    }
+    matrix
+}
+
+/// A [Voice] bundled with its own [OscScratch], since the C API has no
+/// notion of a caller-provided scratch buffer
+pub struct VoiceF32 {
+    voice: Voice<f32>,
+    scratch: OscScratch<f32>,
+}
+
+#[no_mangle]
+pub extern "C" fn culsynth_voice_f32_new() -> *mut VoiceF32 {
+    Box::into_raw(Box::new(VoiceF32 {
+        voice: Voice::new(),
+        scratch: OscScratch::new(),
+    }))
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_voice_f32_free(p: *mut VoiceF32) {
+    if !p.is_null() {
+        let _ = Box::from_raw(p);
+    }
+}
+
+/// Process an entire voice in a single call, avoiding one FFI round-trip
+/// (and one intermediate buffer copy) per device per block.
+///
+/// `mod_dests` and `mod_depths` describe the modulation matrix - see
+/// [build_matrix_f32].  All parameter buffers in `params` must hold at least
+/// `offset + samples` elements; modulated parameters are written back in
+/// place.  On success, `*out` is set to an internal buffer holding the
+/// rendered samples (valid until the next call on this voice) and the number
+/// of samples rendered is returned, which may be less than `samples` -
+/// callers must check it and call again to process the remainder.  Returns
+/// -1 if any pointer is null.
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_voice_f32_process(
+    p: *mut VoiceF32,
+    samples: u32,
+    note: *const f32,
+    gate: *const f32,
+    vel: *const f32,
+    aftertouch: *const f32,
+    modwheel: *const f32,
+    params: *const VoiceParamsF32,
+    mod_dests: *const u16,
+    mod_depths: *const f32,
+    out: *mut *const f32,
+    offset: u32,
+) -> i32 {
+    if p.is_null()
+        || note.is_null()
+        || gate.is_null()
+        || vel.is_null()
+        || aftertouch.is_null()
+        || modwheel.is_null()
+        || params.is_null()
+        || mod_dests.is_null()
+        || mod_depths.is_null()
+        || out.is_null()
+        || (*params).has_null()
+    {
+        return -1;
+    }
+    let note_s = slice(note, samples, offset);
+    let gate_s = slice(gate, samples, offset);
+    let vel_s = slice(vel, samples, offset);
+    let aftertouch_s = slice(aftertouch, samples, offset);
+    let modwheel_s = slice(modwheel, samples, offset);
+    let matrix = build_matrix_f32(mod_dests, mod_depths);
+    //FIXME
+    let ctx = Context::<f32>::new(44100f32);
+    let out_slice = (*p).voice.process(
+        &ctx,
+        &matrix,
+        note_s,
+        gate_s,
+        vel_s,
+        aftertouch_s,
+        modwheel_s,
+        (*params).params(samples, offset),
+        &mut (*p).scratch,
+    );
+    *out = out_slice.as_ptr().cast();
+    out_slice.len() as i32
+}
+
+/// Process an arbitrarily long signal through an entire voice in a single
+/// call, writing the output into a caller-provided buffer of `samples`
+/// elements - see [culsynth_voice_u16_process_batch].  Returns the number
+/// of samples processed, or -1 if any pointer is null.
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_voice_f32_process_batch(
+    p: *mut VoiceF32,
+    samples: u32,
+    note: *const f32,
+    gate: *const f32,
+    vel: *const f32,
+    aftertouch: *const f32,
+    modwheel: *const f32,
+    params: *const VoiceParamsF32,
+    mod_dests: *const u16,
+    mod_depths: *const f32,
+    out: *mut f32,
+) -> i32 {
+    if p.is_null()
+        || note.is_null()
+        || gate.is_null()
+        || vel.is_null()
+        || aftertouch.is_null()
+        || modwheel.is_null()
+        || params.is_null()
+        || mod_dests.is_null()
+        || mod_depths.is_null()
+        || out.is_null()
+        || (*params).has_null()
+    {
+        return -1;
+    }
+    let matrix = build_matrix_f32(mod_dests, mod_depths);
+    //FIXME
+    let ctx = Context::<f32>::new(44100f32);
+    let mut processed = 0u32;
+    while processed < samples {
+        let remaining = samples - processed;
+        let out_slice = (*p).voice.process(
+            &ctx,
+            &matrix,
+            slice(note, remaining, processed),
+            slice(gate, remaining, processed),
+            slice(vel, remaining, processed),
+            slice(aftertouch, remaining, processed),
+            slice(modwheel, remaining, processed),
+            (*params).params(remaining, processed),
+            &mut (*p).scratch,
+        );
+        let n = out_slice.len() as u32;
+        slice_mut(out, n, processed).copy_from_slice(out_slice);
+        processed += n;
+    }
+    processed as i32
+}
+
+/// A fixed-capacity arena for a single object type.  The backing [Vec] is
+/// reserved up front and never grows past its initial capacity, so pointers
+/// to its elements stay valid until the arena is reset or dropped.
+struct PoolArena<T> {
+    items: Vec<T>,
+}
+
+impl<T> PoolArena<T> {
+    fn new(capacity: usize) -> Self {
+        Self {
+            items: Vec::with_capacity(capacity),
+        }
+    }
+    fn alloc(&mut self, item: T) -> *mut T {
+        if self.items.len() == self.items.capacity() {
+            return std::ptr::null_mut();
+        }
+        self.items.push(item);
+        // Safe to hand out: the arena never reallocates (see above), and the
+        // element is not dropped until reset() or the arena itself goes away
+        self.items.last_mut().unwrap()
+    }
+    fn reset(&mut self) {
+        self.items.clear();
+    }
+}
+
+/// An object pool for the allocation API.  Objects of each type are
+/// bump-allocated out of a contiguous, fixed-capacity arena per type instead
+/// of individually boxed, so a host building many voices at startup performs
+/// one allocation per type rather than one per object, gets deterministic
+/// construction time, and keeps related state (in particular, all of the
+/// devices of each voice, which live inline in [VoiceU16]/[VoiceF32])
+/// adjacent in memory.  Everything is freed in bulk when the pool is
+/// destroyed.
+pub struct CulSynthPool {
+    amp_u16: PoolArena<AmpFxP>,
+    amp_f32: PoolArena<Amp<f32>>,
+    env_u16: PoolArena<EnvFxP>,
+    env_f32: PoolArena<Env<f32>>,
+    filt_u16: PoolArena<FiltFxP>,
+    filt_f32: PoolArena<Filt<f32>>,
+    osc_u16: PoolArena<OscU16>,
+    osc_f32: PoolArena<OscF32>,
+    voice_u16: PoolArena<VoiceU16>,
+    voice_f32: PoolArena<VoiceF32>,
+}
+
+/// Create a new object pool that can hold up to `capacity` objects of each
+/// type.  All arenas are allocated (and their backing pages touched by the
+/// zero-initialization) up front, so no allocation happens on the later
+/// `culsynth_pool_*_new` calls.
+#[no_mangle]
+pub extern "C" fn culsynth_pool_new(capacity: u32) -> *mut CulSynthPool {
+    let capacity = capacity as usize;
+    Box::into_raw(Box::new(CulSynthPool {
+        amp_u16: PoolArena::new(capacity),
+        amp_f32: PoolArena::new(capacity),
+        env_u16: PoolArena::new(capacity),
+        env_f32: PoolArena::new(capacity),
+        filt_u16: PoolArena::new(capacity),
+        filt_f32: PoolArena::new(capacity),
+        osc_u16: PoolArena::new(capacity),
+        osc_f32: PoolArena::new(capacity),
+        voice_u16: PoolArena::new(capacity),
+        voice_f32: PoolArena::new(capacity),
+    }))
+}
+
+/// Destroy a pool and bulk-free every object allocated from it.
+///
+/// # Safety
+///
+/// `p` must be a pointer returned by [culsynth_pool_new] that has not
+/// already been freed.  All handles allocated from the pool are invalidated
+/// and must not be used afterwards.
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_pool_free(p: *mut CulSynthPool) {
+    if !p.is_null() {
+        let _ = Box::from_raw(p);
+    }
+}
+
+/// Drop every object allocated from the pool while retaining the arenas
+/// themselves, so the pool can be reused from a clean slate without going
+/// back to the system allocator.
+///
+/// # Safety
+///
+/// `p` must be a valid pool.  All handles previously allocated from it are
+/// invalidated and must not be used afterwards.
+#[no_mangle]
+pub unsafe extern "C" fn culsynth_pool_reset(p: *mut CulSynthPool) {
+    if p.is_null() {
+        return;
+    }
+    let pool = &mut *p;
+    pool.amp_u16.reset();
+    pool.amp_f32.reset();
+    pool.env_u16.reset();
+    pool.env_f32.reset();
+    pool.filt_u16.reset();
+    pool.filt_f32.reset();
+    pool.osc_u16.reset();
+    pool.osc_f32.reset();
+    pool.voice_u16.reset();
+    pool.voice_f32.reset();
+}
+
+/// Generate the pool-allocating counterpart of a `culsynth_*_new`
+/// constructor.  The returned object lives in the pool's arena for its type:
+/// it must NOT be passed to the corresponding `culsynth_*_free` function,
+/// and it remains valid until the pool is reset or destroyed.  Returns null
+/// if the pool pointer is null or the arena for this type is exhausted.
+macro_rules! pool_new {
+    ($(#[$attr:meta])* $name:ident, $arena:ident, $ty:ty, $init:expr) => {
+        $(#[$attr])*
+        /// # Safety
+        ///
+        /// `p` must be null or a valid pool.  The returned handle must not
+        /// be passed to the corresponding `free` function and is
+        /// invalidated by [culsynth_pool_reset] and [culsynth_pool_free].
+        #[no_mangle]
+        pub unsafe extern "C" fn $name(p: *mut CulSynthPool) -> *mut $ty {
+            if p.is_null() {
+                return std::ptr::null_mut();
+            }
+            (*p).$arena.alloc($init)
+        }
+    };
+}
+
+pool_new!(
+    /// Allocate an [AmpFxP] from the pool - see [culsynth_amp_u16_new]
+    culsynth_pool_amp_u16_new,
+    amp_u16,
+    AmpFxP,
+    AmpFxP::new()
+);
+pool_new!(
+    /// Allocate an [Amp] from the pool - see [culsynth_amp_f32_new]
+    culsynth_pool_amp_f32_new,
+    amp_f32,
+    Amp<f32>,
+    Amp::new()
+);
+pool_new!(
+    /// Allocate an [EnvFxP] from the pool - see [culsynth_env_u16_new]
+    culsynth_pool_env_u16_new,
+    env_u16,
+    EnvFxP,
+    EnvFxP::new()
+);
+pool_new!(
+    /// Allocate an [Env] from the pool - see [culsynth_env_f32_new]
+    culsynth_pool_env_f32_new,
+    env_f32,
+    Env<f32>,
+    Env::new()
+);
+pool_new!(
+    /// Allocate a [FiltFxP] from the pool - see [culsynth_filt_u16_new]
+    culsynth_pool_filt_u16_new,
+    filt_u16,
+    FiltFxP,
+    FiltFxP::new()
+);
+pool_new!(
+    /// Allocate a [Filt] from the pool - see [culsynth_filt_f32_new]
+    culsynth_pool_filt_f32_new,
+    filt_f32,
+    Filt<f32>,
+    Filt::new()
+);
+pool_new!(
+    /// Allocate an [OscU16] from the pool - see [culsynth_osc_u16_new]
+    culsynth_pool_osc_u16_new,
+    osc_u16,
+    OscU16,
+    OscU16 {
+        osc: OscFxP::new(),
+        scratch: OscScratch::new(),
+    }
+);
+pool_new!(
+    /// Allocate an [OscF32] from the pool - see [culsynth_osc_f32_new]
+    culsynth_pool_osc_f32_new,
+    osc_f32,
+    OscF32,
+    OscF32 {
+        osc: Osc::new(),
+        scratch: OscScratch::new(),
+    }
+);
+pool_new!(
+    /// Allocate a [VoiceU16] from the pool - see [culsynth_voice_u16_new].
+    /// Voices allocated back-to-back are contiguous in memory, and all of a
+    /// voice's devices live inline within it, so a bank of voices built this
+    /// way keeps each voice's working set on adjacent cache lines.
+    culsynth_pool_voice_u16_new,
+    voice_u16,
+    VoiceU16,
+    VoiceU16 {
+        voice: VoiceFxP::new(),
+        scratch: OscScratch::new(),
+    }
+);
+pool_new!(
+    /// Allocate a [VoiceF32] from the pool - see [culsynth_voice_f32_new].
+    /// Voices allocated back-to-back are contiguous in memory, and all of a
+    /// voice's devices live inline within it, so a bank of voices built this
+    /// way keeps each voice's working set on adjacent cache lines.
+    culsynth_pool_voice_f32_new,
+    voice_f32,
+    VoiceF32,
+    VoiceF32 {
+        voice: Voice::new(),
+        scratch: OscScratch::new(),
+    }
+);
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use culsynth::STATIC_BUFFER_SIZE;
+
+    /// One internally-sized chunk, for the single-shot `process` entry
+    /// points (which may return fewer samples than requested)
+    const N: u32 = 64;
+    /// More than one internal buffer, so the `process_batch` entry points
+    /// have to take their chunking loop through a short final chunk
+    const BATCH: usize = STATIC_BUFFER_SIZE + 37;
+
+    #[test]
+    fn amp_u16_smoke() {
+        let signal = [SampleFxP::ONE; N as usize];
+        let gain = [SampleFxP::ONE; N as usize];
+        let mut out: *const u16 = std::ptr::null();
+        let p = culsynth_amp_u16_new();
+        assert!(!p.is_null());
+        unsafe {
+            assert_eq!(
+                culsynth_amp_u16_process(
+                    std::ptr::null_mut(),
+                    N,
+                    signal.as_ptr().cast(),
+                    gain.as_ptr().cast(),
+                    &mut out,
+                    0,
+                ),
+                -1
+            );
+            let n = culsynth_amp_u16_process(
+                p,
+                N,
+                signal.as_ptr().cast(),
+                gain.as_ptr().cast(),
+                &mut out,
+                0,
+            );
+            assert!(n > 0 && n as u32 <= N);
+            assert!(!out.is_null());
+            culsynth_amp_u16_free(p);
+        }
+    }
+
+    #[test]
+    fn amp_f32_smoke() {
+        let signal = [1f32; N as usize];
+        let gain = [1f32; N as usize];
+        let mut out: *const f32 = std::ptr::null();
+        let p = culsynth_amp_f32_new();
+        assert!(!p.is_null());
+        unsafe {
+            assert_eq!(
+                culsynth_amp_f32_process(
+                    std::ptr::null_mut(),
+                    N,
+                    signal.as_ptr(),
+                    gain.as_ptr(),
+                    &mut out,
+                    0,
+                ),
+                -1
+            );
+            let n = culsynth_amp_f32_process(p, N, signal.as_ptr(), gain.as_ptr(), &mut out, 0);
+            assert!(n > 0 && n as u32 <= N);
+            assert!(!out.is_null());
+            // Unity gain is a passthrough:
+            assert_eq!(*out, 1f32);
+            culsynth_amp_f32_free(p);
+        }
+    }
+
+    #[test]
+    fn env_u16_smoke() {
+        let gate = [SampleFxP::ONE; BATCH];
+        let attack = [EnvParamFxP::lit("0.1"); BATCH];
+        let decay = [EnvParamFxP::lit("0.1"); BATCH];
+        let sustain = [ScalarFxP::MAX; BATCH];
+        let release = [EnvParamFxP::lit("0.1"); BATCH];
+        let mut signal: *const u16 = std::ptr::null();
+        let mut batch_out = [ScalarFxP::ZERO; BATCH];
+        let p = culsynth_env_u16_new();
+        assert!(!p.is_null());
+        unsafe {
+            assert_eq!(
+                culsynth_env_u16_process(
+                    std::ptr::null_mut(),
+                    N,
+                    gate.as_ptr().cast(),
+                    attack.as_ptr().cast(),
+                    decay.as_ptr().cast(),
+                    sustain.as_ptr().cast(),
+                    release.as_ptr().cast(),
+                    &mut signal,
+                    0,
+                ),
+                -1
+            );
+            let n = culsynth_env_u16_process(
+                p,
+                N,
+                gate.as_ptr().cast(),
+                attack.as_ptr().cast(),
+                decay.as_ptr().cast(),
+                sustain.as_ptr().cast(),
+                release.as_ptr().cast(),
+                &mut signal,
+                0,
+            );
+            assert!(n > 0 && n as u32 <= N);
+            assert!(!signal.is_null());
+            assert_eq!(
+                culsynth_env_u16_process_batch(
+                    p,
+                    BATCH as u32,
+                    gate.as_ptr().cast(),
+                    attack.as_ptr().cast(),
+                    decay.as_ptr().cast(),
+                    sustain.as_ptr().cast(),
+                    release.as_ptr().cast(),
+                    batch_out.as_mut_ptr().cast(),
+                ),
+                BATCH as i32
+            );
+            // The gate has been held for over a full buffer, so the attack
+            // segment must be underway by the end of the batch:
+            assert!(batch_out[BATCH - 1] > ScalarFxP::ZERO);
+            culsynth_env_u16_free(p);
+        }
+    }
+
+    #[test]
+    fn env_f32_smoke() {
+        let gate = [1f32; BATCH];
+        let attack = [0.1f32; BATCH];
+        let decay = [0.1f32; BATCH];
+        let sustain = [1f32; BATCH];
+        let release = [0.1f32; BATCH];
+        let mut signal: *const f32 = std::ptr::null();
+        let mut batch_out = [0f32; BATCH];
+        let p = culsynth_env_f32_new();
+        assert!(!p.is_null());
+        unsafe {
+            let n = culsynth_env_f32_process(
+                p,
+                N,
+                gate.as_ptr(),
+                attack.as_ptr(),
+                decay.as_ptr(),
+                sustain.as_ptr(),
+                release.as_ptr(),
+                &mut signal,
+                0,
+            );
+            assert!(n > 0 && n as u32 <= N);
+            assert!(!signal.is_null());
+            assert_eq!(
+                culsynth_env_f32_process_batch(
+                    p,
+                    BATCH as u32,
+                    gate.as_ptr(),
+                    attack.as_ptr(),
+                    decay.as_ptr(),
+                    sustain.as_ptr(),
+                    release.as_ptr(),
+                    batch_out.as_mut_ptr(),
+                ),
+                BATCH as i32
+            );
+            assert!(batch_out[BATCH - 1] > 0f32);
+            culsynth_env_f32_free(p);
+        }
+    }
+
+    #[test]
+    fn filt_u16_smoke() {
+        let input = [SampleFxP::ONE; BATCH];
+        let cutoff = [NoteFxP::MAX; BATCH];
+        let resonance = [ScalarFxP::ZERO; BATCH];
+        let mut low: *const i16 = std::ptr::null();
+        let mut band: *const i16 = std::ptr::null();
+        let mut high: *const i16 = std::ptr::null();
+        let mut low_b = [SampleFxP::ZERO; BATCH];
+        let mut band_b = [SampleFxP::ZERO; BATCH];
+        let mut high_b = [SampleFxP::ZERO; BATCH];
+        let p = culsynth_filt_u16_new();
+        assert!(!p.is_null());
+        unsafe {
+            let n = culsynth_filt_u16_process(
+                p,
+                N,
+                input.as_ptr().cast(),
+                cutoff.as_ptr().cast(),
+                resonance.as_ptr().cast(),
+                &mut low,
+                &mut band,
+                &mut high,
+                0,
+            );
+            assert!(n > 0 && n as u32 <= N);
+            assert!(!low.is_null() && !band.is_null() && !high.is_null());
+            assert_eq!(
+                culsynth_filt_u16_process_batch(
+                    p,
+                    BATCH as u32,
+                    input.as_ptr().cast(),
+                    cutoff.as_ptr().cast(),
+                    resonance.as_ptr().cast(),
+                    low_b.as_mut_ptr().cast(),
+                    band_b.as_mut_ptr().cast(),
+                    high_b.as_mut_ptr().cast(),
+                ),
+                BATCH as i32
+            );
+            // A fully-open low-pass passes DC:
+            assert!(low_b[BATCH - 1] > SampleFxP::lit("0.5"));
+            culsynth_filt_u16_free(p);
+        }
+    }
+
+    #[test]
+    fn filt_f32_smoke() {
+        let input = [1f32; BATCH];
+        let cutoff = [127f32; BATCH];
+        let resonance = [0f32; BATCH];
+        let mut low: *const f32 = std::ptr::null();
+        let mut band: *const f32 = std::ptr::null();
+        let mut high: *const f32 = std::ptr::null();
+        let mut low_b = [0f32; BATCH];
+        let mut band_b = [0f32; BATCH];
+        let mut high_b = [0f32; BATCH];
+        let p = culsynth_filt_f32_new();
+        assert!(!p.is_null());
+        unsafe {
+            let n = culsynth_filt_f32_process(
+                p,
+                N,
+                input.as_ptr(),
+                cutoff.as_ptr(),
+                resonance.as_ptr(),
+                &mut low,
+                &mut band,
+                &mut high,
+                0,
+            );
+            assert!(n > 0 && n as u32 <= N);
+            assert!(!low.is_null() && !band.is_null() && !high.is_null());
+            assert_eq!(
+                culsynth_filt_f32_process_batch(
+                    p,
+                    BATCH as u32,
+                    input.as_ptr(),
+                    cutoff.as_ptr(),
+                    resonance.as_ptr(),
+                    low_b.as_mut_ptr(),
+                    band_b.as_mut_ptr(),
+                    high_b.as_mut_ptr(),
+                ),
+                BATCH as i32
+            );
+            assert!(low_b[BATCH - 1] > 0.5f32);
+            culsynth_filt_f32_free(p);
+        }
+    }
+
+    #[test]
+    fn osc_u16_smoke() {
+        let note = [NoteFxP::lit("69"); BATCH];
+        let tune = [SignedNoteFxP::ZERO; BATCH];
+        let shape = [ScalarFxP::ZERO; BATCH];
+        let mut sin: *const i16 = std::ptr::null();
+        let mut tri: *const i16 = std::ptr::null();
+        let mut sq: *const i16 = std::ptr::null();
+        let mut saw: *const i16 = std::ptr::null();
+        let mut sin_b = [SampleFxP::ZERO; BATCH];
+        let mut tri_b = [SampleFxP::ZERO; BATCH];
+        let mut sq_b = [SampleFxP::ZERO; BATCH];
+        let mut saw_b = [SampleFxP::ZERO; BATCH];
+        let p = culsynth_osc_u16_new();
+        assert!(!p.is_null());
+        unsafe {
+            let n = culsynth_osc_u16_process(
+                p,
+                N,
+                note.as_ptr().cast(),
+                tune.as_ptr().cast(),
+                shape.as_ptr().cast(),
+                &mut sin,
+                &mut tri,
+                &mut sq,
+                &mut saw,
+                0,
+            );
+            assert!(n > 0 && n as u32 <= N);
+            assert!(!sin.is_null() && !tri.is_null() && !sq.is_null() && !saw.is_null());
+            assert_eq!(
+                culsynth_osc_u16_process_batch(
+                    p,
+                    BATCH as u32,
+                    note.as_ptr().cast(),
+                    tune.as_ptr().cast(),
+                    shape.as_ptr().cast(),
+                    sin_b.as_mut_ptr().cast(),
+                    tri_b.as_mut_ptr().cast(),
+                    sq_b.as_mut_ptr().cast(),
+                    saw_b.as_mut_ptr().cast(),
+                ),
+                BATCH as i32
+            );
+            // A440 completes several cycles over the batch, so every
+            // waveform must have swung away from zero somewhere:
+            assert!(saw_b.iter().any(|x| *x != SampleFxP::ZERO));
+            assert!(sq_b.iter().any(|x| *x != SampleFxP::ZERO));
+            culsynth_osc_u16_free(p);
+        }
+    }
+
+    #[test]
+    fn osc_f32_smoke() {
+        let note = [69f32; BATCH];
+        let tune = [0f32; BATCH];
+        let shape = [0f32; BATCH];
+        let mut sin: *const f32 = std::ptr::null();
+        let mut tri: *const f32 = std::ptr::null();
+        let mut sq: *const f32 = std::ptr::null();
+        let mut saw: *const f32 = std::ptr::null();
+        let mut sin_b = [0f32; BATCH];
+        let mut tri_b = [0f32; BATCH];
+        let mut sq_b = [0f32; BATCH];
+        let mut saw_b = [0f32; BATCH];
+        let p = culsynth_osc_f32_new();
+        assert!(!p.is_null());
+        unsafe {
+            let n = culsynth_osc_f32_process(
+                p,
+                N,
+                note.as_ptr(),
+                tune.as_ptr(),
+                shape.as_ptr(),
+                &mut sin,
+                &mut tri,
+                &mut sq,
+                &mut saw,
+                0,
+            );
+            assert!(n > 0 && n as u32 <= N);
+            assert!(!sin.is_null() && !tri.is_null() && !sq.is_null() && !saw.is_null());
+            assert_eq!(
+                culsynth_osc_f32_process_batch(
+                    p,
+                    BATCH as u32,
+                    note.as_ptr(),
+                    tune.as_ptr(),
+                    shape.as_ptr(),
+                    sin_b.as_mut_ptr(),
+                    tri_b.as_mut_ptr(),
+                    sq_b.as_mut_ptr(),
+                    saw_b.as_mut_ptr(),
+                ),
+                BATCH as i32
+            );
+            assert!(saw_b.iter().any(|x| *x != 0f32));
+            culsynth_osc_f32_free(p);
+        }
+    }
+
+    /// The number of modulation matrix slots (see [build_matrix_u16])
+    const MATRIX_SLOTS: usize = 28;
+
+    /// Owned, non-aliased backing buffers for a [VoiceParamsU16]: a basic
+    /// saw patch with full sustain and an open low-pass filter.  Each
+    /// parameter gets its own row since the reborrowed slices may not alias.
+    struct VoiceBufsU16 {
+        // sync; osc1 shape/sin/sq/tri/saw; osc2 likewise; ring out/a/b;
+        // filt env_mod/vel_mod/kbd/resonance/low/band/high; filt and amp
+        // env sustain; lfo1/lfo2 depth; env1/env2 sustain:
+        scalars: [[ScalarFxP; BATCH]; 27],
+        tunes: [[SignedNoteFxP; BATCH]; 2],
+        cutoff: [NoteFxP; BATCH],
+        // attack/decay/release for env_filt, env_amp, env1, then env2:
+        env_times: [[EnvParamFxP; BATCH]; 12],
+        lfo_freqs: [[LfoFreqFxP; BATCH]; 2],
+        lfo_opts: [[LfoOptions; BATCH]; 2],
+    }
+
+    impl VoiceBufsU16 {
+        fn new() -> Self {
+            let mut scalars = [[ScalarFxP::ZERO; BATCH]; 27];
+            // osc1 saw gain, ring mix_a, filter low_mix, and all sustains:
+            for i in [5, 12, 18, 21, 22, 25, 26] {
+                scalars[i] = [ScalarFxP::MAX; BATCH];
+            }
+            Self {
+                scalars,
+                tunes: [[SignedNoteFxP::ZERO; BATCH]; 2],
+                cutoff: [NoteFxP::MAX; BATCH],
+                env_times: [[EnvParamFxP::lit("0.1"); BATCH]; 12],
+                lfo_freqs: [[LfoFreqFxP::ONE; BATCH]; 2],
+                lfo_opts: [[LfoOptions::default(); BATCH]; 2],
+            }
+        }
+        fn params(&mut self) -> VoiceParamsU16 {
+            let s = |buf: &mut [ScalarFxP; BATCH]| buf.as_mut_ptr().cast::<u16>();
+            let e = |buf: &mut [EnvParamFxP; BATCH]| buf.as_mut_ptr().cast::<u16>();
+            let [sync, o1_shape, o1_sin, o1_sq, o1_tri, o1_saw, o2_shape, o2_sin, o2_sq, o2_tri, o2_saw, ring_out, ring_a, ring_b, f_em, f_vm, f_kbd, f_res, f_low, f_band, f_high, fe_sus, ae_sus, lfo1_depth, lfo2_depth, e1_sus, e2_sus] =
+                &mut self.scalars;
+            let [tune1, tune2] = &mut self.tunes;
+            let [fe_a, fe_d, fe_r, ae_a, ae_d, ae_r, e1_a, e1_d, e1_r, e2_a, e2_d, e2_r] =
+                &mut self.env_times;
+            let [lfo1_freq, lfo2_freq] = &mut self.lfo_freqs;
+            let [lfo1_opts, lfo2_opts] = &mut self.lfo_opts;
+            VoiceParamsU16 {
+                sync: s(sync),
+                osc1_tune: tune1.as_mut_ptr().cast(),
+                osc1_shape: s(o1_shape),
+                osc1_sin: s(o1_sin),
+                osc1_sq: s(o1_sq),
+                osc1_tri: s(o1_tri),
+                osc1_saw: s(o1_saw),
+                osc2_tune: tune2.as_mut_ptr().cast(),
+                osc2_shape: s(o2_shape),
+                osc2_sin: s(o2_sin),
+                osc2_sq: s(o2_sq),
+                osc2_tri: s(o2_tri),
+                osc2_saw: s(o2_saw),
+                ring_mix_out: s(ring_out),
+                ring_mix_a: s(ring_a),
+                ring_mix_b: s(ring_b),
+                filt_env_mod: s(f_em),
+                filt_vel_mod: s(f_vm),
+                filt_kbd: s(f_kbd),
+                filt_cutoff: self.cutoff.as_mut_ptr().cast(),
+                filt_resonance: s(f_res),
+                filt_low_mix: s(f_low),
+                filt_band_mix: s(f_band),
+                filt_high_mix: s(f_high),
+                env_filt_attack: e(fe_a),
+                env_filt_decay: e(fe_d),
+                env_filt_sustain: s(fe_sus),
+                env_filt_release: e(fe_r),
+                env_amp_attack: e(ae_a),
+                env_amp_decay: e(ae_d),
+                env_amp_sustain: s(ae_sus),
+                env_amp_release: e(ae_r),
+                lfo1_freq: lfo1_freq.as_ptr().cast(),
+                lfo1_depth: lfo1_depth.as_ptr().cast(),
+                lfo1_opts: lfo1_opts.as_ptr().cast(),
+                lfo2_freq: lfo2_freq.as_mut_ptr().cast(),
+                lfo2_depth: s(lfo2_depth),
+                lfo2_opts: lfo2_opts.as_mut_ptr().cast(),
+                env1_attack: e1_a.as_ptr().cast(),
+                env1_decay: e1_d.as_ptr().cast(),
+                env1_sustain: e1_sus.as_ptr().cast(),
+                env1_release: e1_r.as_ptr().cast(),
+                env2_attack: e(e2_a),
+                env2_decay: e(e2_d),
+                env2_sustain: s(e2_sus),
+                env2_release: e(e2_r),
+            }
+        }
+    }
+
+    #[test]
+    fn voice_u16_smoke() {
+        let note = [NoteFxP::lit("69"); BATCH];
+        let gate = [SampleFxP::ONE; BATCH];
+        let vel = [ScalarFxP::lit("0.8"); BATCH];
+        let zero = [ScalarFxP::ZERO; BATCH];
+        let dests = [0u16; MATRIX_SLOTS];
+        let depths = [0i16; MATRIX_SLOTS];
+        let mut out: *const i16 = std::ptr::null();
+        let mut batch_out = [SampleFxP::ZERO; BATCH];
+        let mut bufs = VoiceBufsU16::new();
+        let p = culsynth_voice_u16_new();
+        assert!(!p.is_null());
+        unsafe {
+            let params = bufs.params();
+            let n = culsynth_voice_u16_process(
+                p,
+                N,
+                note.as_ptr().cast(),
+                gate.as_ptr().cast(),
+                vel.as_ptr().cast(),
+                zero.as_ptr().cast(),
+                zero.as_ptr().cast(),
+                &params,
+                dests.as_ptr(),
+                depths.as_ptr(),
+                &mut out,
+                0,
+            );
+            assert!(n > 0 && n as u32 <= N);
+            assert!(!out.is_null());
+            let params = bufs.params();
+            assert_eq!(
+                culsynth_voice_u16_process_batch(
+                    p,
+                    BATCH as u32,
+                    note.as_ptr().cast(),
+                    gate.as_ptr().cast(),
+                    vel.as_ptr().cast(),
+                    zero.as_ptr().cast(),
+                    zero.as_ptr().cast(),
+                    &params,
+                    dests.as_ptr(),
+                    depths.as_ptr(),
+                    batch_out.as_mut_ptr().cast(),
+                ),
+                BATCH as i32
+            );
+            // The gate has been held through the attack for over a full
+            // buffer, so the voice must be audible by the end of the batch:
+            assert!(batch_out.iter().any(|x| *x != SampleFxP::ZERO));
+            culsynth_voice_u16_free(p);
+        }
+    }
+
+    /// Owned, non-aliased backing buffers for a [VoiceParamsF32] - the
+    /// same patch as [VoiceBufsU16]
+    struct VoiceBufsF32 {
+        scalars: [[f32; BATCH]; 27],
+        tunes: [[f32; BATCH]; 2],
+        cutoff: [f32; BATCH],
+        env_times: [[f32; BATCH]; 12],
+        lfo_freqs: [[f32; BATCH]; 2],
+        lfo_opts: [[LfoOptions; BATCH]; 2],
+    }
+
+    impl VoiceBufsF32 {
+        fn new() -> Self {
+            let mut scalars = [[0f32; BATCH]; 27];
+            for i in [5, 12, 18, 21, 22, 25, 26] {
+                scalars[i] = [1f32; BATCH];
+            }
+            Self {
+                scalars,
+                tunes: [[0f32; BATCH]; 2],
+                cutoff: [127f32; BATCH],
+                env_times: [[0.1f32; BATCH]; 12],
+                lfo_freqs: [[1f32; BATCH]; 2],
+                lfo_opts: [[LfoOptions::default(); BATCH]; 2],
+            }
+        }
+        fn params(&mut self) -> VoiceParamsF32 {
+            let [sync, o1_shape, o1_sin, o1_sq, o1_tri, o1_saw, o2_shape, o2_sin, o2_sq, o2_tri, o2_saw, ring_out, ring_a, ring_b, f_em, f_vm, f_kbd, f_res, f_low, f_band, f_high, fe_sus, ae_sus, lfo1_depth, lfo2_depth, e1_sus, e2_sus] =
+                &mut self.scalars;
+            let [tune1, tune2] = &mut self.tunes;
+            let [fe_a, fe_d, fe_r, ae_a, ae_d, ae_r, e1_a, e1_d, e1_r, e2_a, e2_d, e2_r] =
+                &mut self.env_times;
+            let [lfo1_freq, lfo2_freq] = &mut self.lfo_freqs;
+            let [lfo1_opts, lfo2_opts] = &mut self.lfo_opts;
+            VoiceParamsF32 {
+                sync: sync.as_mut_ptr(),
+                osc1_tune: tune1.as_mut_ptr(),
+                osc1_shape: o1_shape.as_mut_ptr(),
+                osc1_sin: o1_sin.as_mut_ptr(),
+                osc1_sq: o1_sq.as_mut_ptr(),
+                osc1_tri: o1_tri.as_mut_ptr(),
+                osc1_saw: o1_saw.as_mut_ptr(),
+                osc2_tune: tune2.as_mut_ptr(),
+                osc2_shape: o2_shape.as_mut_ptr(),
+                osc2_sin: o2_sin.as_mut_ptr(),
+                osc2_sq: o2_sq.as_mut_ptr(),
+                osc2_tri: o2_tri.as_mut_ptr(),
+                osc2_saw: o2_saw.as_mut_ptr(),
+                ring_mix_out: ring_out.as_mut_ptr(),
+                ring_mix_a: ring_a.as_mut_ptr(),
+                ring_mix_b: ring_b.as_mut_ptr(),
+                filt_env_mod: f_em.as_mut_ptr(),
+                filt_vel_mod: f_vm.as_mut_ptr(),
+                filt_kbd: f_kbd.as_mut_ptr(),
+                filt_cutoff: self.cutoff.as_mut_ptr(),
+                filt_resonance: f_res.as_mut_ptr(),
+                filt_low_mix: f_low.as_mut_ptr(),
+                filt_band_mix: f_band.as_mut_ptr(),
+                filt_high_mix: f_high.as_mut_ptr(),
+                env_filt_attack: fe_a.as_mut_ptr(),
+                env_filt_decay: fe_d.as_mut_ptr(),
+                env_filt_sustain: fe_sus.as_mut_ptr(),
+                env_filt_release: fe_r.as_mut_ptr(),
+                env_amp_attack: ae_a.as_mut_ptr(),
+                env_amp_decay: ae_d.as_mut_ptr(),
+                env_amp_sustain: ae_sus.as_mut_ptr(),
+                env_amp_release: ae_r.as_mut_ptr(),
+                lfo1_freq: lfo1_freq.as_ptr(),
+                lfo1_depth: lfo1_depth.as_ptr(),
+                lfo1_opts: lfo1_opts.as_ptr().cast(),
+                lfo2_freq: lfo2_freq.as_mut_ptr(),
+                lfo2_depth: lfo2_depth.as_mut_ptr(),
+                lfo2_opts: lfo2_opts.as_mut_ptr().cast(),
+                env1_attack: e1_a.as_ptr(),
+                env1_decay: e1_d.as_ptr(),
+                env1_sustain: e1_sus.as_ptr(),
+                env1_release: e1_r.as_ptr(),
+                env2_attack: e2_a.as_mut_ptr(),
+                env2_decay: e2_d.as_mut_ptr(),
+                env2_sustain: e2_sus.as_mut_ptr(),
+                env2_release: e2_r.as_mut_ptr(),
+            }
+        }
+    }
+
+    #[test]
+    fn voice_f32_smoke() {
+        let note = [69f32; BATCH];
+        let gate = [1f32; BATCH];
+        let vel = [0.8f32; BATCH];
+        let zero = [0f32; BATCH];
+        let dests = [0u16; MATRIX_SLOTS];
+        let depths = [0f32; MATRIX_SLOTS];
+        let mut out: *const f32 = std::ptr::null();
+        let mut batch_out = [0f32; BATCH];
+        let mut bufs = VoiceBufsF32::new();
+        let p = culsynth_voice_f32_new();
+        assert!(!p.is_null());
+        unsafe {
+            let params = bufs.params();
+            let n = culsynth_voice_f32_process(
+                p,
+                N,
+                note.as_ptr(),
+                gate.as_ptr(),
+                vel.as_ptr(),
+                zero.as_ptr(),
+                zero.as_ptr(),
+                &params,
+                dests.as_ptr(),
+                depths.as_ptr(),
+                &mut out,
+                0,
+            );
+            assert!(n > 0 && n as u32 <= N);
+            assert!(!out.is_null());
+            let params = bufs.params();
+            assert_eq!(
+                culsynth_voice_f32_process_batch(
+                    p,
+                    BATCH as u32,
+                    note.as_ptr(),
+                    gate.as_ptr(),
+                    vel.as_ptr(),
+                    zero.as_ptr(),
+                    zero.as_ptr(),
+                    &params,
+                    dests.as_ptr(),
+                    depths.as_ptr(),
+                    batch_out.as_mut_ptr(),
+                ),
+                BATCH as i32
+            );
+            assert!(batch_out.iter().any(|x| *x != 0f32));
+            culsynth_voice_f32_free(p);
+        }
+    }
+
+    #[test]
+    fn pool_allocates_and_resets() {
+        // A null pool yields null handles rather than crashing:
+        unsafe {
+            assert!(culsynth_pool_amp_u16_new(std::ptr::null_mut()).is_null());
+        }
+        let pool = culsynth_pool_new(2);
+        assert!(!pool.is_null());
+        unsafe {
+            // Every type allocates out of its own arena:
+            let amp = culsynth_pool_amp_u16_new(pool);
+            assert!(!amp.is_null());
+            assert!(!culsynth_pool_amp_f32_new(pool).is_null());
+            assert!(!culsynth_pool_env_u16_new(pool).is_null());
+            assert!(!culsynth_pool_env_f32_new(pool).is_null());
+            assert!(!culsynth_pool_filt_u16_new(pool).is_null());
+            assert!(!culsynth_pool_filt_f32_new(pool).is_null());
+            assert!(!culsynth_pool_osc_u16_new(pool).is_null());
+            assert!(!culsynth_pool_osc_f32_new(pool).is_null());
+            assert!(!culsynth_pool_voice_u16_new(pool).is_null());
+            assert!(!culsynth_pool_voice_f32_new(pool).is_null());
+            // Pool handles work with the normal process entry points:
+            let signal = [SampleFxP::ONE; N as usize];
+            let gain = [SampleFxP::ONE; N as usize];
+            let mut out: *const u16 = std::ptr::null();
+            let n = culsynth_amp_u16_process(
+                amp,
+                N,
+                signal.as_ptr().cast(),
+                gain.as_ptr().cast(),
+                &mut out,
+                0,
+            );
+            assert!(n > 0);
+            // Exhausting an arena yields null instead of reallocating:
+            assert!(!culsynth_pool_amp_u16_new(pool).is_null());
+            assert!(culsynth_pool_amp_u16_new(pool).is_null());
+            // ...until a reset recycles it:
+            culsynth_pool_reset(pool);
+            assert!(!culsynth_pool_amp_u16_new(pool).is_null());
+            culsynth_pool_free(pool);
+        }
+    }
+}
@@ -2,6 +2,9 @@ use crate::pluginparams::{
     EnvPluginParams, FiltPluginParams, CulSynthParams, LfoPluginParams, ModMatrixPluginParams,
     OscPluginParams, RingModPluginParams,
 };
+use crate::preset::{Preset, PresetBank};
+use crate::scope::ScopeReader;
+use crate::snapshot::{MatrixSender, MatrixSnapshot};
 use crate::voicealloc::{MonoSynth, MonoSynthFxP, PolySynth, PolySynthFxP, VoiceAllocator};
 use crate::{ContextReader, VoiceMode};
 use egui::widgets;
@@ -26,11 +29,28 @@ struct CulSynthEditor {
     params: Arc<CulSynthParams>,
     midi_channel: SyncSender<i8>,
     synth_channel: SyncSender<Box<dyn VoiceAllocator>>,
+    matrix_channel: MatrixSender,
+    /// The raw values of the matrix parameters as of the last published
+    /// snapshot, used to detect when a new one needs to be published
+    matrix_published: [[(i32, i32); 4]; ModSrc::numel()],
+    /// The reading half of the audio thread's scope/meter tap (see
+    /// [crate::scope])
+    scope: ScopeReader,
     context: ContextReader,
     kbd_panel: kbd::KbdPanel,
+    /// The currently loaded preset bank (see [crate::preset])
+    preset_bank: PresetBank,
+    /// The bank file path typed into the presets window
+    preset_path: String,
+    /// The name typed into the presets window for the next captured preset
+    preset_name: String,
+    /// The result of the last load/save/capture/apply, shown in the window
+    preset_status: String,
     show_mod_matrix: bool,
+    show_scope: bool,
     show_settings: bool,
     show_about: bool,
+    show_presets: bool,
 }
 
 impl CulSynthEditor {
@@ -38,17 +58,50 @@ impl CulSynthEditor {
         p: Arc<CulSynthParams>,
         midi_tx: SyncSender<i8>,
         synth_tx: SyncSender<Box<dyn VoiceAllocator>>,
+        matrix_tx: MatrixSender,
+        scope_rx: ScopeReader,
         ctx: ContextReader,
     ) -> Self {
+        let matrix_published = Self::matrix_values(&p.modmatrix);
         CulSynthEditor {
             params: p,
             midi_channel: midi_tx,
             synth_channel: synth_tx,
+            matrix_channel: matrix_tx,
+            matrix_published,
+            scope: scope_rx,
             context: ctx,
             kbd_panel: Default::default(),
+            preset_bank: PresetBank::default(),
+            preset_path: String::new(),
+            preset_name: String::new(),
+            preset_status: String::new(),
             show_mod_matrix: false,
+            show_scope: false,
             show_settings: false,
             show_about: false,
+            show_presets: false,
+        }
+    }
+    /// Collect the raw values of all the modulation matrix parameters
+    fn matrix_values(matrix: &ModMatrixPluginParams) -> [[(i32, i32); 4]; ModSrc::numel()] {
+        ModSrc::ELEM.map(|src| {
+            let row = matrix.row(src);
+            [0, 1, 2, 3].map(|i| {
+                let slot = row.slot(i);
+                (slot.0.value(), slot.1.value())
+            })
+        })
+    }
+    /// Publish a coherent snapshot of the modulation matrix to the audio
+    /// thread if any of the matrix parameters have changed since the last
+    /// publication (whether from this editor or from the host)
+    fn publish_matrix(&mut self) {
+        let values = Self::matrix_values(&self.params.modmatrix);
+        if values != self.matrix_published {
+            self.matrix_published = values;
+            self.matrix_channel
+                .send(MatrixSnapshot::from(&self.params.modmatrix));
         }
     }
     fn draw_status_bar(&mut self, egui_ctx: &egui::Context) {
@@ -66,6 +119,12 @@ impl CulSynthEditor {
                         if ui.button("Mod Matrix").clicked() {
                             self.show_mod_matrix = true;
                         }
+                        if ui.button("Presets").clicked() {
+                            self.show_presets = true;
+                        }
+                        if ui.button("Scope").clicked() {
+                            self.show_scope = true;
+                        }
                         if ui.button("About").clicked() {
                             self.show_about = true;
                         }
@@ -240,6 +299,105 @@ impl CulSynthEditor {
             }
         });
     }
+    /// Draw the preset manager: load/save a bank file, capture the current
+    /// parameter state as a new preset, and apply presets from the bank.
+    /// Applying goes through the [ParamSetter] (see [Preset::apply]), so the
+    /// host is notified and the audio thread is never touched directly.
+    #[allow(clippy::too_many_arguments)]
+    fn draw_presets(
+        bank: &mut PresetBank,
+        path: &mut String,
+        name: &mut String,
+        status: &mut String,
+        params: &CulSynthParams,
+        setter: &ParamSetter,
+        ui: &mut egui::Ui,
+    ) {
+        ui.horizontal(|ui| {
+            ui.label("Bank file:");
+            ui.text_edit_singleline(path);
+        });
+        ui.horizontal(|ui| {
+            if ui.button("Load").clicked() {
+                match PresetBank::load(std::path::Path::new(path.as_str())) {
+                    Ok(loaded) => {
+                        *status = format!("Loaded {} presets", loaded.len());
+                        *bank = loaded;
+                    }
+                    Err(e) => *status = format!("Load failed: {}", e),
+                }
+            }
+            if ui.button("Save").clicked() {
+                match std::fs::write(std::path::Path::new(path.as_str()), bank.to_bytes()) {
+                    Ok(()) => *status = format!("Saved {} presets", bank.len()),
+                    Err(e) => *status = format!("Save failed: {}", e),
+                }
+            }
+        });
+        ui.separator();
+        ui.horizontal(|ui| {
+            ui.label("Name:");
+            ui.text_edit_singleline(name);
+            if ui.button("Capture").clicked() {
+                bank.push(Preset::capture(params, name.as_str()));
+                *status = format!("Captured '{}'", name);
+            }
+        });
+        if !bank.is_empty() {
+            ui.separator();
+            // Stage the clicked preset out of the bank (it is `Copy`) so the
+            // bank is no longer borrowed when we apply it below.
+            let mut to_apply: Option<Preset> = None;
+            egui::ScrollArea::vertical().max_height(200f32).show(ui, |ui| {
+                for i in 0..bank.len() {
+                    if let Some(preset) = bank.get(i) {
+                        if ui.button(preset.name()).clicked() {
+                            to_apply = Some(*preset);
+                        }
+                    }
+                }
+            });
+            if let Some(preset) = to_apply {
+                preset.apply(params, setter);
+                *status = format!("Applied '{}'", preset.name());
+            }
+        }
+        if !status.is_empty() {
+            ui.separator();
+            ui.label(status.as_str());
+        }
+    }
+    fn draw_scope(scope: &mut ScopeReader, ui: &mut egui::Ui) {
+        fn db(x: f32) -> f32 {
+            20f32 * x.max(1e-5f32).log10()
+        }
+        ui.horizontal(|ui| {
+            ui.label(format!("Peak: {:>6.1} dB", db(scope.take_peak())));
+            ui.separator();
+            ui.label(format!("RMS: {:>6.1} dB", db(scope.rms())));
+        });
+        let samples = scope.frame();
+        let (response, painter) = ui.allocate_painter(
+            egui::vec2(ui.available_width().max(200f32), 150f32),
+            egui::Sense::hover(),
+        );
+        let rect = response.rect;
+        painter.rect_filled(rect, 0f32, egui::Color32::BLACK);
+        let points: Vec<egui::Pos2> = samples
+            .iter()
+            .enumerate()
+            .map(|(i, smp)| {
+                egui::pos2(
+                    rect.left() + rect.width() * (i as f32) / ((samples.len() - 1) as f32),
+                    rect.center().y - smp * (rect.height() / 2f32),
+                )
+            })
+            .collect();
+        painter.add(egui::Shape::line(
+            points,
+            egui::Stroke::new(1f32, egui::Color32::GREEN),
+        ));
+    }
     /// Draw the editor panel
     pub fn update(&mut self, egui_ctx: &egui::Context, setter: &ParamSetter) {
         self.draw_status_bar(egui_ctx);
@@ -256,6 +414,29 @@ impl CulSynthEditor {
             .show(egui_ctx, |ui| {
                 Self::draw_modmatrix(&self.params.modmatrix, ui, setter);
             });
+        self.publish_matrix();
+        egui::Window::new("Presets")
+            .open(&mut self.show_presets)
+            .show(egui_ctx, |ui| {
+                Self::draw_presets(
+                    &mut self.preset_bank,
+                    &mut self.preset_path,
+                    &mut self.preset_name,
+                    &mut self.preset_status,
+                    &self.params,
+                    setter,
+                    ui,
+                );
+            });
+        egui::Window::new("Scope")
+            .open(&mut self.show_scope)
+            .show(egui_ctx, |ui| {
+                Self::draw_scope(&mut self.scope, ui);
+            });
+        if self.show_scope {
+            // Keep redrawing at frame rate while the scope is visible
+            egui_ctx.request_repaint();
+        }
         egui::Window::new("Settings")
             .open(&mut self.show_settings)
             .show(egui_ctx, |ui| {
@@ -318,11 +499,13 @@ pub fn create(
     params: Arc<CulSynthParams>,
     midi_tx: SyncSender<i8>,
     synth_tx: SyncSender<Box<dyn VoiceAllocator>>,
+    matrix_tx: MatrixSender,
+    scope_rx: ScopeReader,
     context: ContextReader,
 ) -> Option<Box<dyn Editor>> {
     create_egui_editor(
         params.editor_state.clone(),
-        CulSynthEditor::new(params, midi_tx, synth_tx, context),
+        CulSynthEditor::new(params, midi_tx, synth_tx, matrix_tx, scope_rx, context),
         |ctx, editor| editor.initialize(ctx),
         |ctx, setter, editor| editor.update(ctx, setter),
     )
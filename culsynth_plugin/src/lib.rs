@@ -17,6 +17,17 @@ use parambuf::PluginParamBufFxP;
 pub mod pluginparams;
 use pluginparams::CulSynthParams;
 
+pub mod preset;
+
+#[cfg(feature = "profile")]
+mod profile;
+
+mod scope;
+use scope::{ScopeReader, ScopeTap};
+
+mod snapshot;
+use snapshot::{MatrixReceiver, MatrixSender, MatrixSnapshot};
+
 mod voicealloc;
 use voicealloc::{PolySynth, VoiceAllocator};
 
@@ -85,6 +96,63 @@ impl ContextReader {
     }
 }
 
+/// Fraction of the block deadline above which the governor sheds voices
+const GOVERNOR_HIGH_LOAD: f32 = 0.75;
+/// Fraction of the block deadline below which a block counts towards
+/// restoring polyphony
+const GOVERNOR_LOW_LOAD: f32 = 0.5;
+/// Number of consecutive low-load blocks required before the governor
+/// raises the voice cap again (a few seconds of audio at typical block
+/// sizes, so recovery doesn't oscillate)
+const GOVERNOR_RECOVERY_BLOCKS: u32 = 256;
+/// The voice cap when fully recovered - must be at least the polyphony of
+/// the largest voice allocator
+const GOVERNOR_MAX_VOICES: usize = 16;
+
+/// A CPU load governor: watches each block's measured render time against
+/// its deadline and reduces the effective voice cap when headroom runs out,
+/// so that dense passages degrade gracefully (losing their quietest release
+/// tails via [VoiceAllocator::set_max_polyphony]) instead of glitching the
+/// whole mix.  The cap is lowered multiplicatively as soon as a block runs
+/// hot and restored one voice at a time after a sustained quiet spell.
+struct LoadGovernor {
+    cap: usize,
+    low_blocks: u32,
+}
+
+impl Default for LoadGovernor {
+    fn default() -> Self {
+        Self {
+            cap: GOVERNOR_MAX_VOICES,
+            low_blocks: 0,
+        }
+    }
+}
+
+impl LoadGovernor {
+    /// Update the governor with one block's load (render time as a fraction
+    /// of the block deadline) and return the new voice cap
+    fn update(&mut self, load: f32) -> usize {
+        if load > GOVERNOR_HIGH_LOAD {
+            let new_cap = std::cmp::max(1, (self.cap * 3) / 4);
+            if new_cap != self.cap {
+                nih_log!("governor: load {:.2}, reducing voice cap to {}", load, new_cap);
+            }
+            self.cap = new_cap;
+            self.low_blocks = 0;
+        } else if load < GOVERNOR_LOW_LOAD && self.cap < GOVERNOR_MAX_VOICES {
+            self.low_blocks += 1;
+            if self.low_blocks >= GOVERNOR_RECOVERY_BLOCKS {
+                self.low_blocks = 0;
+                self.cap += 1;
+            }
+        } else {
+            self.low_blocks = 0;
+        }
+        self.cap
+    }
+}
+
 /// Contains all of the global state for the plugin
 pub struct CulSynthPlugin {
     params: Arc<CulSynthParams>,
@@ -106,6 +174,27 @@ pub struct CulSynthPlugin {
     /// "Note Off" at the absolute value of the integer
     midi_rx: Receiver<i8>,
 
+    /// Used by the GUI thread to publish coherent modulation matrix
+    /// snapshots to the audio thread (see [snapshot])
+    matrix_tx: MatrixSender,
+
+    /// Used by the audio thread to receive modulation matrix snapshots
+    /// from the GUI thread
+    matrix_rx: MatrixReceiver,
+
+    /// The audio thread's current copy of the modulation matrix.  Refreshed
+    /// from [CulSynthPlugin::matrix_rx], or rebuilt from the parameters when
+    /// they change while no editor is publishing; the processing loop reads
+    /// this cache instead of the individual parameter atomics.
+    matrix: MatrixSnapshot,
+
+    /// Used by the audio thread to feed the mixed output to the editor's
+    /// oscilloscope and level meters (see [scope])
+    scope_tap: ScopeTap,
+
+    /// The reading half of the scope tap, cloned into each editor instance
+    scope_reader: ScopeReader,
+
     /// Used by the GUI thread to replace the current synth engine
     synth_tx: SyncSender<Box<dyn VoiceAllocator>>,
 
@@ -116,6 +205,15 @@ pub struct CulSynthPlugin {
     /// The sound engine currently in use to process audio for the synth.
     voices: Option<Box<dyn VoiceAllocator>>,
 
+    /// Watches per-block render times and caps polyphony when the audio
+    /// thread runs close to its deadline (see [LoadGovernor])
+    governor: LoadGovernor,
+
+    /// Aggregates the per-stage voice timing data collected each block
+    /// (see [profile])
+    #[cfg(feature = "profile")]
+    profiler: profile::BlockProfiler,
+
     context: Arc<PluginContext>,
 }
 
@@ -144,14 +242,24 @@ impl Default for CulSynthPlugin {
     fn default() -> Self {
         let (midi_tx, midi_rx) = sync_channel::<i8>(32);
         let (synth_tx, synth_rx) = sync_channel::<Box<dyn VoiceAllocator>>(1);
+        let (matrix_tx, matrix_rx) = snapshot::channel();
+        let (scope_tap, scope_reader) = scope::channel();
         Self {
             params: Arc::new(CulSynthParams::default()),
             parambuf: Default::default(),
             midi_tx,
             midi_rx,
+            matrix_tx,
+            matrix_rx,
+            matrix: Default::default(),
+            scope_tap,
+            scope_reader,
             synth_tx,
             synth_rx,
             voices: None,
+            governor: Default::default(),
+            #[cfg(feature = "profile")]
+            profiler: Default::default(),
             context: Arc::new(Default::default()),
         }
     }
@@ -191,6 +299,8 @@ impl Plugin for CulSynthPlugin {
             self.params.clone(),
             self.midi_tx.clone(),
             self.synth_tx.clone(),
+            self.matrix_tx.clone(),
+            self.scope_reader.clone(),
             self.get_context_reader(),
         )
     }
@@ -229,6 +339,10 @@ impl Plugin for CulSynthPlugin {
         );
         self.context.bufsz.store(bufsz as usize, Relaxed);
         self.voices = Some(voice_alloc);
+        // Seed the cached modulation matrix from the (possibly just
+        // restored) parameter state - this runs on a non-realtime thread
+        self.matrix = MatrixSnapshot::from(&self.params.modmatrix);
+        self.params.modmatrix.take_dirty();
         true
     }
 
@@ -262,10 +376,11 @@ impl Plugin for CulSynthPlugin {
             }
         }
         assert!(buffer.samples() <= self.context.bufsz.load(Relaxed));
+        // Materialize the (smoothed) parameters for the whole block up
+        // front; this is independent of the MIDI events below.
+        self.parambuf.update_block(0, buffer.samples(), &self.params);
         let mut next_event = context.next_event();
         for (sample_id, _channel_samples) in buffer.iter_samples().enumerate() {
-            self.parambuf.update_index(index, &self.params);
-
             // Process MIDI events:
             while let Some(event) = next_event {
                 if event.timing() > sample_id as u32 {
@@ -300,7 +415,19 @@ impl Plugin for CulSynthPlugin {
             voices.sample_tick();
             index += 1;
         }
-        let output = voices.process(&self.params.modmatrix, &mut self.parambuf);
+        // Refresh the cached modulation matrix at the block boundary.  The
+        // dirty flag covers parameter changes made while no editor is
+        // publishing (host automation, state loads); any snapshot published
+        // by the editor is coherent and takes precedence.
+        if self.params.modmatrix.take_dirty() {
+            self.matrix = MatrixSnapshot::from(&self.params.modmatrix);
+        }
+        if let Some(matrix) = self.matrix_rx.try_recv() {
+            self.matrix = matrix;
+        }
+        let render_start = std::time::Instant::now();
+        let output = voices.process(&self.matrix, &mut self.parambuf);
+        let render_time = render_start.elapsed();
         index = 0;
         for channel_samples in buffer.iter_samples() {
             for smp in channel_samples {
@@ -311,8 +438,15 @@ impl Plugin for CulSynthPlugin {
         // To save resources, a plugin can (and probably should!) only perform expensive
         // calculations that are only displayed on the GUI while the GUI is open
         if self.params.editor_state.is_open() {
-            //Do editor update logic
+            self.scope_tap.record(output);
         }
+        // Compare this block's measured render time against its real-time
+        // deadline and let the governor adjust the voice cap for the next
+        // block
+        let deadline = buffer.samples() as f32 / voices.get_context().sample_rate() as f32;
+        voices.set_max_polyphony(self.governor.update(render_time.as_secs_f32() / deadline));
+        #[cfg(feature = "profile")]
+        self.profiler.record(voices.take_profile());
         ProcessStatus::KeepAlive
     }
 }
@@ -4,6 +4,22 @@ use crate::pluginparams::{
 };
 use culsynth::devices::*;
 use culsynth::{EnvParamFxP, LfoFreqFxP, NoteFxP, ScalarFxP, SignedNoteFxP};
+use nih_plug::prelude::Smoother;
+
+/// Fill `buf` from a smoothed parameter.  Samples are generated one at a
+/// time only while the smoother is actually ramping; the (typical)
+/// steady-state remainder of the buffer becomes a single fill of the final
+/// value rather than a per-sample smoother read per element.
+fn fill_smoothed<T: Copy>(buf: &mut [T], smoother: &Smoother<i32>, f: impl Fn(i32) -> T) {
+    let mut i = 0;
+    while i < buf.len() && smoother.is_smoothing() {
+        buf[i] = f(smoother.next());
+        i += 1;
+    }
+    if i < buf.len() {
+        buf[i..].fill(f(smoother.next()));
+    }
+}
 
 #[derive(Default, Clone)]
 pub struct EnvParamBufFxP {
@@ -104,11 +120,19 @@ impl EnvParamBufFxP {
             release: &mut self.release[base..end],
         }
     }
-    pub fn update_index(&mut self, idx: usize, p: &EnvPluginParams) {
-        self.attack[idx] = EnvParamFxP::from_bits(p.a.smoothed.next() as u16);
-        self.decay[idx] = EnvParamFxP::from_bits(p.d.smoothed.next() as u16);
-        self.sustain[idx] = ScalarFxP::from_bits(p.s.smoothed.next() as u16);
-        self.release[idx] = EnvParamFxP::from_bits(p.r.smoothed.next() as u16);
+    pub fn update_block(&mut self, base: usize, end: usize, p: &EnvPluginParams) {
+        fill_smoothed(&mut self.attack[base..end], &p.a.smoothed, |x| {
+            EnvParamFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.decay[base..end], &p.d.smoothed, |x| {
+            EnvParamFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.sustain[base..end], &p.s.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.release[base..end], &p.r.smoothed, |x| {
+            EnvParamFxP::from_bits(x as u16)
+        });
     }
     pub fn into_float(&self, buf: &mut EnvParamBuf, len: usize) {
         let len = std::cmp::min(len, self.len());
@@ -177,10 +201,16 @@ impl RingModParamBufFxP {
             mix_out: &mut self.mix_mod[base..end],
         }
     }
-    pub fn update_index(&mut self, idx: usize, p: &RingModPluginParams) {
-        self.mix_a[idx] = ScalarFxP::from_bits(p.mix_a.smoothed.next() as u16);
-        self.mix_b[idx] = ScalarFxP::from_bits(p.mix_b.smoothed.next() as u16);
-        self.mix_mod[idx] = ScalarFxP::from_bits(p.mix_mod.smoothed.next() as u16);
+    pub fn update_block(&mut self, base: usize, end: usize, p: &RingModPluginParams) {
+        fill_smoothed(&mut self.mix_a[base..end], &p.mix_a.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.mix_b[base..end], &p.mix_b.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.mix_mod[base..end], &p.mix_mod.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
     }
     pub fn copy_to(&self, buf: &mut Self, len: usize) {
         let len = std::cmp::min(len, self.len());
@@ -244,6 +274,8 @@ impl RingModParamBuf {
 #[derive(Default, Clone)]
 pub struct GlobalParamBufFxP {
     sync: Vec<ScalarFxP>,
+    unison_detune: Vec<ScalarFxP>,
+    unison_voices: usize,
 }
 
 impl GlobalParamBufFxP {
@@ -260,7 +292,7 @@ impl GlobalParamBufFxP {
         if self.len() >= sz as usize {
             return;
         }
-        for buf in [&mut self.sync] {
+        for buf in [&mut self.sync, &mut self.unison_detune] {
             buf.resize(sz as usize, ScalarFxP::ZERO);
         }
     }
@@ -268,29 +300,54 @@ impl GlobalParamBufFxP {
         let len = std::cmp::min(len, self.len());
         for i in 0..std::cmp::min(len, buf.len()) {
             buf.sync[i] = self.sync[i].to_bits().into();
-        }
-    }
-    pub fn sync_mut(&mut self, base: usize, end: usize) -> &mut [ScalarFxP] {
-        &mut self.sync[base..end]
-    }
-    pub fn update_index(&mut self, idx: usize, osc_sync: &nih_plug::params::BoolParam) {
-        self.sync[idx] = if osc_sync.value() {
+            buf.unison_detune[i] = self.unison_detune[i].to_num();
+        }
+        buf.unison_voices = self.unison_voices;
+    }
+    pub fn unison_voices(&self) -> usize {
+        self.unison_voices
+    }
+    /// Split borrows of the mutable sync buffer and the read-only unison
+    /// detune buffer, so both can be packed into a single
+    /// [culsynth::voice::VoiceParamsFxP]
+    pub fn sync_detune_mut(&mut self, base: usize, end: usize) -> (&mut [ScalarFxP], &[ScalarFxP]) {
+        (&mut self.sync[base..end], &self.unison_detune[base..end])
+    }
+    pub fn update_block(
+        &mut self,
+        base: usize,
+        end: usize,
+        osc_sync: &nih_plug::params::BoolParam,
+        unison_voices: &nih_plug::params::IntParam,
+        unison_detune: &nih_plug::params::IntParam,
+    ) {
+        self.sync[base..end].fill(if osc_sync.value() {
             ScalarFxP::DELTA
         } else {
             ScalarFxP::ZERO
-        };
+        });
+        self.unison_voices = unison_voices.value() as usize;
+        fill_smoothed(
+            &mut self.unison_detune[base..end],
+            &unison_detune.smoothed,
+            |x| ScalarFxP::from_bits(x as u16),
+        );
     }
     pub fn copy_to(&self, buf: &mut Self, len: usize) {
         let len = std::cmp::min(len, self.len());
         for idx in 0..std::cmp::min(len, buf.len()) {
             buf.sync[idx] = self.sync[idx];
+            buf.unison_detune[idx] = self.unison_detune[idx];
         }
+        buf.unison_voices = self.unison_voices;
     }
 }
 
 #[derive(Default, Clone)]
 pub struct GlobalParamBuf {
     sync: Vec<f32>,
+    unison_detune: Vec<f32>,
+    unison_voices: usize,
 }
 
 impl GlobalParamBuf {
@@ -307,18 +364,26 @@ impl GlobalParamBuf {
         if self.len() >= sz as usize {
             return;
         }
-        for buf in [&mut self.sync] {
+        for buf in [&mut self.sync, &mut self.unison_detune] {
             buf.resize(sz as usize, 0f32);
         }
     }
-    pub fn sync_mut(&mut self, base: usize, end: usize) -> &mut [f32] {
-        &mut self.sync[base..end]
+    pub fn unison_voices(&self) -> usize {
+        self.unison_voices
+    }
+    /// Split borrows of the mutable sync buffer and the read-only unison
+    /// detune buffer, so both can be packed into a single
+    /// [culsynth::voice::VoiceParams]
+    pub fn sync_detune_mut(&mut self, base: usize, end: usize) -> (&mut [f32], &[f32]) {
+        (&mut self.sync[base..end], &self.unison_detune[base..end])
     }
     pub fn copy_to(&self, buf: &mut Self, len: usize) {
         let len = std::cmp::min(len, self.len());
         for idx in 0..std::cmp::min(len, buf.len()) {
             buf.sync[idx] = self.sync[idx];
+            buf.unison_detune[idx] = self.unison_detune[idx];
         }
+        buf.unison_voices = self.unison_voices;
     }
 }
 
@@ -386,15 +451,39 @@ impl OscParamBufFxP {
             saw: &mut self.saw[base..end],
         }
     }
-    pub fn update_index(&mut self, idx: usize, p: &OscPluginParams) {
-        self.shape[idx] = ScalarFxP::from_bits(p.shape.smoothed.next() as u16);
-        self.sin[idx] = ScalarFxP::from_bits(p.sin.smoothed.next() as u16);
-        self.sq[idx] = ScalarFxP::from_bits(p.sq.smoothed.next() as u16);
-        self.tri[idx] = ScalarFxP::from_bits(p.tri.smoothed.next() as u16);
-        self.saw[idx] = ScalarFxP::from_bits(p.saw.smoothed.next() as u16);
-        self.tune[idx] = SignedNoteFxP::from_bits(
-            ((p.course.smoothed.next() << 9) + p.fine.smoothed.next()) as i16,
-        )
+    pub fn update_block(&mut self, base: usize, end: usize, p: &OscPluginParams) {
+        fill_smoothed(&mut self.shape[base..end], &p.shape.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.sin[base..end], &p.sin.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.sq[base..end], &p.sq.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.tri[base..end], &p.tri.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.saw[base..end], &p.saw.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        // The course and fine tuning share one buffer, so keep generating
+        // per-sample values while either smoother is still ramping:
+        let tune = &mut self.tune[base..end];
+        let mut i = 0;
+        while i < tune.len()
+            && (p.course.smoothed.is_smoothing() || p.fine.smoothed.is_smoothing())
+        {
+            tune[i] = SignedNoteFxP::from_bits(
+                ((p.course.smoothed.next() << 9) + p.fine.smoothed.next()) as i16,
+            );
+            i += 1;
+        }
+        if i < tune.len() {
+            tune[i..].fill(SignedNoteFxP::from_bits(
+                ((p.course.smoothed.next() << 9) + p.fine.smoothed.next()) as i16,
+            ));
+        }
     }
     pub fn copy_to(&self, buf: &mut Self, len: usize) {
         let len = std::cmp::min(len, self.len());
@@ -522,10 +611,14 @@ impl LfoParamBufFxP {
             opts: &mut self.opts[base..end],
         }
     }
-    pub fn update_index(&mut self, idx: usize, p: &LfoPluginParams) {
-        self.freq[idx] = LfoFreqFxP::from_bits(p.rate.smoothed.next() as u16);
-        self.depth[idx] = ScalarFxP::from_bits(p.depth.smoothed.next() as u16);
-        self.opts[idx] = LfoOptions::from(p);
+    pub fn update_block(&mut self, base: usize, end: usize, p: &LfoPluginParams) {
+        fill_smoothed(&mut self.freq[base..end], &p.rate.smoothed, |x| {
+            LfoFreqFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.depth[base..end], &p.depth.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        self.opts[base..end].fill(LfoOptions::from(p));
     }
     pub fn copy_to(&self, buf: &mut Self, len: usize) {
         let len = std::cmp::min(len, self.len());
@@ -596,6 +689,7 @@ pub struct FiltParamBufFxP {
     low_mix: Vec<ScalarFxP>,
     band_mix: Vec<ScalarFxP>,
     high_mix: Vec<ScalarFxP>,
+    oversample: FiltOversample,
 }
 
 impl FiltParamBufFxP {
@@ -637,6 +731,7 @@ impl FiltParamBufFxP {
             buf.band_mix[i] = self.band_mix[i].to_num();
             buf.high_mix[i] = self.high_mix[i].to_num();
         }
+        buf.oversample = self.oversample;
     }
     pub fn params(&self, base: usize, end: usize) -> ModFiltParamsFxP {
         ModFiltParamsFxP {
@@ -648,6 +743,7 @@ impl FiltParamBufFxP {
             low_mix: &self.low_mix[base..end],
             band_mix: &self.band_mix[base..end],
             high_mix: &self.high_mix[base..end],
+            oversample: self.oversample,
         }
     }
     pub fn params_mut(&mut self, base: usize, end: usize) -> MutModFiltParamsFxP {
@@ -660,17 +756,39 @@ impl FiltParamBufFxP {
             low_mix: &mut self.low_mix[base..end],
             band_mix: &mut self.band_mix[base..end],
             high_mix: &mut self.high_mix[base..end],
-        }
-    }
-    pub fn update_index(&mut self, idx: usize, p: &FiltPluginParams) {
-        self.env_mod[idx] = ScalarFxP::from_bits(p.env.smoothed.next() as u16);
-        self.vel_mod[idx] = ScalarFxP::from_bits(p.vel.smoothed.next() as u16);
-        self.kbd[idx] = ScalarFxP::from_bits(p.kbd.smoothed.next() as u16);
-        self.cutoff[idx] = NoteFxP::from_bits(p.cutoff.smoothed.next() as u16);
-        self.resonance[idx] = ScalarFxP::from_bits(p.res.smoothed.next() as u16);
-        self.low_mix[idx] = ScalarFxP::from_bits(p.low.smoothed.next() as u16);
-        self.band_mix[idx] = ScalarFxP::from_bits(p.band.smoothed.next() as u16);
-        self.high_mix[idx] = ScalarFxP::from_bits(p.high.smoothed.next() as u16);
+            oversample: self.oversample,
+        }
+    }
+    pub fn update_block(&mut self, base: usize, end: usize, p: &FiltPluginParams) {
+        fill_smoothed(&mut self.env_mod[base..end], &p.env.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.vel_mod[base..end], &p.vel.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.kbd[base..end], &p.kbd.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.cutoff[base..end], &p.cutoff.smoothed, |x| {
+            NoteFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.resonance[base..end], &p.res.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.low_mix[base..end], &p.low.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.band_mix[base..end], &p.band.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        fill_smoothed(&mut self.high_mix[base..end], &p.high.smoothed, |x| {
+            ScalarFxP::from_bits(x as u16)
+        });
+        self.oversample = if p.oversample.value() {
+            FiltOversample::TwoX
+        } else {
+            FiltOversample::Off
+        };
     }
     pub fn copy_to(&self, buf: &mut Self, len: usize) {
         let len = std::cmp::min(len, self.len());
@@ -684,6 +802,7 @@ impl FiltParamBufFxP {
             buf.band_mix[idx] = self.band_mix[idx];
             buf.high_mix[idx] = self.high_mix[idx];
         }
+        buf.oversample = self.oversample;
     }
 }
 
@@ -697,6 +816,7 @@ pub struct FiltParamBuf {
     low_mix: Vec<f32>,
     band_mix: Vec<f32>,
     high_mix: Vec<f32>,
+    oversample: FiltOversample,
 }
 
 impl FiltParamBuf {
@@ -736,6 +856,7 @@ impl FiltParamBuf {
             low_mix: &self.low_mix[base..end],
             band_mix: &self.band_mix[base..end],
             high_mix: &self.high_mix[base..end],
+            oversample: self.oversample,
         }
     }
     pub fn params_mut(&mut self, base: usize, end: usize) -> MutModFiltParams<f32> {
@@ -748,6 +869,7 @@ impl FiltParamBuf {
             low_mix: &mut self.low_mix[base..end],
             band_mix: &mut self.band_mix[base..end],
             high_mix: &mut self.high_mix[base..end],
+            oversample: self.oversample,
         }
     }
     pub fn copy_to(&self, buf: &mut Self, len: usize) {
@@ -762,6 +884,7 @@ impl FiltParamBuf {
             buf.band_mix[idx] = self.band_mix[idx];
             buf.high_mix[idx] = self.high_mix[idx];
         }
+        buf.oversample = self.oversample;
     }
 }
 
@@ -794,18 +917,19 @@ impl PluginParamBufFxP {
         self.env1.allocate(sz);
         self.env2.allocate(sz);
     }
-    pub fn update_index(&mut self, index: usize, p: &CulSynthParams) {
-        self.global.update_index(index, &p.osc_sync);
-        self.osc1.update_index(index, &p.osc1);
-        self.osc2.update_index(index, &p.osc2);
-        self.ringmod.update_index(index, &p.ringmod);
-        self.filt.update_index(index, &p.filt);
-        self.env_amp.update_index(index, &p.env_vca);
-        self.env_filt.update_index(index, &p.env_vcf);
-        self.env1.update_index(index, &p.env1);
-        self.env2.update_index(index, &p.env2);
-        self.lfo1.update_index(index, &p.lfo1);
-        self.lfo2.update_index(index, &p.lfo2);
+    pub fn update_block(&mut self, base: usize, end: usize, p: &CulSynthParams) {
+        self.global
+            .update_block(base, end, &p.osc_sync, &p.unison_voices, &p.unison_detune);
+        self.osc1.update_block(base, end, &p.osc1);
+        self.osc2.update_block(base, end, &p.osc2);
+        self.ringmod.update_block(base, end, &p.ringmod);
+        self.filt.update_block(base, end, &p.filt);
+        self.env_amp.update_block(base, end, &p.env_vca);
+        self.env_filt.update_block(base, end, &p.env_vcf);
+        self.env1.update_block(base, end, &p.env1);
+        self.env2.update_block(base, end, &p.env2);
+        self.lfo1.update_block(base, end, &p.lfo1);
+        self.lfo2.update_block(base, end, &p.lfo2);
     }
     pub fn into_float(&self, buf: &mut PluginParamBuf, len: usize) {
         self.global.into_float(&mut buf.global, len);
@@ -4,6 +4,7 @@ use culsynth::{EnvParamFxP, IScalarFxP, LfoFreqFxP, NoteFxP, ScalarFxP};
 use nih_plug::prelude::*;
 use nih_plug_egui::EguiState;
 
+use std::sync::atomic::{AtomicBool, Ordering};
 use std::sync::Arc;
 
 use crate::fixedparam::{new_fixed_param, new_fixed_param_freq, new_fixed_param_percent};
@@ -153,6 +154,9 @@ pub struct FiltPluginParams {
 
     #[id = "hi"]
     pub high: IntParam,
+
+    #[id = "fos"]
+    pub oversample: BoolParam,
 }
 
 impl Default for FiltPluginParams {
@@ -166,6 +170,7 @@ impl Default for FiltPluginParams {
             low: new_fixed_param_percent("Filter Low Pass", ScalarFxP::MAX),
             band: new_fixed_param_percent("Filter Band Pass", ScalarFxP::ZERO),
             high: new_fixed_param_percent("Filter High Pass", ScalarFxP::ZERO),
+            oversample: BoolParam::new("Filter Oversampling", false),
         }
     }
 }
@@ -223,9 +228,16 @@ pub struct ModMatrixRowParams {
 }
 
 impl ModMatrixRowParams {
-    fn make_param(name: String, rng: IntRange) -> IntParam {
+    /// Build a callback marking the matrix dirty, for attaching to each of
+    /// the matrix parameters (see [ModMatrixPluginParams::take_dirty])
+    fn make_callback(dirty: &Arc<AtomicBool>) -> Arc<dyn Fn(i32) + Send + Sync> {
+        let dirty = dirty.clone();
+        Arc::new(move |_| dirty.store(true, Ordering::Release))
+    }
+    fn make_param(name: String, rng: IntRange, dirty: &Arc<AtomicBool>) -> IntParam {
         IntParam::new(name, ModDest::Null as i32, rng)
             .non_automatable()
+            .with_callback(Self::make_callback(dirty))
             .with_value_to_string(Arc::new(|x| {
                 ModDest::try_from(x as u16)
                     .unwrap_or_default()
@@ -236,7 +248,7 @@ impl ModMatrixRowParams {
                 ModDest::try_from(string).map(|x| x as i32).ok()
             }))
     }
-    fn new(name: &str, is_secondary: bool) -> Self {
+    fn new(name: &str, is_secondary: bool, dirty: &Arc<AtomicBool>) -> Self {
         let rng = if is_secondary {
             IntRange::Linear {
                 min: ModDest::min() as i32,
@@ -249,14 +261,18 @@ impl ModMatrixRowParams {
             }
         };
         Self {
-            a: Self::make_param(name.to_owned() + " A", rng),
-            a_magnitude: new_fixed_param(name.to_owned() + " A Mag", IScalarFxP::ZERO),
-            b: Self::make_param(name.to_owned() + " B", rng),
-            b_magnitude: new_fixed_param(name.to_owned() + " B Mag", IScalarFxP::ZERO),
-            c: Self::make_param(name.to_owned() + " C", rng),
-            c_magnitude: new_fixed_param(name.to_owned() + " C Mag", IScalarFxP::ZERO),
-            d: Self::make_param(name.to_owned() + " D", rng),
-            d_magnitude: new_fixed_param(name.to_owned() + " D Mag", IScalarFxP::ZERO),
+            a: Self::make_param(name.to_owned() + " A", rng, dirty),
+            a_magnitude: new_fixed_param(name.to_owned() + " A Mag", IScalarFxP::ZERO)
+                .with_callback(Self::make_callback(dirty)),
+            b: Self::make_param(name.to_owned() + " B", rng, dirty),
+            b_magnitude: new_fixed_param(name.to_owned() + " B Mag", IScalarFxP::ZERO)
+                .with_callback(Self::make_callback(dirty)),
+            c: Self::make_param(name.to_owned() + " C", rng, dirty),
+            c_magnitude: new_fixed_param(name.to_owned() + " C Mag", IScalarFxP::ZERO)
+                .with_callback(Self::make_callback(dirty)),
+            d: Self::make_param(name.to_owned() + " D", rng, dirty),
+            d_magnitude: new_fixed_param(name.to_owned() + " D Mag", IScalarFxP::ZERO)
+                .with_callback(Self::make_callback(dirty)),
             is_secondary,
         }
     }
@@ -316,6 +332,8 @@ pub struct ModMatrixPluginParams {
     pub lfo1: ModMatrixRowParams,
     #[nested(id_prefix = "M_L2_", group = "L2Mod")]
     pub lfo2: ModMatrixRowParams,
+
+    dirty: Arc<AtomicBool>,
 }
 
 impl Default for ModMatrixPluginParams {
@@ -326,16 +344,26 @@ impl Default for ModMatrixPluginParams {
 
 impl ModMatrixPluginParams {
     pub fn new() -> Self {
+        let dirty = Arc::new(AtomicBool::new(false));
         Self {
-            velocity: ModMatrixRowParams::new("MM Velocity", false),
-            aftertouch: ModMatrixRowParams::new("MM Aftertouch", false),
-            modwheel: ModMatrixRowParams::new("MM Modwheel", false),
-            env1: ModMatrixRowParams::new("MM Env 1", false),
-            env2: ModMatrixRowParams::new("MM Env 2", true),
-            lfo1: ModMatrixRowParams::new("MM LFO 1", false),
-            lfo2: ModMatrixRowParams::new("MM LFO 2", true),
+            velocity: ModMatrixRowParams::new("MM Velocity", false, &dirty),
+            aftertouch: ModMatrixRowParams::new("MM Aftertouch", false, &dirty),
+            modwheel: ModMatrixRowParams::new("MM Modwheel", false, &dirty),
+            env1: ModMatrixRowParams::new("MM Env 1", false, &dirty),
+            env2: ModMatrixRowParams::new("MM Env 2", true, &dirty),
+            lfo1: ModMatrixRowParams::new("MM LFO 1", false, &dirty),
+            lfo2: ModMatrixRowParams::new("MM LFO 2", true, &dirty),
+            dirty,
         }
     }
+    /// Clear and return the dirty flag.  The flag is set from a parameter
+    /// callback whenever any matrix parameter changes value - from the GUI,
+    /// the host, or a state load - so the audio thread can rebuild its
+    /// cached matrix only when it has actually changed instead of reloading
+    /// every parameter every block.
+    pub fn take_dirty(&self) -> bool {
+        self.dirty.swap(false, Ordering::Acquire)
+    }
     pub fn row(&self, src: ModSrc) -> &ModMatrixRowParams {
         match src {
             ModSrc::Velocity => &self.velocity,
@@ -392,6 +420,12 @@ pub struct CulSynthParams {
     #[id = "osync"]
     pub osc_sync: BoolParam,
 
+    #[id = "uvoice"]
+    pub unison_voices: IntParam,
+
+    #[id = "udetune"]
+    pub unison_detune: IntParam,
+
     #[nested(id_prefix = "o1", group = "osc1")]
     pub osc1: OscPluginParams,
 
@@ -431,6 +465,15 @@ impl Default for CulSynthParams {
         Self {
             editor_state: crate::editor::default_state(),
             osc_sync: BoolParam::new("Oscillator Sync", false),
+            unison_voices: IntParam::new(
+                "Unison Voices",
+                1,
+                IntRange::Linear {
+                    min: 1,
+                    max: culsynth::devices::UNISON_MAX as i32,
+                },
+            ),
+            unison_detune: new_fixed_param("Unison Detune", ScalarFxP::ZERO),
             osc1: Default::default(),
             osc2: Default::default(),
             ringmod: Default::default(),
@@ -0,0 +1,454 @@
+//! A compact binary preset format for the full parameter set and modulation
+//! matrix.
+//!
+//! The JSON state path provided by `nih-plug` is fine for host session
+//! save/restore, but parsing it per preset is far too slow to load a large
+//! factory bank at session open or to switch presets mid-performance.  This
+//! format instead has a fixed layout with a versioned header: every value is
+//! stored as its native 16-bit representation (the raw bits of [ScalarFxP],
+//! [EnvParamFxP](culsynth::EnvParamFxP), etc. - the same integers the
+//! parameters already hold), little-endian, so a whole bank loads with one
+//! buffered read and no per-value parsing.  An in-memory [Preset] is `Copy`,
+//! so staging the next preset is a single `memcpy` and switching allocates
+//! nothing; applying it goes through the normal parameter smoothers, which
+//! is what keeps the switch free of clicks.
+
+use nih_plug::prelude::*;
+
+use crate::pluginparams::CulSynthParams;
+use culsynth::voice::modulation::ModSrc;
+
+/// Magic bytes identifying a preset bank file
+pub const BANK_MAGIC: [u8; 4] = *b"CSPR";
+/// The current format version.  Bump this whenever the parameter layout
+/// (i.e. the order of [visit_params]) changes.
+pub const FORMAT_VERSION: u16 = 1;
+/// The fixed length of a preset name, in bytes (zero-padded UTF-8)
+pub const PRESET_NAME_LEN: usize = 32;
+/// The number of 16-bit words in the serialized parameter set - see
+/// [visit_params] for the breakdown
+pub const PRESET_WORDS: usize = 111;
+/// The serialized size of one preset, in bytes
+pub const PRESET_SIZE: usize = PRESET_NAME_LEN + 2 * PRESET_WORDS;
+/// The size of the bank file header, in bytes
+pub const HEADER_SIZE: usize = 16;
+
+/// A reference to a single plugin parameter, tagged with how its 16-bit
+/// preset word maps back to the parameter's `i32` plain value
+enum ParamRef<'a> {
+    /// An [IntParam] holding an unsigned 16-bit value (the raw bits of an
+    /// unsigned fixed-point parameter); the word is zero-extended on apply
+    Uint(&'a IntParam),
+    /// An [IntParam] holding a signed 16-bit value (a plain integer or the
+    /// raw bits of a signed fixed-point parameter); the word is
+    /// sign-extended on apply
+    Int(&'a IntParam),
+    /// A [BoolParam], stored as a whole word holding 0 or 1
+    Bool(&'a BoolParam),
+}
+
+/// Enumerate every parameter in canonical preset order.  This single
+/// function defines the serialized layout: capture, apply, and the
+/// [PRESET_WORDS] count must all agree with it, so any change here is a
+/// format change and must bump [FORMAT_VERSION].
+///
+/// The order is: the three top-level parameters (3 words), oscillators 1 and
+/// 2 (7 each), ring mod (3), filter (9), VCA/VCF envelopes (4 each), LFOs 1
+/// and 2 (5 each), mod envelopes 1 and 2 (4 each), then the mod matrix (7
+/// rows of 4 destination/magnitude slots, 56 words) - 111 words total.
+fn visit_params<'a>(params: &'a CulSynthParams, f: &mut impl FnMut(ParamRef<'a>)) {
+    f(ParamRef::Bool(&params.osc_sync));
+    f(ParamRef::Uint(&params.unison_voices));
+    f(ParamRef::Uint(&params.unison_detune));
+    for osc in [&params.osc1, &params.osc2] {
+        f(ParamRef::Int(&osc.course));
+        f(ParamRef::Int(&osc.fine));
+        f(ParamRef::Uint(&osc.shape));
+        f(ParamRef::Uint(&osc.sin));
+        f(ParamRef::Uint(&osc.sq));
+        f(ParamRef::Uint(&osc.tri));
+        f(ParamRef::Uint(&osc.saw));
+    }
+    f(ParamRef::Uint(&params.ringmod.mix_a));
+    f(ParamRef::Uint(&params.ringmod.mix_b));
+    f(ParamRef::Uint(&params.ringmod.mix_mod));
+    f(ParamRef::Uint(&params.filt.kbd));
+    f(ParamRef::Uint(&params.filt.vel));
+    f(ParamRef::Uint(&params.filt.env));
+    f(ParamRef::Uint(&params.filt.cutoff));
+    f(ParamRef::Uint(&params.filt.res));
+    f(ParamRef::Uint(&params.filt.low));
+    f(ParamRef::Uint(&params.filt.band));
+    f(ParamRef::Uint(&params.filt.high));
+    f(ParamRef::Bool(&params.filt.oversample));
+    for env in [&params.env_vca, &params.env_vcf] {
+        f(ParamRef::Uint(&env.a));
+        f(ParamRef::Uint(&env.d));
+        f(ParamRef::Uint(&env.s));
+        f(ParamRef::Uint(&env.r));
+    }
+    for lfo in [&params.lfo1, &params.lfo2] {
+        f(ParamRef::Uint(&lfo.rate));
+        f(ParamRef::Uint(&lfo.depth));
+        f(ParamRef::Uint(&lfo.wave));
+        f(ParamRef::Bool(&lfo.retrigger));
+        f(ParamRef::Bool(&lfo.bipolar));
+    }
+    for env in [&params.env1, &params.env2] {
+        f(ParamRef::Uint(&env.a));
+        f(ParamRef::Uint(&env.d));
+        f(ParamRef::Uint(&env.s));
+        f(ParamRef::Uint(&env.r));
+    }
+    for src in ModSrc::ELEM {
+        let row = params.modmatrix.row(src);
+        for (dest, mag) in row.iter() {
+            f(ParamRef::Uint(dest));
+            f(ParamRef::Int(mag));
+        }
+    }
+}
+
+/// A single preset: a fixed-length name plus every parameter value as a
+/// 16-bit word in [visit_params] order.  This is `Copy` with no indirection,
+/// so staging one out of a bank is a plain `memcpy` and switching presets
+/// never allocates.
+#[derive(Clone, Copy)]
+pub struct Preset {
+    name: [u8; PRESET_NAME_LEN],
+    words: [u16; PRESET_WORDS],
+}
+
+impl Default for Preset {
+    fn default() -> Self {
+        Self {
+            name: [0u8; PRESET_NAME_LEN],
+            words: [0u16; PRESET_WORDS],
+        }
+    }
+}
+
+impl Preset {
+    /// Capture the current value of every parameter into a new preset.
+    /// Names longer than [PRESET_NAME_LEN] bytes are truncated.
+    pub fn capture(params: &CulSynthParams, name: &str) -> Self {
+        let mut preset = Self::default();
+        let name_bytes = name.as_bytes();
+        let n = std::cmp::min(name_bytes.len(), PRESET_NAME_LEN);
+        preset.name[..n].copy_from_slice(&name_bytes[..n]);
+        let mut i = 0;
+        visit_params(params, &mut |p| {
+            preset.words[i] = match p {
+                ParamRef::Uint(p) => p.value() as u16,
+                ParamRef::Int(p) => p.value() as u16,
+                ParamRef::Bool(p) => p.value() as u16,
+            };
+            i += 1;
+        });
+        debug_assert_eq!(i, PRESET_WORDS);
+        preset
+    }
+    /// Apply this preset to the plugin parameters.  Values are set through
+    /// the supplied [ParamSetter] so the host is notified and the normal
+    /// parameter smoothers ramp to the new values, avoiding an audible
+    /// discontinuity on switch.  Performs no allocation.
+    pub fn apply(&self, params: &CulSynthParams, setter: &ParamSetter) {
+        let mut i = 0;
+        visit_params(params, &mut |p| {
+            let word = self.words[i];
+            i += 1;
+            match p {
+                ParamRef::Uint(p) => {
+                    setter.begin_set_parameter(p);
+                    setter.set_parameter(p, word as i32);
+                    setter.end_set_parameter(p);
+                }
+                ParamRef::Int(p) => {
+                    setter.begin_set_parameter(p);
+                    setter.set_parameter(p, word as i16 as i32);
+                    setter.end_set_parameter(p);
+                }
+                ParamRef::Bool(p) => {
+                    setter.begin_set_parameter(p);
+                    setter.set_parameter(p, word != 0);
+                    setter.end_set_parameter(p);
+                }
+            }
+        });
+    }
+    /// The preset name, or an empty string if the stored bytes are not
+    /// valid UTF-8
+    pub fn name(&self) -> &str {
+        let len = self
+            .name
+            .iter()
+            .position(|b| *b == 0)
+            .unwrap_or(PRESET_NAME_LEN);
+        std::str::from_utf8(&self.name[..len]).unwrap_or("")
+    }
+    /// Serialize this preset into `out`, which must hold at least
+    /// [PRESET_SIZE] bytes
+    fn write_to(&self, out: &mut [u8]) {
+        out[..PRESET_NAME_LEN].copy_from_slice(&self.name);
+        for (i, word) in self.words.iter().enumerate() {
+            let off = PRESET_NAME_LEN + 2 * i;
+            out[off..off + 2].copy_from_slice(&word.to_le_bytes());
+        }
+    }
+    /// Deserialize a preset from `data`, which must hold at least
+    /// [PRESET_SIZE] bytes
+    fn read_from(data: &[u8]) -> Self {
+        let mut preset = Self::default();
+        preset.name.copy_from_slice(&data[..PRESET_NAME_LEN]);
+        for (i, word) in preset.words.iter_mut().enumerate() {
+            let off = PRESET_NAME_LEN + 2 * i;
+            *word = u16::from_le_bytes([data[off], data[off + 1]]);
+        }
+        preset
+    }
+}
+
+/// The reasons a preset bank can fail to load
+#[derive(Debug)]
+pub enum PresetError {
+    /// The file did not start with [BANK_MAGIC]
+    BadMagic,
+    /// The file's format version is not [FORMAT_VERSION]
+    UnsupportedVersion(u16),
+    /// The header's layout fields did not match [PRESET_WORDS] and
+    /// [PRESET_NAME_LEN] - written by an incompatible build
+    BadLayout,
+    /// The file ended before the declared number of presets
+    Truncated,
+    /// The underlying file could not be read
+    Io(std::io::Error),
+}
+
+impl From<std::io::Error> for PresetError {
+    fn from(e: std::io::Error) -> Self {
+        Self::Io(e)
+    }
+}
+
+impl std::fmt::Display for PresetError {
+    fn fmt(&self, f: &mut std::fmt::Formatter<'_>) -> std::fmt::Result {
+        match self {
+            Self::BadMagic => write!(f, "not a preset bank file"),
+            Self::UnsupportedVersion(v) => write!(f, "unsupported preset format version {}", v),
+            Self::BadLayout => write!(f, "preset layout mismatch"),
+            Self::Truncated => write!(f, "preset bank file is truncated"),
+            Self::Io(e) => write!(f, "{}", e),
+        }
+    }
+}
+
+/// A bank of presets, loaded in one pass and held contiguously so switching
+/// between them is a `memcpy` away.
+///
+/// File layout: a [HEADER_SIZE]-byte header - [BANK_MAGIC], format version
+/// (u16), words per preset (u16), name length (u16), a reserved word, and
+/// the preset count (u32), all little-endian - followed by `count` presets
+/// of [PRESET_SIZE] bytes each.  The layout fields let a loader reject banks
+/// written by an incompatible build instead of misinterpreting them.
+#[derive(Default)]
+pub struct PresetBank {
+    presets: Vec<Preset>,
+}
+
+impl PresetBank {
+    /// Load a bank from a file with a single buffered read
+    pub fn load(path: &std::path::Path) -> Result<Self, PresetError> {
+        Self::from_bytes(&std::fs::read(path)?)
+    }
+    /// Parse a bank from its serialized form
+    pub fn from_bytes(data: &[u8]) -> Result<Self, PresetError> {
+        if data.len() < HEADER_SIZE {
+            return Err(PresetError::Truncated);
+        }
+        if data[0..4] != BANK_MAGIC {
+            return Err(PresetError::BadMagic);
+        }
+        let version = u16::from_le_bytes([data[4], data[5]]);
+        if version != FORMAT_VERSION {
+            return Err(PresetError::UnsupportedVersion(version));
+        }
+        let words = u16::from_le_bytes([data[6], data[7]]) as usize;
+        let name_len = u16::from_le_bytes([data[8], data[9]]) as usize;
+        if words != PRESET_WORDS || name_len != PRESET_NAME_LEN {
+            return Err(PresetError::BadLayout);
+        }
+        let count = u32::from_le_bytes([data[12], data[13], data[14], data[15]]) as usize;
+        if data.len() < HEADER_SIZE + count * PRESET_SIZE {
+            return Err(PresetError::Truncated);
+        }
+        let mut presets = Vec::with_capacity(count);
+        for i in 0..count {
+            let off = HEADER_SIZE + i * PRESET_SIZE;
+            presets.push(Preset::read_from(&data[off..off + PRESET_SIZE]));
+        }
+        Ok(Self { presets })
+    }
+    /// Serialize the bank for writing to a file
+    pub fn to_bytes(&self) -> Vec<u8> {
+        let mut out = vec![0u8; HEADER_SIZE + self.presets.len() * PRESET_SIZE];
+        out[0..4].copy_from_slice(&BANK_MAGIC);
+        out[4..6].copy_from_slice(&FORMAT_VERSION.to_le_bytes());
+        out[6..8].copy_from_slice(&(PRESET_WORDS as u16).to_le_bytes());
+        out[8..10].copy_from_slice(&(PRESET_NAME_LEN as u16).to_le_bytes());
+        out[12..16].copy_from_slice(&(self.presets.len() as u32).to_le_bytes());
+        for (i, preset) in self.presets.iter().enumerate() {
+            let off = HEADER_SIZE + i * PRESET_SIZE;
+            preset.write_to(&mut out[off..off + PRESET_SIZE]);
+        }
+        out
+    }
+    /// The number of presets in the bank
+    pub fn len(&self) -> usize {
+        self.presets.len()
+    }
+    /// This is empty if `self.len() == 0`
+    pub fn is_empty(&self) -> bool {
+        self.presets.is_empty()
+    }
+    /// Get a preset by index.  Copying the returned preset into a staging
+    /// slot (it is `Copy`) and calling [Preset::apply] switches presets
+    /// without allocating.
+    pub fn get(&self, idx: usize) -> Option<&Preset> {
+        self.presets.get(idx)
+    }
+    /// Append a preset to the bank
+    pub fn push(&mut self, preset: Preset) {
+        self.presets.push(preset);
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::sync::Mutex;
+
+    /// A [GuiContext] that records the normalized value of every parameter
+    /// set through it, in call order, so a test can observe exactly what
+    /// [Preset::apply] would hand to a real host.
+    #[derive(Default)]
+    struct RecordingContext {
+        values: Mutex<Vec<f32>>,
+    }
+
+    impl GuiContext for RecordingContext {
+        fn plugin_api(&self) -> PluginApi {
+            PluginApi::Clap
+        }
+        fn request_resize(&self) -> bool {
+            true
+        }
+        unsafe fn raw_begin_set_parameter(&self, _param: ParamPtr) {}
+        unsafe fn raw_set_parameter_normalized(&self, _param: ParamPtr, normalized: f32) {
+            self.values.lock().unwrap().push(normalized);
+        }
+        unsafe fn raw_end_set_parameter(&self, _param: ParamPtr) {}
+        fn get_state(&self) -> PluginState {
+            unimplemented!()
+        }
+        fn set_state(&self, _state: PluginState) {
+            unimplemented!()
+        }
+    }
+
+    fn valid_bank_bytes() -> Vec<u8> {
+        let params = CulSynthParams::default();
+        let mut bank = PresetBank::default();
+        bank.push(Preset::capture(&params, "Init"));
+        bank.to_bytes()
+    }
+
+    /// Capture the parameter state, serialize it, parse it back, and apply
+    /// it: every word must survive the round trip and the applied normalized
+    /// values must exactly match the captured parameter values.
+    #[test]
+    fn preset_roundtrip() {
+        let params = CulSynthParams::default();
+        let captured = Preset::capture(&params, "Init");
+        let mut bank = PresetBank::default();
+        bank.push(captured);
+        let loaded = PresetBank::from_bytes(&bank.to_bytes()).expect("bank should parse");
+        assert_eq!(loaded.len(), 1);
+        let preset = loaded.get(0).unwrap();
+        assert_eq!(preset.name(), "Init");
+        assert_eq!(preset.words, captured.words);
+        let ctx = RecordingContext::default();
+        preset.apply(&params, &ParamSetter::new(&ctx));
+        let values = ctx.values.lock().unwrap();
+        assert_eq!(values.len(), PRESET_WORDS);
+        let mut i = 0;
+        visit_params(&params, &mut |p| {
+            let expected = match p {
+                ParamRef::Uint(p) => p.preview_normalized(p.value()),
+                ParamRef::Int(p) => p.preview_normalized(p.value()),
+                ParamRef::Bool(p) => p.preview_normalized(p.value()),
+            };
+            assert_eq!(values[i], expected, "parameter {} mismatch", i);
+            i += 1;
+        });
+        assert_eq!(i, PRESET_WORDS);
+    }
+
+    /// The word 0x8000 must decode as 32768 for unsigned parameters but
+    /// -32768 for signed ones (see [ParamRef]).
+    #[test]
+    fn apply_sign_extends_int_words() {
+        let params = CulSynthParams::default();
+        let preset = Preset {
+            name: [0u8; PRESET_NAME_LEN],
+            words: [0x8000u16; PRESET_WORDS],
+        };
+        let ctx = RecordingContext::default();
+        preset.apply(&params, &ParamSetter::new(&ctx));
+        let values = ctx.values.lock().unwrap();
+        let mut i = 0;
+        visit_params(&params, &mut |p| {
+            let expected = match p {
+                ParamRef::Uint(p) => p.preview_normalized(0x8000),
+                ParamRef::Int(p) => p.preview_normalized(-0x8000),
+                ParamRef::Bool(p) => p.preview_normalized(true),
+            };
+            assert_eq!(values[i], expected, "parameter {} mismatch", i);
+            i += 1;
+        });
+    }
+
+    #[test]
+    fn rejects_bad_magic() {
+        let mut bytes = valid_bank_bytes();
+        bytes[0..4].copy_from_slice(b"JUNK");
+        assert!(matches!(
+            PresetBank::from_bytes(&bytes),
+            Err(PresetError::BadMagic)
+        ));
+    }
+
+    #[test]
+    fn rejects_unsupported_version() {
+        let mut bytes = valid_bank_bytes();
+        bytes[4..6].copy_from_slice(&(FORMAT_VERSION + 1).to_le_bytes());
+        assert!(matches!(
+            PresetBank::from_bytes(&bytes),
+            Err(PresetError::UnsupportedVersion(v)) if v == FORMAT_VERSION + 1
+        ));
+    }
+
+    #[test]
+    fn rejects_truncated() {
+        let bytes = valid_bank_bytes();
+        // Shorter than the header:
+        assert!(matches!(
+            PresetBank::from_bytes(&bytes[..HEADER_SIZE - 1]),
+            Err(PresetError::Truncated)
+        ));
+        // Header intact, but the declared preset is cut short:
+        assert!(matches!(
+            PresetBank::from_bytes(&bytes[..bytes.len() - 1]),
+            Err(PresetError::Truncated)
+        ));
+    }
+}
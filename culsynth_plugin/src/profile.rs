@@ -0,0 +1,112 @@
+//! Plugin-side aggregation of the per-stage voice timing data collected by
+//! the `culsynth` crate when the `profile` feature is enabled (see
+//! [culsynth::profiling]).
+//!
+//! The audio thread feeds each block's merged [StageProfile] into a
+//! [BlockProfiler], which maintains log2-bucketed per-stage histograms and
+//! a record of the worst block seen.  A summary is logged periodically, and
+//! the worst-block breakdown is logged whenever it is beaten, so xruns can
+//! be correlated with the stage that caused them.
+
+use culsynth::profiling::{Stage, StageProfile};
+use nih_plug::nih_log;
+
+/// Number of log2 buckets in each per-stage histogram.  Bucket `i` counts
+/// blocks where the stage took less than 2^i ticks.
+const BUCKETS: usize = 48;
+
+/// Number of blocks between logged summaries (a few seconds of audio at
+/// typical block sizes)
+const SUMMARY_BLOCKS: u32 = 4096;
+
+pub struct BlockProfiler {
+    /// Per-stage histograms of per-block tick counts, log2-bucketed
+    hist: [[u32; BUCKETS]; Stage::NUM],
+    /// Per-stage totals over the current summary window
+    window: StageProfile,
+    /// The per-stage breakdown of the worst (highest total) block seen
+    worst: StageProfile,
+    /// Blocks recorded in the current summary window
+    blocks: u32,
+}
+
+impl Default for BlockProfiler {
+    fn default() -> Self {
+        Self {
+            hist: [[0u32; BUCKETS]; Stage::NUM],
+            window: Default::default(),
+            worst: Default::default(),
+            blocks: 0,
+        }
+    }
+}
+
+impl BlockProfiler {
+    /// Record the merged per-stage tick counts for one block
+    pub fn record(&mut self, block: StageProfile) {
+        for (hist, ticks) in self.hist.iter_mut().zip(block.ticks.iter()) {
+            let bucket = std::cmp::min(64 - ticks.leading_zeros() as usize, BUCKETS - 1);
+            hist[bucket] += 1;
+        }
+        self.window.merge(&block);
+        self.blocks += 1;
+        if block.total() > self.worst.total() {
+            self.worst = block;
+            nih_log!("profile: new worst block: {}", Self::breakdown(&self.worst));
+        }
+        if self.blocks >= SUMMARY_BLOCKS {
+            nih_log!(
+                "profile: {} blocks, mean ticks/block: {} | p99 ticks: {}",
+                self.blocks,
+                Self::breakdown(&Self::scaled(&self.window, self.blocks)),
+                self.p99_summary(),
+            );
+            self.window.reset();
+            self.blocks = 0;
+        }
+    }
+    /// Format a per-stage breakdown as `stage=ticks` pairs
+    fn breakdown(profile: &StageProfile) -> String {
+        let mut ret = String::new();
+        for stage in Stage::ELEM {
+            if !ret.is_empty() {
+                ret.push(' ');
+            }
+            ret.push_str(stage.to_str());
+            ret.push('=');
+            ret.push_str(&profile.ticks[stage as usize].to_string());
+        }
+        ret
+    }
+    /// Divide all of a profile's counts by `blocks` to get per-block means
+    fn scaled(profile: &StageProfile, blocks: u32) -> StageProfile {
+        let mut ret = *profile;
+        for t in ret.ticks.iter_mut() {
+            *t /= blocks as u64;
+        }
+        ret
+    }
+    /// Format the upper bound (as a power of two) of the 99th-percentile
+    /// histogram bucket for each stage
+    fn p99_summary(&self) -> String {
+        let mut ret = String::new();
+        for stage in Stage::ELEM {
+            let hist = &self.hist[stage as usize];
+            let total: u64 = hist.iter().map(|x| *x as u64).sum();
+            let mut seen = 0u64;
+            let mut bucket = 0usize;
+            for (i, count) in hist.iter().enumerate() {
+                seen += *count as u64;
+                if seen * 100 >= total * 99 {
+                    bucket = i;
+                    break;
+                }
+            }
+            if !ret.is_empty() {
+                ret.push(' ');
+            }
+            ret.push_str(&format!("{}<2^{}", stage.to_str(), bucket));
+        }
+        ret
+    }
+}
@@ -0,0 +1,166 @@
+//! A wait-free tap on the synth's mixed output feeding an oscilloscope and
+//! level meters in the editor.
+//!
+//! This is the mirror image of [crate::snapshot]: the same single-consumer
+//! "triple buffer" protocol, but with the audio thread as the writer and the
+//! GUI thread as the reader.  The audio thread copies each block's output
+//! into its back slot and publishes a frame with a single atomic exchange
+//! whenever the slot fills; it never allocates, locks, or waits.  The meters
+//! are a pair of relaxed atomic floats updated once per block.
+
+use std::cell::UnsafeCell;
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::{Arc, Mutex};
+
+use atomic_float::AtomicF32;
+
+/// The number of samples in each published scope frame - about 43ms of
+/// audio at 48kHz, spanning multiple cycles of any note above low A
+pub const SCOPE_FRAME_SIZE: usize = 2048;
+
+/// Smoothing coefficient for the running mean-square estimate used by the
+/// RMS meter, giving a window of roughly 21ms at 48kHz
+const RMS_ALPHA: f32 = 1f32 / 1024f32;
+
+/// One frame's worth of output samples for the oscilloscope display
+#[derive(Clone)]
+pub struct ScopeFrame {
+    /// The output samples, oldest first
+    pub samples: [f32; SCOPE_FRAME_SIZE],
+}
+
+impl Default for ScopeFrame {
+    fn default() -> Self {
+        Self {
+            samples: [0f32; SCOPE_FRAME_SIZE],
+        }
+    }
+}
+
+/// Mask to extract the slot index from [ScopeState::shared]
+const INDEX_MASK: usize = 0x3;
+/// Set in [ScopeState::shared] if the slot it indexes has been published
+/// but not yet consumed by the reader
+const FRESH_FLAG: usize = 0x4;
+
+struct ScopeState {
+    slots: [UnsafeCell<ScopeFrame>; 3],
+    /// Index of the slot currently "in transit" between the two threads
+    /// (see [INDEX_MASK] and [FRESH_FLAG]).  The tap and reader each own
+    /// one of the remaining slots and trade with this one by swapping.
+    shared: AtomicUsize,
+    /// Index of the slot owned by the reading side.  Guarded by a mutex so
+    /// that successive editor instances may share a cloned [ScopeReader];
+    /// the audio thread never touches it.
+    front: Mutex<usize>,
+    /// The largest absolute output sample seen since the reader last reset
+    /// it (see [ScopeReader::take_peak])
+    peak: AtomicF32,
+    /// The current RMS level of the output
+    rms: AtomicF32,
+}
+
+// SAFETY: the slot indexed by the tap's `back` is only accessed by the
+// single audio thread, the slot indexed by `front` is only accessed with
+// the mutex held, and slots only change sides through `shared` with
+// acquire/release ordering.
+unsafe impl Send for ScopeState {}
+unsafe impl Sync for ScopeState {}
+
+/// The writing half of a scope channel, owned by the audio thread.
+pub struct ScopeTap {
+    state: Arc<ScopeState>,
+    /// Index of the slot owned by the writing side
+    back: usize,
+    /// Number of samples accumulated so far in the back slot
+    fill: usize,
+    /// Running mean-square estimate feeding the RMS meter
+    mean_sq: f32,
+}
+
+/// The reading half of a scope channel, used by the GUI thread.  This is
+/// cloneable (like [crate::snapshot::MatrixSender]) so it can be handed to
+/// each editor instance the host creates.
+#[derive(Clone)]
+pub struct ScopeReader {
+    state: Arc<ScopeState>,
+    /// The most recently received frame, kept so the display holds steady
+    /// between publications
+    frame: ScopeFrame,
+}
+
+/// Create a connected [ScopeTap]/[ScopeReader] pair.
+pub fn channel() -> (ScopeTap, ScopeReader) {
+    let state = Arc::new(ScopeState {
+        slots: Default::default(),
+        shared: AtomicUsize::new(1),
+        front: Mutex::new(2),
+        peak: AtomicF32::new(0f32),
+        rms: AtomicF32::new(0f32),
+    });
+    (
+        ScopeTap {
+            state: state.clone(),
+            back: 0,
+            fill: 0,
+            mean_sq: 0f32,
+        },
+        ScopeReader {
+            state,
+            frame: Default::default(),
+        },
+    )
+}
+
+impl ScopeTap {
+    /// Record one block of output samples.  Wait-free: the samples are
+    /// copied into the tap's back slot, frames are published with a single
+    /// atomic exchange as the slot fills, and the meters are updated with
+    /// relaxed stores - nothing here can block the render callback.
+    pub fn record(&mut self, samples: &[f32]) {
+        let mut peak = 0f32;
+        for smp in samples {
+            peak = peak.max(smp.abs());
+            self.mean_sq += RMS_ALPHA * ((smp * smp) - self.mean_sq);
+            // SAFETY: this slot is owned by the writing side (only ever
+            // touched by the single audio thread) until the swap below
+            // hands it to the reader.
+            unsafe {
+                (*self.state.slots[self.back].get()).samples[self.fill] = *smp;
+            }
+            self.fill += 1;
+            if self.fill == SCOPE_FRAME_SIZE {
+                self.fill = 0;
+                self.back =
+                    self.state.shared.swap(self.back | FRESH_FLAG, Ordering::AcqRel) & INDEX_MASK;
+            }
+        }
+        self.state.peak.fetch_max(peak, Ordering::Relaxed);
+        self.state.rms.store(self.mean_sq.sqrt(), Ordering::Relaxed);
+    }
+}
+
+impl ScopeReader {
+    /// Get the most recent scope frame, picking up a newly published frame
+    /// if one is pending.  Call once per GUI frame.
+    pub fn frame(&mut self) -> &[f32] {
+        if self.state.shared.load(Ordering::Acquire) & FRESH_FLAG != 0 {
+            let mut front = self.state.front.lock().unwrap();
+            *front = self.state.shared.swap(*front, Ordering::AcqRel) & INDEX_MASK;
+            // SAFETY: the swap above transferred this slot to the reading
+            // side (serialized by the mutex we hold); the tap will not
+            // touch it until we trade it back.
+            self.frame = unsafe { (*self.state.slots[*front].get()).clone() };
+        }
+        &self.frame.samples
+    }
+    /// Get the peak output level since the last call, resetting it so the
+    /// GUI can apply its own ballistics.
+    pub fn take_peak(&self) -> f32 {
+        self.state.peak.swap(0f32, Ordering::Relaxed)
+    }
+    /// Get the current RMS output level.
+    pub fn rms(&self) -> f32 {
+        self.state.rms.load(Ordering::Relaxed)
+    }
+}
@@ -0,0 +1,125 @@
+//! A wait-free single-consumer "triple buffer" used to hand complete,
+//! coherent modulation matrix snapshots from the GUI thread to the audio
+//! thread.
+//!
+//! The matrix parameters are stored as individual atomics by `nih-plug`, so
+//! rebuilding the matrix on the audio thread every block both costs a load
+//! per parameter and can observe a half-updated matrix while the user is
+//! editing it.  Instead, the editor builds the full matrix off the audio
+//! thread and publishes it here; the audio thread picks it up at a block
+//! boundary with a single atomic exchange.
+
+use std::cell::UnsafeCell;
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::{Arc, Mutex};
+
+use culsynth::voice::modulation::{ModMatrix, ModMatrixFxP};
+
+use crate::pluginparams::ModMatrixPluginParams;
+
+/// A coherent copy of the modulation matrix, prebuilt in both arithmetic
+/// flavors so the audio thread never has to convert parameter values itself.
+#[derive(Default)]
+pub struct MatrixSnapshot {
+    /// The matrix for the fixed-point synth engines
+    pub fxp: ModMatrixFxP,
+    /// The matrix for the floating-point synth engines
+    pub float: ModMatrix<f32>,
+}
+
+impl From<&ModMatrixPluginParams> for MatrixSnapshot {
+    fn from(params: &ModMatrixPluginParams) -> Self {
+        Self {
+            fxp: params.build_matrix(),
+            float: params.build_matrix_float(),
+        }
+    }
+}
+
+/// Mask to extract the slot index from [SnapshotBuffer::shared]
+const INDEX_MASK: usize = 0x3;
+/// Set in [SnapshotBuffer::shared] if the slot it indexes has been published
+/// but not yet consumed by the receiver
+const FRESH_FLAG: usize = 0x4;
+
+struct SnapshotBuffer {
+    slots: [UnsafeCell<MatrixSnapshot>; 3],
+    /// Index of the slot currently "in transit" between the two threads
+    /// (see [INDEX_MASK] and [FRESH_FLAG]).  The sender and receiver each
+    /// own one of the remaining slots and trade with this one by swapping.
+    shared: AtomicUsize,
+    /// Index of the slot owned by the sending side.  Guarded by a mutex so
+    /// that successive editor instances may share a cloned [MatrixSender];
+    /// the audio thread never touches it.
+    back: Mutex<usize>,
+}
+
+// SAFETY: the slot indexed by `back` is only accessed with the mutex held,
+// the slot indexed by the receiver's `front` is only accessed by the single
+// receiver, and slots only change sides through `shared` with
+// acquire/release ordering.
+unsafe impl Send for SnapshotBuffer {}
+unsafe impl Sync for SnapshotBuffer {}
+
+/// The sending half of a snapshot channel, used by the GUI thread.  This is
+/// cloneable (like a [std::sync::mpsc::SyncSender]) so it can be handed to
+/// each editor instance the host creates.
+#[derive(Clone)]
+pub struct MatrixSender {
+    buffer: Arc<SnapshotBuffer>,
+}
+
+/// The receiving half of a snapshot channel, owned by the audio thread.
+pub struct MatrixReceiver {
+    buffer: Arc<SnapshotBuffer>,
+    /// Index of the slot owned by the receiving side
+    front: usize,
+}
+
+/// Create a connected [MatrixSender]/[MatrixReceiver] pair.
+pub fn channel() -> (MatrixSender, MatrixReceiver) {
+    let buffer = Arc::new(SnapshotBuffer {
+        slots: Default::default(),
+        shared: AtomicUsize::new(1),
+        back: Mutex::new(0),
+    });
+    (
+        MatrixSender {
+            buffer: buffer.clone(),
+        },
+        MatrixReceiver { buffer, front: 2 },
+    )
+}
+
+impl MatrixSender {
+    /// Publish a new snapshot, replacing any previously published snapshot
+    /// that the audio thread has not yet picked up.  May block briefly if
+    /// another GUI thread is mid-publish, but never blocks the audio thread.
+    pub fn send(&self, snapshot: MatrixSnapshot) {
+        let mut back = self.buffer.back.lock().unwrap();
+        // SAFETY: this slot is owned by the sending side (serialized by the
+        // mutex we hold) until the swap below hands it to the receiver.
+        unsafe {
+            *self.buffer.slots[*back].get() = snapshot;
+        }
+        *back = self.buffer.shared.swap(*back | FRESH_FLAG, Ordering::AcqRel) & INDEX_MASK;
+    }
+}
+
+impl MatrixReceiver {
+    /// Take the most recently published snapshot, or `None` if nothing has
+    /// been published since the last call.  This is wait-free (one atomic
+    /// load, plus one exchange if a snapshot is pending), so it is safe to
+    /// call from the audio thread at block boundaries.
+    pub fn try_recv(&mut self) -> Option<MatrixSnapshot> {
+        if self.buffer.shared.load(Ordering::Acquire) & FRESH_FLAG == 0 {
+            return None;
+        }
+        self.front = self.buffer.shared.swap(self.front, Ordering::AcqRel) & INDEX_MASK;
+        // SAFETY: the swap above transferred this slot to the receiving
+        // side; the sender will not touch it until we trade it back.
+        Some(std::mem::take(unsafe {
+            &mut *self.buffer.slots[self.front].get()
+        }))
+    }
+}
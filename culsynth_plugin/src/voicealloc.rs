@@ -3,8 +3,9 @@
 //! selected logic form (fixed, float32, float64), etc.
 
 use crate::parambuf::{PluginParamBuf, PluginParamBufFxP};
-use crate::pluginparams::ModMatrixPluginParams;
+use crate::snapshot::MatrixSnapshot;
 use culsynth::context::{Context, ContextFxP, GenericContext};
+use culsynth::devices::OscScratch;
 use culsynth::voice::{Voice, VoiceFxP, VoiceParams, VoiceParamsFxP};
 use culsynth::{IScalarFxP, NoteFxP, SampleFxP, ScalarFxP, SignedNoteFxP};
 
@@ -43,19 +44,28 @@ pub trait VoiceAllocator: Send {
     /// a whole step.
     fn set_pitch_bend_range(&mut self, low: i8, high: i8);
     /// Process all of the note on/off events within the buffer, taking the
-    /// parameter buffers as input and returning a reference to an internal
-    /// buffer holding the corresponding audio sample output
+    /// modulation matrix and parameter buffers as input and returning a
+    /// reference to an internal buffer holding the corresponding audio
+    /// sample output
     ///
     /// If `self.get_context().is_fixed_point()` then callers must call
     /// `conv_float()` on all parameter buffers before calling this function.
     ///
     /// After calling this function, the internal index will be reset back
     /// to the beginning of the buffer (see [VoiceAllocator::sample_tick]).
-    fn process(
-        &mut self,
-        matrix_p: &ModMatrixPluginParams,
-        glob_p: &mut PluginParamBufFxP,
-    ) -> &[f32];
+    fn process(&mut self, matrix: &MatrixSnapshot, glob_p: &mut PluginParamBufFxP) -> &[f32];
+    /// Limit the number of simultaneously sounding voices to at most `cap`,
+    /// shedding the quietest active voices (lowest amplifier envelope level)
+    /// first.  Called by the CPU load governor when blocks run close to
+    /// their deadline; allocators without polyphony ignore it.
+    fn set_max_polyphony(&mut self, cap: usize) {
+        let _ = cap;
+    }
+    /// Take and reset the per-stage timing profile accumulated since the
+    /// last call, merged across all of this allocator's voices (see
+    /// [culsynth::profiling])
+    #[cfg(feature = "profile")]
+    fn take_profile(&mut self) -> culsynth::profiling::StageProfile;
     /// Get the process context for this voice allocator.
     fn get_context(&self) -> &dyn GenericContext;
     /// Is this Voice Allocator polyphonic?
@@ -5,6 +5,7 @@ use rand::random;
 #[derive(Default, Clone)]
 pub struct MonoSynthFxP {
     voice: VoiceFxP,
+    scratch: OscScratch<SampleFxP>,
     outbuf: Vec<f32>,
     notebuf: Vec<NoteFxP>,
     gatebuf: Vec<SampleFxP>,
@@ -13,6 +14,7 @@ pub struct MonoSynthFxP {
     modwheelbuf: Vec<ScalarFxP>,
     ctx: ContextFxP,
     index: usize,
+    flushed: usize,
     note: NoteFxP,
     gate: SampleFxP,
     velocity: ScalarFxP,
@@ -30,6 +32,19 @@ impl MonoSynthFxP {
             ..Default::default()
         }
     }
+    /// Materialize the control values for the segment between the last event
+    /// boundary and the current index.  The control values are constant
+    /// between MIDI events, so a single fill per buffer per segment replaces
+    /// the per-sample writes.
+    fn flush(&mut self) {
+        let seg = self.flushed..self.index;
+        self.notebuf[seg.clone()].fill(self.note.add_signed(self.pitch_bend));
+        self.gatebuf[seg.clone()].fill(self.gate);
+        self.velbuf[seg.clone()].fill(self.velocity);
+        self.aftertouchbuf[seg.clone()].fill(self.aftertouch);
+        self.modwheelbuf[seg].fill(self.modwheel);
+        self.flushed = self.index;
+    }
 }
 
 impl VoiceAllocator for MonoSynthFxP {
@@ -41,36 +56,37 @@ impl VoiceAllocator for MonoSynthFxP {
         self.aftertouchbuf.resize(sz, ScalarFxP::ZERO);
         self.modwheelbuf.resize(sz, ScalarFxP::ZERO);
         self.index = 0;
+        self.flushed = 0;
         self.note = NoteFxP::lit("69"); //A440, nice
         self.gate = SampleFxP::ZERO;
         self.set_pitch_bend_range(2, 2);
     }
     fn sample_tick(&mut self) {
-        self.notebuf[self.index] = self.note.add_signed(self.pitch_bend);
-        self.gatebuf[self.index] = self.gate;
-        self.velbuf[self.index] = self.velocity;
-        self.aftertouchbuf[self.index] = self.aftertouch;
-        self.modwheelbuf[self.index] = self.modwheel;
         self.index += 1;
     }
     fn note_on(&mut self, note: u8, velocity: u8) {
+        self.flush();
         self.note = NoteFxP::from_num(note);
         self.gate = SampleFxP::ONE;
         self.velocity = ScalarFxP::from_bits((velocity as u16) << 9);
     }
     fn note_off(&mut self, note: u8, _velocity: u8) {
         if self.note == note {
+            self.flush();
             self.gate = SampleFxP::ZERO;
             //self.velocity = ScalarFxP::from_bits((velocity as u16) << 9);
         }
     }
     fn aftertouch(&mut self, value: u8) {
+        self.flush();
         self.aftertouch = ScalarFxP::from_bits((value as u16) << 9);
     }
     fn modwheel(&mut self, value: u8) {
+        self.flush();
         self.modwheel = ScalarFxP::from_bits((value as u16) << 9);
     }
     fn pitch_bend(&mut self, v: i16) {
+        self.flush();
         if v < 0 {
             self.pitch_bend =
                 SignedNoteFxP::from_num(IScalarFxP::from_bits(v).wide_mul(self.pitch_range.0));
@@ -91,17 +107,18 @@ impl VoiceAllocator for MonoSynthFxP {
             fixed::types::I16F0::from_num(high),
         );
     }
-    fn process(
-        &mut self,
-        matrix_p: &ModMatrixPluginParams,
-        params: &mut PluginParamBufFxP,
-    ) -> &[f32] {
+    fn process(&mut self, matrix: &MatrixSnapshot, params: &mut PluginParamBufFxP) -> &[f32] {
+        self.flush();
         let mut processed: usize = 0;
-        let matrix = matrix_p.build_matrix();
+        let matrix = &matrix.fxp;
         while processed < self.index {
+            let unison_voices = params.global.unison_voices();
+            let (sync, unison_detune) = params.global.sync_detune_mut(processed, self.index);
             let voiceparams = VoiceParamsFxP {
-                sync: params.global.sync_mut(processed, self.index),
+                sync,
                 osc1_p: params.osc1.params_mut(processed, self.index),
+                unison_voices,
+                unison_detune,
                 osc2_p: params.osc2.params_mut(processed, self.index),
                 ring_p: params.ringmod.params_mut(processed, self.index),
                 filt_p: params.filt.params_mut(processed, self.index),
@@ -114,13 +131,14 @@ impl VoiceAllocator for MonoSynthFxP {
             };
             let thisiter = self.voice.process(
                 &self.ctx,
-                &matrix,
+                matrix,
                 &self.notebuf[processed..self.index],
                 &self.gatebuf[processed..self.index],
                 &self.velbuf[processed..self.index],
                 &self.aftertouchbuf[processed..self.index],
                 &self.modwheelbuf[processed..self.index],
                 voiceparams,
+                &mut self.scratch,
             );
             for smp in thisiter {
                 self.outbuf[processed] = smp.unwrapped_shr(4).to_num::<f32>();
@@ -128,8 +146,13 @@ impl VoiceAllocator for MonoSynthFxP {
             }
         }
         self.index = 0;
+        self.flushed = 0;
         &self.outbuf[0..processed]
     }
+    #[cfg(feature = "profile")]
+    fn take_profile(&mut self) -> culsynth::profiling::StageProfile {
+        self.voice.take_profile()
+    }
     fn get_context(&self) -> &dyn GenericContext {
         &self.ctx
     }
@@ -142,6 +165,7 @@ impl VoiceAllocator for MonoSynthFxP {
 #[derive(Default, Clone)]
 pub struct MonoSynth {
     voice: Voice<f32>,
+    scratch: OscScratch<f32>,
     params: PluginParamBuf,
     outbuf: Vec<f32>,
     notebuf: Vec<f32>,
@@ -151,6 +175,7 @@ pub struct MonoSynth {
     modwheelbuf: Vec<f32>,
     ctx: Context<f32>,
     index: usize,
+    flushed: usize,
     note: f32,
     gate: f32,
     velocity: f32,
@@ -167,6 +192,17 @@ impl MonoSynth {
             ..Default::default()
         }
     }
+    /// Materialize the control values for the segment between the last event
+    /// boundary and the current index (see [MonoSynthFxP::flush]).
+    fn flush(&mut self) {
+        let seg = self.flushed..self.index;
+        self.notebuf[seg.clone()].fill(self.note + self.pitch_bend);
+        self.gatebuf[seg.clone()].fill(self.gate);
+        self.velbuf[seg.clone()].fill(self.velocity);
+        self.aftertouchbuf[seg.clone()].fill(self.aftertouch);
+        self.modwheelbuf[seg].fill(self.modwheel);
+        self.flushed = self.index;
+    }
 }
 
 impl VoiceAllocator for MonoSynth {
@@ -179,36 +215,37 @@ impl VoiceAllocator for MonoSynth {
         self.modwheelbuf.resize(sz, 0f32);
         self.params.allocate(sz as u32);
         self.index = 0;
+        self.flushed = 0;
         self.note = 69f32; //A440, nice
         self.gate = 0f32;
         self.set_pitch_bend_range(2, 2);
     }
     fn sample_tick(&mut self) {
-        self.notebuf[self.index] = self.note + self.pitch_bend;
-        self.gatebuf[self.index] = self.gate;
-        self.velbuf[self.index] = self.velocity;
-        self.aftertouchbuf[self.index] = self.aftertouch;
-        self.modwheelbuf[self.index] = self.modwheel;
         self.index += 1;
     }
     fn note_on(&mut self, note: u8, velocity: u8) {
+        self.flush();
         self.note = f32::from(note);
         self.gate = 1f32;
         self.velocity = f32::from(velocity) / 127f32;
     }
     fn note_off(&mut self, note: u8, _velocity: u8) {
         if self.note == f32::from(note) {
+            self.flush();
             self.gate = 0f32;
             //self.velocity = f32::from(velocity) / 127f32;
         }
     }
     fn aftertouch(&mut self, value: u8) {
+        self.flush();
         self.aftertouch = f32::from(value) / 127f32;
     }
     fn modwheel(&mut self, value: u8) {
+        self.flush();
         self.modwheel = f32::from(value) / 127f32;
     }
     fn pitch_bend(&mut self, value: i16) {
+        self.flush();
         let val_float = (value as f32) / (i16::MAX as f32);
         if val_float < 0f32 {
             self.pitch_bend = self.pitch_bend_range.0 * val_float;
@@ -222,18 +259,19 @@ impl VoiceAllocator for MonoSynth {
     fn set_pitch_bend_range(&mut self, low: i8, high: i8) {
         self.pitch_bend_range = (low as f32, high as f32);
     }
-    fn process(
-        &mut self,
-        matrix_p: &ModMatrixPluginParams,
-        params: &mut PluginParamBufFxP,
-    ) -> &[f32] {
+    fn process(&mut self, matrix: &MatrixSnapshot, params: &mut PluginParamBufFxP) -> &[f32] {
+        self.flush();
         params.into_float(&mut self.params, self.index);
         let mut processed: usize = 0;
-        let matrix = matrix_p.build_matrix_float();
+        let matrix = &matrix.float;
         while processed < self.index {
+            let unison_voices = self.params.global.unison_voices();
+            let (sync, unison_detune) = self.params.global.sync_detune_mut(processed, self.index);
             let voiceparams = VoiceParams {
-                sync: self.params.global.sync_mut(processed, self.index),
+                sync,
                 osc1_p: self.params.osc1.params_mut(processed, self.index),
+                unison_voices,
+                unison_detune,
                 osc2_p: self.params.osc2.params_mut(processed, self.index),
                 ring_p: self.params.ringmod.params_mut(processed, self.index),
                 filt_p: self.params.filt.params_mut(processed, self.index),
@@ -246,13 +284,14 @@ impl VoiceAllocator for MonoSynth {
             };
             let thisiter = self.voice.process(
                 &self.ctx,
-                &matrix,
+                matrix,
                 &self.notebuf[processed..self.index],
                 &self.gatebuf[processed..self.index],
                 &self.velbuf[processed..self.index],
                 &self.aftertouchbuf[processed..self.index],
                 &self.modwheelbuf[processed..self.index],
                 voiceparams,
+                &mut self.scratch,
             );
             for smp in thisiter {
                 self.outbuf[processed] = *smp / 16f32;
@@ -260,8 +299,13 @@ impl VoiceAllocator for MonoSynth {
             }
         }
         self.index = 0;
+        self.flushed = 0;
         &self.outbuf[0..processed]
     }
+    #[cfg(feature = "profile")]
+    fn take_profile(&mut self) -> culsynth::profiling::StageProfile {
+        self.voice.take_profile()
+    }
     fn get_context(&self) -> &dyn GenericContext {
         &self.ctx
     }
@@ -1,9 +1,23 @@
+use std::cell::UnsafeCell;
 use std::collections::VecDeque;
+use std::sync::atomic::{AtomicU8, Ordering};
+use std::sync::Arc;
 
 use super::*;
+use culsynth::voice::modulation::ModMatrix;
 use nih_plug::nih_error;
 use rand::random;
 
+/// The maximum number of worker threads to use when rendering voices in
+/// parallel.  The final mix is a linear pass over this many buffers on the
+/// audio thread, so keep it small.
+const MAX_RENDER_WORKERS: usize = 4;
+
+/// Don't bother fanning out to worker threads unless each worker would have
+/// at least this many voices to render - for small voice counts the
+/// synchronization overhead outweighs the parallelism.
+const MIN_VOICES_PER_WORKER: usize = 4;
+
 struct PolySynthVoice {
     voice: Voice<f32>,
     notebuf: Vec<f32>,
@@ -42,13 +56,273 @@ impl Default for PolySynthVoice {
     }
 }
 
+/// Per-thread state for parallel voice rendering.  Each worker gets its own
+/// copy of the parameter buffers (voices mutate them via modulation) and its
+/// own accumulation buffer, so no state is shared between workers during a
+/// block.  Everything is allocated up front in `initialize`.
+struct PolySynthWorker {
+    params: PluginParamBuf,
+    outbuf: Vec<f32>,
+    scratch: OscScratch<f32>,
+}
+
+impl PolySynthWorker {
+    fn new() -> Self {
+        Self {
+            params: PluginParamBuf::default(),
+            outbuf: Vec::default(),
+            scratch: OscScratch::new(),
+        }
+    }
+    fn initialize(&mut self, sz: usize) {
+        self.params.allocate(sz as u32);
+        self.outbuf.resize(sz, 0f32);
+    }
+}
+
+/// No job pending - the audio thread owns the worker's [WorkerSlot].
+const WORKER_IDLE: u8 = 0;
+/// A job has been handed off - the worker thread owns its [WorkerSlot].
+const WORKER_PENDING: u8 = 1;
+/// The worker thread should exit (set when the pool is torn down).
+const WORKER_EXIT: u8 = 2;
+
+/// One block's worth of work for a persistent render worker.  The pointers
+/// alias buffers owned by [PolySynth] on the audio thread; they are only
+/// valid from [RenderWorker::dispatch] until the matching
+/// [RenderWorker::wait] returns, which `process` guarantees happens within
+/// the same block.
+#[derive(Clone, Copy)]
+struct RenderJob {
+    ctx: *const Context<f32>,
+    matrix: *const ModMatrix<f32>,
+    voices: *mut PolySynthVoice,
+    num_voices: usize,
+    params_src: *const PluginParamBuf,
+    aftertouch: *const f32,
+    modwheel: *const f32,
+    numsamples: usize,
+}
+
+impl RenderJob {
+    const fn empty() -> Self {
+        Self {
+            ctx: core::ptr::null(),
+            matrix: core::ptr::null(),
+            voices: core::ptr::null_mut(),
+            num_voices: 0,
+            params_src: core::ptr::null(),
+            aftertouch: core::ptr::null(),
+            modwheel: core::ptr::null(),
+            numsamples: 0,
+        }
+    }
+}
+
+/// The state shared between the audio thread and one worker thread.
+struct WorkerSlot {
+    /// One of [WORKER_IDLE]/[WORKER_PENDING]/[WORKER_EXIT].  The
+    /// IDLE->PENDING and PENDING->IDLE transitions pass ownership of `state`
+    /// between the audio thread and the worker; the Release stores and
+    /// Acquire loads on this flag provide the required happens-before edges.
+    job_state: AtomicU8,
+    state: UnsafeCell<WorkerState>,
+}
+
+struct WorkerState {
+    job: RenderJob,
+    worker: PolySynthWorker,
+}
+
+// SAFETY: access to `state` is serialized by `job_state` - the audio thread
+// only touches it while the slot is IDLE and the worker thread only while it
+// is PENDING (see [WorkerSlot::job_state]).
+unsafe impl Sync for WorkerSlot {}
+unsafe impl Send for WorkerSlot {}
+
+/// A persistent worker thread for the parallel render path.  Workers are
+/// spawned once in [VoiceAllocator::initialize] and park between blocks, so
+/// the audio thread never creates threads or allocates: `process` writes a
+/// [RenderJob] into the slot, unparks the worker, and spins on the slot flag
+/// once its own partition is done.
+struct RenderWorker {
+    slot: Arc<WorkerSlot>,
+    thread: Option<std::thread::JoinHandle<()>>,
+}
+
+impl RenderWorker {
+    fn spawn(bufsz: usize) -> Self {
+        let mut worker = PolySynthWorker::new();
+        worker.initialize(bufsz);
+        let slot = Arc::new(WorkerSlot {
+            job_state: AtomicU8::new(WORKER_IDLE),
+            state: UnsafeCell::new(WorkerState {
+                job: RenderJob::empty(),
+                worker,
+            }),
+        });
+        let worker_slot = slot.clone();
+        let thread = std::thread::spawn(move || render_worker_main(worker_slot));
+        Self {
+            slot,
+            thread: Some(thread),
+        }
+    }
+    /// Hand a block of work to the worker.  The slot must be idle, i.e.
+    /// every `dispatch` must be paired with a `wait` before the next one.
+    fn dispatch(&self, job: RenderJob) {
+        // SAFETY: the slot is IDLE, so this thread owns the cell.
+        unsafe {
+            (*self.slot.state.get()).job = job;
+        }
+        self.slot.job_state.store(WORKER_PENDING, Ordering::Release);
+        if let Some(thread) = self.thread.as_ref() {
+            thread.thread().unpark();
+        }
+    }
+    /// Wait for the worker to finish its job and return its accumulation
+    /// buffer.  This spins rather than blocking: the audio thread only gets
+    /// here after rendering its own partition, so the residual wait is at
+    /// most a fraction of a block.
+    fn wait(&self) -> &[f32] {
+        while self.slot.job_state.load(Ordering::Acquire) != WORKER_IDLE {
+            std::hint::spin_loop();
+        }
+        // SAFETY: the slot is IDLE again (observed with Acquire), so the
+        // worker is done with the cell and its writes are visible.
+        unsafe { &(*self.slot.state.get()).worker.outbuf }
+    }
+}
+
+impl Drop for RenderWorker {
+    fn drop(&mut self) {
+        self.slot.job_state.store(WORKER_EXIT, Ordering::Release);
+        if let Some(thread) = self.thread.take() {
+            thread.thread().unpark();
+            let _ = thread.join();
+        }
+    }
+}
+
+/// The body of each persistent render worker thread: park until a job is
+/// pending, render it, and hand the slot back.
+fn render_worker_main(slot: Arc<WorkerSlot>) {
+    loop {
+        match slot.job_state.load(Ordering::Acquire) {
+            WORKER_PENDING => (),
+            WORKER_EXIT => return,
+            _ => {
+                // Spurious wakeups just loop back around to the flag check.
+                std::thread::park();
+                continue;
+            }
+        }
+        // SAFETY: the slot is PENDING (observed with Acquire), so this
+        // thread owns the cell and the job's pointers are valid until the
+        // IDLE store below (see [RenderJob]).
+        let state = unsafe { &mut *slot.state.get() };
+        let job = state.job;
+        unsafe {
+            render_voices(
+                &*job.ctx,
+                &*job.matrix,
+                core::slice::from_raw_parts_mut(job.voices, job.num_voices),
+                &*job.params_src,
+                &mut state.worker.params,
+                core::slice::from_raw_parts(job.aftertouch, job.numsamples),
+                core::slice::from_raw_parts(job.modwheel, job.numsamples),
+                &mut state.worker.outbuf,
+                &mut state.worker.scratch,
+                job.numsamples,
+            );
+        }
+        slot.job_state.store(WORKER_IDLE, Ordering::Release);
+    }
+}
+
+/// Render a set of voices, accumulating their (1/16 scaled) output into
+/// `outbuf`.  This is the serial workhorse shared by both the single-threaded
+/// path and each worker thread of the parallel path: each voice is processed
+/// against a fresh copy of the parameters (copied from `params_src` into the
+/// `params` scratch buffer, since the modulation section mutates them).
+#[allow(clippy::too_many_arguments)]
+fn render_voices(
+    ctx: &Context<f32>,
+    matrix: &ModMatrix<f32>,
+    voices: &mut [PolySynthVoice],
+    params_src: &PluginParamBuf,
+    params: &mut PluginParamBuf,
+    aftertouchbuf: &[f32],
+    modwheelbuf: &[f32],
+    outbuf: &mut [f32],
+    scratch: &mut OscScratch<f32>,
+    numsamples: usize,
+) {
+    for smp in outbuf[0..numsamples].iter_mut() {
+        *smp = 0f32;
+    }
+    for voice in voices.iter_mut() {
+        // Skip inaudible release tails: if the amp envelope has decayed to
+        // silence and the voice is not gated anywhere in this block, its
+        // output would be all zeros anyway.
+        if voice.voice.is_idle() && voice.gatebuf[0..numsamples].iter().all(|g| *g == 0f32) {
+            continue;
+        }
+        let mut processed: usize = 0;
+        params_src.copy_to(params, numsamples);
+        while processed < numsamples {
+            let unison_voices = params.global.unison_voices();
+            let (sync, unison_detune) = params.global.sync_detune_mut(processed, numsamples);
+            let voiceparams = VoiceParams {
+                sync,
+                osc1_p: params.osc1.params_mut(processed, numsamples),
+                unison_voices,
+                unison_detune,
+                osc2_p: params.osc2.params_mut(processed, numsamples),
+                ring_p: params.ringmod.params_mut(processed, numsamples),
+                filt_p: params.filt.params_mut(processed, numsamples),
+                filt_env_p: params.env_filt.params_mut(processed, numsamples),
+                amp_env_p: params.env_amp.params_mut(processed, numsamples),
+                lfo1_p: params.lfo1.params(processed, numsamples),
+                lfo2_p: params.lfo2.params_mut(processed, numsamples),
+                env1_p: params.env1.params(processed, numsamples),
+                env2_p: params.env2.params_mut(processed, numsamples),
+            };
+            let thisiter = voice.voice.process(
+                ctx,
+                matrix,
+                &voice.notebuf[processed..numsamples],
+                &voice.gatebuf[processed..numsamples],
+                &voice.velbuf[processed..numsamples],
+                &aftertouchbuf[processed..numsamples],
+                &modwheelbuf[processed..numsamples],
+                voiceparams,
+                scratch,
+            );
+            for smp in thisiter {
+                outbuf[processed] += *smp / 16f32;
+                processed += 1;
+            }
+        }
+    }
+}
+
 pub struct PolySynth {
     voices: Vec<PolySynthVoice>,
+    /// The persistent worker threads for the parallel render path (the audio
+    /// thread itself renders one additional partition) - empty when the
+    /// host/voice count is too small for parallelism to pay off
+    workers: Vec<RenderWorker>,
     params: PluginParamBuf,
     params_backup: PluginParamBuf,
     active_voices: VecDeque<usize>,
     inactive_voices: VecDeque<usize>,
+    /// The effective voice cap set by the load governor (see
+    /// [VoiceAllocator::set_max_polyphony]) - always at least 1 and at most
+    /// `voices.len()`
+    max_voices: usize,
     outbuf: Vec<f32>,
+    scratch: OscScratch<f32>,
     aftertouchbuf: Vec<f32>,
     modwheelbuf: Vec<f32>,
     pitch_bend_range: (f32, f32),
@@ -56,6 +330,7 @@ pub struct PolySynth {
     aftertouch: f32,
     modwheel: f32,
     index: usize,
+    flushed: usize,
     ctx: Context<f32>,
 }
 
@@ -65,11 +340,14 @@ impl PolySynth {
             voices: std::iter::repeat_with(|| PolySynthVoice::new())
                 .take(num_voices)
                 .collect(),
+            workers: Vec::new(),
             params: PluginParamBuf::default(),
             params_backup: PluginParamBuf::default(),
             active_voices: VecDeque::new(),
             inactive_voices: VecDeque::new(),
+            max_voices: num_voices,
             outbuf: Vec::default(),
+            scratch: OscScratch::new(),
             aftertouchbuf: Vec::default(),
             modwheelbuf: Vec::default(),
             aftertouch: 0f32,
@@ -77,9 +355,25 @@ impl PolySynth {
             pitch_bend: 0f32,
             pitch_bend_range: (2f32, 2f32),
             index: 0,
+            flushed: 0,
             ctx: context,
         }
     }
+    /// Materialize the control values for the segment between the last event
+    /// boundary and the current index.  The control values are constant
+    /// between MIDI events, so a single fill per buffer per segment replaces
+    /// the per-sample writes.
+    fn flush(&mut self) {
+        let seg = self.flushed..self.index;
+        self.aftertouchbuf[seg.clone()].fill(self.aftertouch);
+        self.modwheelbuf[seg.clone()].fill(self.modwheel);
+        for voice in self.voices.iter_mut() {
+            voice.notebuf[seg.clone()].fill(f32::from(voice.note) + self.pitch_bend);
+            voice.gatebuf[seg.clone()].fill(voice.gate);
+            voice.velbuf[seg.clone()].fill(voice.vel);
+        }
+        self.flushed = self.index;
+    }
     fn note_on_i(&mut self, voice_index: usize, note: u8, vel: u8) {
         self.active_voices.push_back(voice_index);
         let voice = &mut self.voices[voice_index];
@@ -105,21 +399,40 @@ impl VoiceAllocator for PolySynth {
         self.outbuf.resize(sz, 0f32);
         self.aftertouchbuf.resize(sz, 0f32);
         self.modwheelbuf.resize(sz, 0f32);
+        // Size the pool of persistent workers for the parallel render path.
+        // The audio thread renders one partition itself, so one fewer thread
+        // is spawned than the number of render lanes; on small hosts/voice
+        // counts the pool is empty and process() renders serially.  This is
+        // the only place threads (or anything else) are created - process()
+        // just parks and unparks them.
+        let lanes = std::cmp::min(
+            std::thread::available_parallelism().map_or(1, |n| n.get()),
+            std::cmp::min(MAX_RENDER_WORKERS, self.voices.len() / MIN_VOICES_PER_WORKER),
+        );
+        self.workers.clear(); // joins any previous pool
+        if lanes >= 2 {
+            self.workers
+                .extend(std::iter::repeat_with(|| RenderWorker::spawn(sz)).take(lanes - 1));
+        }
+        self.max_voices = self.voices.len();
         self.index = 0;
+        self.flushed = 0;
         self.set_pitch_bend_range(2, 2);
     }
     fn sample_tick(&mut self) {
-        self.aftertouchbuf[self.index] = self.aftertouch;
-        self.modwheelbuf[self.index] = self.modwheel;
-        for voice in self.voices.iter_mut() {
-            voice.notebuf[self.index] = f32::from(voice.note) + self.pitch_bend;
-            voice.gatebuf[self.index] = voice.gate;
-            voice.velbuf[self.index] = voice.vel;
-        }
         self.index += 1;
     }
     fn note_on(&mut self, note: u8, velocity: u8) {
-        if let Some(i) = self.inactive_voices.pop_front() {
+        self.flush();
+        if self.active_voices.len() >= self.max_voices {
+            // At the (possibly governor-reduced) cap - steal the oldest
+            // active voice rather than waking another one
+            if let Some(i) = self.active_voices.pop_front() {
+                self.note_on_i(i, note, velocity);
+            } else {
+                nih_error!("Unable to steal voice");
+            }
+        } else if let Some(i) = self.inactive_voices.pop_front() {
             self.note_on_i(i, note, velocity);
         } else if let Some(i) = self.active_voices.pop_front() {
             self.note_on_i(i, note, velocity);
@@ -133,19 +446,53 @@ impl VoiceAllocator for PolySynth {
             .iter()
             .enumerate()
             .find(|(_, idx)| self.voices[**idx].note == note)
+            .map(|(act_idx, vox_idx)| (act_idx, *vox_idx))
         {
-            self.inactive_voices.push_back(*vox_idx);
-            self.voices[*vox_idx].gate = 0f32;
+            self.flush();
+            self.inactive_voices.push_back(vox_idx);
+            self.voices[vox_idx].gate = 0f32;
             self.active_voices.remove(act_idx);
         }
     }
+    fn set_max_polyphony(&mut self, cap: usize) {
+        self.max_voices = cap.clamp(1, self.voices.len());
+        // Shed the quietest sounding voices until we are within the cap.
+        // The released voices still decay at the patch's release rate, but
+        // since we pick the lowest amplifier envelope level first the loss
+        // is as close to inaudible as it can be.
+        while self.active_voices.len() > self.max_voices {
+            let quietest = self
+                .active_voices
+                .iter()
+                .enumerate()
+                .min_by(|(_, a), (_, b)| {
+                    self.voices[**a]
+                        .voice
+                        .amp_env_value()
+                        .partial_cmp(&self.voices[**b].voice.amp_env_value())
+                        .unwrap_or(std::cmp::Ordering::Equal)
+                })
+                .map(|(act_idx, vox_idx)| (act_idx, *vox_idx));
+            if let Some((act_idx, vox_idx)) = quietest {
+                self.flush();
+                self.inactive_voices.push_back(vox_idx);
+                self.voices[vox_idx].gate = 0f32;
+                self.active_voices.remove(act_idx);
+            } else {
+                break;
+            }
+        }
+    }
     fn aftertouch(&mut self, value: u8) {
+        self.flush();
         self.aftertouch = f32::from(value) / 127f32;
     }
     fn modwheel(&mut self, value: u8) {
+        self.flush();
         self.modwheel = f32::from(value) / 127f32;
     }
     fn pitch_bend(&mut self, value: i16) {
+        self.flush();
         let val_float = (value as f32) / (i16::MAX as f32);
         if val_float < 0f32 {
             self.pitch_bend = self.pitch_bend_range.0 * val_float;
@@ -159,52 +506,88 @@ impl VoiceAllocator for PolySynth {
     fn set_pitch_bend_range(&mut self, low: i8, high: i8) {
         self.pitch_bend_range = (low as f32, high as f32);
     }
-    fn process(
-        &mut self,
-        matrix_p: &ModMatrixPluginParams,
-        params: &mut PluginParamBufFxP,
-    ) -> &[f32] {
-        let matrix = matrix_p.build_matrix_float();
-        for smp in self.outbuf.iter_mut() {
-            *smp = 0f32;
-        }
+    fn process(&mut self, matrix: &MatrixSnapshot, params: &mut PluginParamBufFxP) -> &[f32] {
+        self.flush();
+        let matrix = &matrix.float;
         params.into_float(&mut self.params_backup, self.index);
-        for voice in self.voices.iter_mut() {
-            let mut processed: usize = 0;
-            self.params_backup.copy_to(&mut self.params, self.index);
-            while processed < self.index {
-                let voiceparams = VoiceParams {
-                    sync: self.params.global.sync_mut(processed, self.index),
-                    osc1_p: self.params.osc1.params_mut(processed, self.index),
-                    osc2_p: self.params.osc2.params_mut(processed, self.index),
-                    ring_p: self.params.ringmod.params_mut(processed, self.index),
-                    filt_p: self.params.filt.params_mut(processed, self.index),
-                    filt_env_p: self.params.env_filt.params_mut(processed, self.index),
-                    amp_env_p: self.params.env_amp.params_mut(processed, self.index),
-                    lfo1_p: self.params.lfo1.params(processed, self.index),
-                    lfo2_p: self.params.lfo2.params_mut(processed, self.index),
-                    env1_p: self.params.env1.params(processed, self.index),
-                    env2_p: self.params.env2.params_mut(processed, self.index),
-                };
-                let thisiter = voice.voice.process(
+        let numsamples = self.index;
+        if !self.workers.is_empty() && numsamples > 0 {
+            // Parallel path: partition the voices across the persistent
+            // workers plus this thread, render each partition into its own
+            // accumulation buffer, then mix the worker buffers on this
+            // thread.  The workers only see pointers into our buffers while
+            // their slots are pending, and every dispatch is paired with a
+            // wait below, so nothing escapes this block.
+            let lanes = self.workers.len() + 1;
+            let voices_per_lane = (self.voices.len() + lanes - 1) / lanes;
+            let mut chunks = self.voices.chunks_mut(voices_per_lane);
+            let mut dispatched = 0usize;
+            for (worker, voices) in self.workers.iter().zip(&mut chunks) {
+                worker.dispatch(RenderJob {
+                    ctx: &self.ctx,
+                    matrix,
+                    voices: voices.as_mut_ptr(),
+                    num_voices: voices.len(),
+                    params_src: &self.params_backup,
+                    aftertouch: self.aftertouchbuf.as_ptr(),
+                    modwheel: self.modwheelbuf.as_ptr(),
+                    numsamples,
+                });
+                dispatched += 1;
+            }
+            // Render the remaining partition here while the workers run.
+            if let Some(voices) = chunks.next() {
+                render_voices(
                     &self.ctx,
-                    &matrix,
-                    &voice.notebuf[processed..self.index],
-                    &voice.gatebuf[processed..self.index],
-                    &voice.velbuf[processed..self.index],
-                    &self.aftertouchbuf[processed..self.index],
-                    &self.modwheelbuf[processed..self.index],
-                    voiceparams,
+                    matrix,
+                    voices,
+                    &self.params_backup,
+                    &mut self.params,
+                    &self.aftertouchbuf,
+                    &self.modwheelbuf,
+                    &mut self.outbuf,
+                    &mut self.scratch,
+                    numsamples,
                 );
-                for smp in thisiter {
-                    self.outbuf[processed] += *smp / 16f32;
-                    processed += 1;
+            } else {
+                for smp in self.outbuf[0..numsamples].iter_mut() {
+                    *smp = 0f32;
+                }
+            }
+            for worker in self.workers[0..dispatched].iter() {
+                let worker_out = worker.wait();
+                for (out, smp) in self.outbuf[0..numsamples]
+                    .iter_mut()
+                    .zip(worker_out[0..numsamples].iter())
+                {
+                    *out += *smp;
                 }
             }
+        } else {
+            render_voices(
+                &self.ctx,
+                matrix,
+                &mut self.voices,
+                &self.params_backup,
+                &mut self.params,
+                &self.aftertouchbuf,
+                &self.modwheelbuf,
+                &mut self.outbuf,
+                &mut self.scratch,
+                numsamples,
+            );
         }
-        let oldindex = self.index;
         self.index = 0;
-        &self.outbuf[0..oldindex]
+        self.flushed = 0;
+        &self.outbuf[0..numsamples]
+    }
+    #[cfg(feature = "profile")]
+    fn take_profile(&mut self) -> culsynth::profiling::StageProfile {
+        let mut ret = culsynth::profiling::StageProfile::default();
+        for voice in self.voices.iter_mut() {
+            ret.merge(&voice.voice.take_profile());
+        }
+        ret
     }
     fn get_context(&self) -> &dyn GenericContext {
         &self.ctx
@@ -249,8 +632,13 @@ impl PolySynthVoiceFxP {
 pub struct PolySynthFxP {
     voices: Vec<PolySynthVoiceFxP>,
     params: PluginParamBufFxP,
+    scratch: OscScratch<SampleFxP>,
     active_voices: VecDeque<usize>,
     inactive_voices: VecDeque<usize>,
+    /// The effective voice cap set by the load governor (see
+    /// [VoiceAllocator::set_max_polyphony]) - always at least 1 and at most
+    /// `voices.len()`
+    max_voices: usize,
     outbuf: Vec<f32>,
     aftertouchbuf: Vec<ScalarFxP>,
     modwheelbuf: Vec<ScalarFxP>,
@@ -259,6 +647,7 @@ pub struct PolySynthFxP {
     aftertouch: ScalarFxP,
     modwheel: ScalarFxP,
     index: usize,
+    flushed: usize,
     ctx: ContextFxP,
 }
 
@@ -269,8 +658,10 @@ impl PolySynthFxP {
                 .take(num_voices)
                 .collect(),
             params: PluginParamBufFxP::default(),
+            scratch: OscScratch::new(),
             active_voices: VecDeque::new(),
             inactive_voices: VecDeque::new(),
+            max_voices: num_voices,
             outbuf: Vec::new(),
             aftertouchbuf: Vec::new(),
             modwheelbuf: Vec::new(),
@@ -279,9 +670,24 @@ impl PolySynthFxP {
             aftertouch: ScalarFxP::ZERO,
             modwheel: ScalarFxP::ZERO,
             index: 0,
+            flushed: 0,
             ctx: context,
         }
     }
+    /// Materialize the control values for the segment between the last event
+    /// boundary and the current index (see [PolySynth::flush]).
+    fn flush(&mut self) {
+        let seg = self.flushed..self.index;
+        self.aftertouchbuf[seg.clone()].fill(self.aftertouch);
+        self.modwheelbuf[seg.clone()].fill(self.modwheel);
+        for voice in self.voices.iter_mut() {
+            voice.notebuf[seg.clone()]
+                .fill(NoteFxP::from_num(voice.note).add_signed(self.pitch_bend));
+            voice.gatebuf[seg.clone()].fill(voice.gate);
+            voice.velbuf[seg.clone()].fill(voice.vel);
+        }
+        self.flushed = self.index;
+    }
     fn note_on_i(&mut self, voice_index: usize, note: u8, vel: u8) {
         self.active_voices.push_back(voice_index);
         let voice = &mut self.voices[voice_index];
@@ -306,21 +712,25 @@ impl VoiceAllocator for PolySynthFxP {
         self.outbuf.resize(sz, 0f32);
         self.aftertouchbuf.resize(sz, ScalarFxP::ZERO);
         self.modwheelbuf.resize(sz, ScalarFxP::ZERO);
+        self.max_voices = self.voices.len();
         self.index = 0;
+        self.flushed = 0;
         self.set_pitch_bend_range(2, 2);
     }
     fn sample_tick(&mut self) {
-        self.aftertouchbuf[self.index] = self.aftertouch;
-        self.modwheelbuf[self.index] = self.modwheel;
-        for voice in self.voices.iter_mut() {
-            voice.notebuf[self.index] = NoteFxP::from_num(voice.note).add_signed(self.pitch_bend);
-            voice.gatebuf[self.index] = voice.gate;
-            voice.velbuf[self.index] = voice.vel;
-        }
         self.index += 1;
     }
     fn note_on(&mut self, note: u8, velocity: u8) {
-        if let Some(i) = self.inactive_voices.pop_front() {
+        self.flush();
+        if self.active_voices.len() >= self.max_voices {
+            // At the (possibly governor-reduced) cap - steal the oldest
+            // active voice rather than waking another one
+            if let Some(i) = self.active_voices.pop_front() {
+                self.note_on_i(i, note, velocity);
+            } else {
+                nih_error!("Unable to steal voice");
+            }
+        } else if let Some(i) = self.inactive_voices.pop_front() {
             self.note_on_i(i, note, velocity);
         } else if let Some(i) = self.active_voices.pop_front() {
             self.note_on_i(i, note, velocity);
@@ -334,19 +744,45 @@ impl VoiceAllocator for PolySynthFxP {
             .iter()
             .enumerate()
             .find(|(_, idx)| self.voices[**idx].note == note)
+            .map(|(act_idx, vox_idx)| (act_idx, *vox_idx))
         {
-            self.inactive_voices.push_back(*vox_idx);
-            self.voices[*vox_idx].gate = SampleFxP::ZERO;
+            self.flush();
+            self.inactive_voices.push_back(vox_idx);
+            self.voices[vox_idx].gate = SampleFxP::ZERO;
             self.active_voices.remove(act_idx);
         }
     }
+    fn set_max_polyphony(&mut self, cap: usize) {
+        self.max_voices = cap.clamp(1, self.voices.len());
+        // Shed the quietest sounding voices until we are within the cap
+        // (see [PolySynth::set_max_polyphony])
+        while self.active_voices.len() > self.max_voices {
+            let quietest = self
+                .active_voices
+                .iter()
+                .enumerate()
+                .min_by_key(|(_, idx)| self.voices[**idx].voice.amp_env_value())
+                .map(|(act_idx, vox_idx)| (act_idx, *vox_idx));
+            if let Some((act_idx, vox_idx)) = quietest {
+                self.flush();
+                self.inactive_voices.push_back(vox_idx);
+                self.voices[vox_idx].gate = SampleFxP::ZERO;
+                self.active_voices.remove(act_idx);
+            } else {
+                break;
+            }
+        }
+    }
     fn aftertouch(&mut self, value: u8) {
+        self.flush();
         self.aftertouch = ScalarFxP::from_bits((value as u16) << 9);
     }
     fn modwheel(&mut self, value: u8) {
+        self.flush();
         self.modwheel = ScalarFxP::from_bits((value as u16) << 9);
     }
     fn pitch_bend(&mut self, v: i16) {
+        self.flush();
         if v < 0 {
             self.pitch_bend =
                 SignedNoteFxP::from_num(IScalarFxP::from_bits(v).wide_mul(self.pitch_bend_range.0));
@@ -367,22 +803,32 @@ impl VoiceAllocator for PolySynthFxP {
             fixed::types::I16F0::from_num(high),
         );
     }
-    fn process(
-        &mut self,
-        matrix_p: &ModMatrixPluginParams,
-        params: &mut PluginParamBufFxP,
-    ) -> &[f32] {
-        let matrix = matrix_p.build_matrix();
+    fn process(&mut self, matrix: &MatrixSnapshot, params: &mut PluginParamBufFxP) -> &[f32] {
+        self.flush();
+        let matrix = &matrix.fxp;
         for smp in self.outbuf.iter_mut() {
             *smp = 0f32;
         }
         for voice in self.voices.iter_mut() {
+            // Skip inaudible release tails: if the amp envelope has decayed
+            // to silence and the voice is not gated anywhere in this block,
+            // its output would be all zeros anyway.
+            if voice.voice.is_idle()
+                && voice.gatebuf[0..self.index].iter().all(|g| *g == SampleFxP::ZERO)
+            {
+                continue;
+            }
             let mut processed: usize = 0;
             params.copy_to(&mut self.params, self.index);
             while processed < self.index {
+                let unison_voices = self.params.global.unison_voices();
+                let (sync, unison_detune) =
+                    self.params.global.sync_detune_mut(processed, self.index);
                 let voiceparams = VoiceParamsFxP {
-                    sync: self.params.global.sync_mut(processed, self.index),
+                    sync,
                     osc1_p: self.params.osc1.params_mut(processed, self.index),
+                    unison_voices,
+                    unison_detune,
                     osc2_p: self.params.osc2.params_mut(processed, self.index),
                     ring_p: self.params.ringmod.params_mut(processed, self.index),
                     filt_p: self.params.filt.params_mut(processed, self.index),
@@ -395,13 +841,14 @@ impl VoiceAllocator for PolySynthFxP {
                 };
                 let thisiter = voice.voice.process(
                     &self.ctx,
-                    &matrix,
+                    matrix,
                     &voice.notebuf[processed..self.index],
                     &voice.gatebuf[processed..self.index],
                     &voice.velbuf[processed..self.index],
                     &self.aftertouchbuf[processed..self.index],
                     &self.modwheelbuf[processed..self.index],
                     voiceparams,
+                    &mut self.scratch,
                 );
                 for smp in thisiter {
                     self.outbuf[processed] += smp.unwrapped_shr(4).to_num::<f32>();
@@ -411,8 +858,17 @@ impl VoiceAllocator for PolySynthFxP {
         }
         let old_index = self.index;
         self.index = 0;
+        self.flushed = 0;
         &self.outbuf[0..old_index]
     }
+    #[cfg(feature = "profile")]
+    fn take_profile(&mut self) -> culsynth::profiling::StageProfile {
+        let mut ret = culsynth::profiling::StageProfile::default();
+        for voice in self.voices.iter_mut() {
+            ret.merge(&voice.voice.take_profile());
+        }
+        ret
+    }
     fn get_context(&self) -> &dyn GenericContext {
         &self.ctx
     }
@@ -1,5 +1,6 @@
 from ctypes import *
 import sys
+import numpy as np
 
 _is_windows = sys.platform.startswith('win')
 
@@ -8,6 +9,28 @@ if _is_windows:
 else:
     _lib = CDLL('../target/debug/libculsynth.so')
 
+# Number of modulation matrix slots (dest, depth) pairs, row-major by
+# modulation source - see build_matrix_u16 in the bindings crate
+MOD_SLOTS = 28
+
+def _num_samples(*args):
+    return min(len(a) for a in args if hasattr(a, '__len__'))
+
+def _in(x, dtype, n):
+    """Coerce an input to a contiguous n-element array of the given dtype.
+
+    Zero-copy when x is already a contiguous array of the right dtype;
+    scalars are broadcast to n elements."""
+    a = np.ascontiguousarray(x, dtype=dtype)
+    if a.ndim == 0:
+        a = np.full(n, a.item(), dtype=dtype)
+    elif len(a) < n:
+        raise ValueError('buffer holds fewer than %d samples' % n)
+    return a
+
+def _ptr(a, ctype):
+    return a.ctypes.data_as(POINTER(ctype))
+
 _culsynth_osc_u16_new = _lib.culsynth_osc_u16_new
 _culsynth_osc_u16_new.argtypes = []
 _culsynth_osc_u16_new.restype = c_void_p
@@ -16,48 +39,39 @@ _culsynth_osc_u16_free = _lib.culsynth_osc_u16_free
 _culsynth_osc_u16_free.argtypes = [c_void_p]
 _culsynth_osc_u16_free.restype = None
 
-_culsynth_osc_u16_process = _lib.culsynth_osc_u16_process
-_culsynth_osc_u16_process.argtypes = [
+_culsynth_osc_u16_process_batch = _lib.culsynth_osc_u16_process_batch
+_culsynth_osc_u16_process_batch.argtypes = [
     c_void_p,
     c_uint32,
     POINTER(c_uint16),
+    POINTER(c_int16),
     POINTER(c_uint16),
-    POINTER(POINTER(c_int16)),
-    POINTER(POINTER(c_int16)),
-    POINTER(POINTER(c_int16)),
-    POINTER(POINTER(c_int16)),
-    c_uint32
+    POINTER(c_int16),
+    POINTER(c_int16),
+    POINTER(c_int16),
+    POINTER(c_int16)
 ]
-_culsynth_osc_u16_process.restype = c_int32
+_culsynth_osc_u16_process_batch.restype = c_int32
 
 class OscFxP:
     def __init__(self):
         self.ptr = _culsynth_osc_u16_new()
     def __del__(self):
         _culsynth_osc_u16_free(self.ptr)
-    def process(self, note, shape):
-        num_samples = min(len(note), len(shape))
-        tri = POINTER(c_int16)()
-        sq = POINTER(c_int16)()
-        sn = POINTER(c_int16)()
-        saw = POINTER(c_int16)()
-        note_arr = (c_uint16*num_samples)(*note)
-        shape_arr = (c_uint16*num_samples)(*shape)
-        processed = 0
-        sn_list = []
-        sq_list = []
-        tri_list = []
-        saw_list = []
-        while processed < num_samples:
-            iter_proc = _culsynth_osc_u16_process(self.ptr,
-                c_uint32(num_samples - processed), note_arr, shape_arr,
-                byref(sn), byref(tri), byref(sq), byref(saw), c_uint32(processed))
-            sn_list = sn_list + sn[:iter_proc]
-            sq_list = sq_list + sq[:iter_proc]
-            tri_list = tri_list + tri[:iter_proc]
-            saw_list = saw_list + saw[:iter_proc]
-            processed += iter_proc
-        return (sn_list, sq_list, tri_list, saw_list)
+    def process(self, note, shape, tune=0):
+        num_samples = _num_samples(note, shape)
+        note = _in(note, np.uint16, num_samples)
+        shape = _in(shape, np.uint16, num_samples)
+        tune = _in(tune, np.int16, num_samples)
+        sn = np.empty(num_samples, dtype=np.int16)
+        tri = np.empty(num_samples, dtype=np.int16)
+        sq = np.empty(num_samples, dtype=np.int16)
+        saw = np.empty(num_samples, dtype=np.int16)
+        _culsynth_osc_u16_process_batch(self.ptr, c_uint32(num_samples),
+            _ptr(note, c_uint16), _ptr(tune, c_int16), _ptr(shape, c_uint16),
+            _ptr(sn, c_int16), _ptr(tri, c_int16), _ptr(sq, c_int16),
+            _ptr(saw, c_int16))
+        return (sn, sq, tri, saw)
 
 _culsynth_env_u16_new = _lib.culsynth_env_u16_new
 _culsynth_env_u16_new.argtypes = []
@@ -67,8 +81,8 @@ _culsynth_env_u16_free = _lib.culsynth_env_u16_free
 _culsynth_env_u16_free.argtypes = [c_void_p]
 _culsynth_env_u16_free.restype = None
 
-_culsynth_env_u16_process = _lib.culsynth_env_u16_process
-_culsynth_env_u16_process.argtypes = [
+_culsynth_env_u16_process_batch = _lib.culsynth_env_u16_process_batch
+_culsynth_env_u16_process_batch.argtypes = [
     c_void_p,
     c_uint32,
     POINTER(c_int16),
@@ -76,10 +90,9 @@ _culsynth_env_u16_process.argtypes = [
     POINTER(c_uint16),
     POINTER(c_uint16),
     POINTER(c_uint16),
-    POINTER(POINTER(c_uint16)),
-    c_uint32
+    POINTER(c_uint16)
 ]
-_culsynth_env_u16_process.restype = c_int32
+_culsynth_env_u16_process_batch.restype = c_int32
 
 class EnvFxP:
     def __init__(self):
@@ -87,24 +100,19 @@ class EnvFxP:
     def __del__(self):
         _culsynth_env_u16_free(self.ptr)
     def process(self, gate, attack, decay, sustain, release):
-        num_samples = min(len(x) for x in [gate, attack, decay, sustain, release])
-        signal = POINTER(c_uint16)()
-        gate_arr = (c_int16*num_samples)(*gate)
-        attack_arr = (c_uint16*num_samples)(*attack)
-        decay_arr = (c_uint16*num_samples)(*decay)
-        sustain_arr = (c_uint16*num_samples)(*sustain)
-        release_arr = (c_uint16*num_samples)(*release)
-        processed = 0
-        output = []
-        while processed < num_samples:
-            iter_proc = _culsynth_env_u16_process(self.ptr,
-                c_uint32(num_samples - processed), gate_arr, attack_arr,
-                decay_arr, sustain_arr, release_arr, byref(signal),
-                c_uint32(processed))
-            output = output + signal[:iter_proc]
-            processed += iter_proc
-        return output
-    
+        num_samples = _num_samples(gate, attack, decay, sustain, release)
+        gate = _in(gate, np.int16, num_samples)
+        attack = _in(attack, np.uint16, num_samples)
+        decay = _in(decay, np.uint16, num_samples)
+        sustain = _in(sustain, np.uint16, num_samples)
+        release = _in(release, np.uint16, num_samples)
+        signal = np.empty(num_samples, dtype=np.uint16)
+        _culsynth_env_u16_process_batch(self.ptr, c_uint32(num_samples),
+            _ptr(gate, c_int16), _ptr(attack, c_uint16), _ptr(decay, c_uint16),
+            _ptr(sustain, c_uint16), _ptr(release, c_uint16),
+            _ptr(signal, c_uint16))
+        return signal
+
 _culsynth_filt_u16_new = _lib.culsynth_filt_u16_new
 _culsynth_filt_u16_new.argtypes = []
 _culsynth_filt_u16_new.restype = c_void_p
@@ -113,19 +121,18 @@ _culsynth_filt_u16_free = _lib.culsynth_filt_u16_free
 _culsynth_filt_u16_free.argtypes = [c_void_p]
 _culsynth_filt_u16_free.restype = None
 
-_culsynth_filt_u16_process = _lib.culsynth_filt_u16_process
-_culsynth_filt_u16_process.argtypes = [
+_culsynth_filt_u16_process_batch = _lib.culsynth_filt_u16_process_batch
+_culsynth_filt_u16_process_batch.argtypes = [
     c_void_p,
     c_uint32,
     POINTER(c_int16),
     POINTER(c_uint16),
     POINTER(c_uint16),
-    POINTER(POINTER(c_int16)),
-    POINTER(POINTER(c_int16)),
-    POINTER(POINTER(c_int16)),
-    c_uint32
+    POINTER(c_int16),
+    POINTER(c_int16),
+    POINTER(c_int16)
 ]
-_culsynth_filt_u16_process.restype = c_int32
+_culsynth_filt_u16_process_batch.restype = c_int32
 
 class FiltFxP:
     def __init__(self):
@@ -133,28 +140,18 @@ class FiltFxP:
     def __del__(self):
         _culsynth_filt_u16_free(self.ptr)
     def process(self, input, cutoff, resonance):
-        num_samples = min(len(x) for x in [input, cutoff, resonance])
-        low = POINTER(c_int16)()
-        band = POINTER(c_int16)()
-        high = POINTER(c_int16)()
-        input_arr = (c_int16*num_samples)(*input)
-        cutoff_arr = (c_uint16*num_samples)(*cutoff)
-        resonance_arr = (c_uint16*num_samples)(*resonance)
-        processed = 0
-        low_list = []
-        band_list = []
-        high_list = []
-        while processed < num_samples:
-            iter_proc = _culsynth_filt_u16_process(self.ptr,
-                c_uint32(num_samples - processed), input_arr, cutoff_arr,
-                resonance_arr, byref(low), byref(band), byref(high),
-                c_uint32(processed))
-            low_list = low_list + low[:iter_proc]
-            band_list = band_list + band[:iter_proc]
-            high_list = high_list + high[:iter_proc]
-            processed += iter_proc
-        return (low_list, band_list, high_list)
-    
+        num_samples = _num_samples(input, cutoff, resonance)
+        input = _in(input, np.int16, num_samples)
+        cutoff = _in(cutoff, np.uint16, num_samples)
+        resonance = _in(resonance, np.uint16, num_samples)
+        low = np.empty(num_samples, dtype=np.int16)
+        band = np.empty(num_samples, dtype=np.int16)
+        high = np.empty(num_samples, dtype=np.int16)
+        _culsynth_filt_u16_process_batch(self.ptr, c_uint32(num_samples),
+            _ptr(input, c_int16), _ptr(cutoff, c_uint16),
+            _ptr(resonance, c_uint16), _ptr(low, c_int16),
+            _ptr(band, c_int16), _ptr(high, c_int16))
+        return (low, band, high)
 
 _culsynth_osc_f32_new = _lib.culsynth_osc_f32_new
 _culsynth_osc_f32_new.argtypes = []
@@ -164,48 +161,39 @@ _culsynth_osc_f32_free = _lib.culsynth_osc_f32_free
 _culsynth_osc_f32_free.argtypes = [c_void_p]
 _culsynth_osc_f32_free.restype = None
 
-_culsynth_osc_f32_process = _lib.culsynth_osc_f32_process
-_culsynth_osc_f32_process.argtypes = [
+_culsynth_osc_f32_process_batch = _lib.culsynth_osc_f32_process_batch
+_culsynth_osc_f32_process_batch.argtypes = [
     c_void_p,
     c_uint32,
     POINTER(c_float),
     POINTER(c_float),
-    POINTER(POINTER(c_float)),
-    POINTER(POINTER(c_float)),
-    POINTER(POINTER(c_float)),
-    POINTER(POINTER(c_float)),
-    c_uint32
+    POINTER(c_float),
+    POINTER(c_float),
+    POINTER(c_float),
+    POINTER(c_float),
+    POINTER(c_float)
 ]
-_culsynth_osc_f32_process.restype = c_int32
+_culsynth_osc_f32_process_batch.restype = c_int32
 
 class OscFloat:
     def __init__(self):
         self.ptr = _culsynth_osc_f32_new()
     def __del__(self):
         _culsynth_osc_f32_free(self.ptr)
-    def process(self, note, shape):
-        num_samples = min(len(note), len(shape))
-        tri = POINTER(c_float)()
-        sq = POINTER(c_float)()
-        sn = POINTER(c_float)()
-        saw = POINTER(c_float)()
-        note_arr = (c_float*num_samples)(*note)
-        shape_arr = (c_float*num_samples)(*shape)
-        processed = 0
-        sn_list = []
-        sq_list = []
-        tri_list = []
-        saw_list = []
-        while processed < num_samples:
-            iter_proc = _culsynth_osc_f32_process(self.ptr,
-                c_uint32(num_samples - processed), note_arr, shape_arr,
-                byref(sn), byref(tri), byref(sq), byref(saw), c_uint32(processed))
-            sn_list = sn_list + sn[:iter_proc]
-            sq_list = sq_list + sq[:iter_proc]
-            tri_list = tri_list + tri[:iter_proc]
-            saw_list = saw_list + saw[:iter_proc]
-            processed += iter_proc
-        return (sn_list, sq_list, tri_list, saw_list)
+    def process(self, note, shape, tune=0):
+        num_samples = _num_samples(note, shape)
+        note = _in(note, np.float32, num_samples)
+        shape = _in(shape, np.float32, num_samples)
+        tune = _in(tune, np.float32, num_samples)
+        sn = np.empty(num_samples, dtype=np.float32)
+        tri = np.empty(num_samples, dtype=np.float32)
+        sq = np.empty(num_samples, dtype=np.float32)
+        saw = np.empty(num_samples, dtype=np.float32)
+        _culsynth_osc_f32_process_batch(self.ptr, c_uint32(num_samples),
+            _ptr(note, c_float), _ptr(tune, c_float), _ptr(shape, c_float),
+            _ptr(sn, c_float), _ptr(tri, c_float), _ptr(sq, c_float),
+            _ptr(saw, c_float))
+        return (sn, sq, tri, saw)
 
 _culsynth_env_f32_new = _lib.culsynth_env_f32_new
 _culsynth_env_f32_new.argtypes = []
@@ -215,8 +203,8 @@ _culsynth_env_f32_free = _lib.culsynth_env_f32_free
 _culsynth_env_f32_free.argtypes = [c_void_p]
 _culsynth_env_f32_free.restype = None
 
-_culsynth_env_f32_process = _lib.culsynth_env_f32_process
-_culsynth_env_f32_process.argtypes = [
+_culsynth_env_f32_process_batch = _lib.culsynth_env_f32_process_batch
+_culsynth_env_f32_process_batch.argtypes = [
     c_void_p,
     c_uint32,
     POINTER(c_float),
@@ -224,10 +212,9 @@ _culsynth_env_f32_process.argtypes = [
     POINTER(c_float),
     POINTER(c_float),
     POINTER(c_float),
-    POINTER(POINTER(c_float)),
-    c_uint32
+    POINTER(c_float)
 ]
-_culsynth_env_f32_process.restype = c_int32
+_culsynth_env_f32_process_batch.restype = c_int32
 
 class EnvFloat:
     def __init__(self):
@@ -235,24 +222,19 @@ class EnvFloat:
     def __del__(self):
         _culsynth_env_f32_free(self.ptr)
     def process(self, gate, attack, decay, sustain, release):
-        num_samples = min(len(x) for x in [gate, attack, decay, sustain, release])
-        signal = POINTER(c_float)()
-        gate_arr = (c_float*num_samples)(*gate)
-        attack_arr = (c_float*num_samples)(*attack)
-        decay_arr = (c_float*num_samples)(*decay)
-        sustain_arr = (c_float*num_samples)(*sustain)
-        release_arr = (c_float*num_samples)(*release)
-        processed = 0
-        output = []
-        while processed < num_samples:
-            iter_proc = _culsynth_env_f32_process(self.ptr,
-                c_uint32(num_samples - processed), gate_arr, attack_arr,
-                decay_arr, sustain_arr, release_arr, byref(signal),
-                c_uint32(processed))
-            output = output + signal[:iter_proc]
-            processed += iter_proc
-        return output
-    
+        num_samples = _num_samples(gate, attack, decay, sustain, release)
+        gate = _in(gate, np.float32, num_samples)
+        attack = _in(attack, np.float32, num_samples)
+        decay = _in(decay, np.float32, num_samples)
+        sustain = _in(sustain, np.float32, num_samples)
+        release = _in(release, np.float32, num_samples)
+        signal = np.empty(num_samples, dtype=np.float32)
+        _culsynth_env_f32_process_batch(self.ptr, c_uint32(num_samples),
+            _ptr(gate, c_float), _ptr(attack, c_float), _ptr(decay, c_float),
+            _ptr(sustain, c_float), _ptr(release, c_float),
+            _ptr(signal, c_float))
+        return signal
+
 _culsynth_filt_f32_new = _lib.culsynth_filt_f32_new
 _culsynth_filt_f32_new.argtypes = []
 _culsynth_filt_f32_new.restype = c_void_p
@@ -261,19 +243,18 @@ _culsynth_filt_f32_free = _lib.culsynth_filt_f32_free
 _culsynth_filt_f32_free.argtypes = [c_void_p]
 _culsynth_filt_f32_free.restype = None
 
-_culsynth_filt_f32_process = _lib.culsynth_filt_f32_process
-_culsynth_filt_f32_process.argtypes = [
+_culsynth_filt_f32_process_batch = _lib.culsynth_filt_f32_process_batch
+_culsynth_filt_f32_process_batch.argtypes = [
     c_void_p,
     c_uint32,
     POINTER(c_float),
     POINTER(c_float),
     POINTER(c_float),
-    POINTER(POINTER(c_float)),
-    POINTER(POINTER(c_float)),
-    POINTER(POINTER(c_float)),
-    c_uint32
+    POINTER(c_float),
+    POINTER(c_float),
+    POINTER(c_float)
 ]
-_culsynth_filt_f32_process.restype = c_int32
+_culsynth_filt_f32_process_batch.restype = c_int32
 
 class FiltFloat:
     def __init__(self):
@@ -281,24 +262,210 @@ class FiltFloat:
     def __del__(self):
         _culsynth_filt_f32_free(self.ptr)
     def process(self, input, cutoff, resonance):
-        num_samples = min(len(x) for x in [input, cutoff, resonance])
-        low = POINTER(c_float)()
-        band = POINTER(c_float)()
-        high = POINTER(c_float)()
-        input_arr = (c_float*num_samples)(*input)
-        cutoff_arr = (c_float*num_samples)(*cutoff)
-        resonance_arr = (c_float*num_samples)(*resonance)
-        processed = 0
-        low_list = []
-        band_list = []
-        high_list = []
-        while processed < num_samples:
-            iter_proc = _culsynth_filt_f32_process(self.ptr,
-                c_uint32(num_samples - processed), input_arr, cutoff_arr,
-                resonance_arr, byref(low), byref(band), byref(high),
-                c_uint32(processed))
-            low_list = low_list + low[:iter_proc]
-            band_list = band_list + band[:iter_proc]
-            high_list = high_list + high[:iter_proc]
-            processed += iter_proc
-        return (low_list, band_list, high_list)
\ No newline at end of file
+        num_samples = _num_samples(input, cutoff, resonance)
+        input = _in(input, np.float32, num_samples)
+        cutoff = _in(cutoff, np.float32, num_samples)
+        resonance = _in(resonance, np.float32, num_samples)
+        low = np.empty(num_samples, dtype=np.float32)
+        band = np.empty(num_samples, dtype=np.float32)
+        high = np.empty(num_samples, dtype=np.float32)
+        _culsynth_filt_f32_process_batch(self.ptr, c_uint32(num_samples),
+            _ptr(input, c_float), _ptr(cutoff, c_float),
+            _ptr(resonance, c_float), _ptr(low, c_float),
+            _ptr(band, c_float), _ptr(high, c_float))
+        return (low, band, high)
+
+# One (name, ctype, numpy dtype, default) entry per parameter buffer, in the
+# exact field order of VoiceParamsU16 in the bindings crate.  The defaults
+# describe a basic patch: oscillator 1 saw at full mix, filter wide open on
+# its lowpass tap, instant full-sustain envelopes, and no modulation.
+_VOICE_FIELDS_U16 = [
+    ('sync', c_uint16, np.uint16, 0),
+    ('osc1_tune', c_int16, np.int16, 0),
+    ('osc1_shape', c_uint16, np.uint16, 0),
+    ('osc1_sin', c_uint16, np.uint16, 0),
+    ('osc1_sq', c_uint16, np.uint16, 0),
+    ('osc1_tri', c_uint16, np.uint16, 0),
+    ('osc1_saw', c_uint16, np.uint16, 0xffff),
+    ('osc2_tune', c_int16, np.int16, 0),
+    ('osc2_shape', c_uint16, np.uint16, 0),
+    ('osc2_sin', c_uint16, np.uint16, 0),
+    ('osc2_sq', c_uint16, np.uint16, 0),
+    ('osc2_tri', c_uint16, np.uint16, 0),
+    ('osc2_saw', c_uint16, np.uint16, 0xffff),
+    ('ring_mix_out', c_uint16, np.uint16, 0),
+    ('ring_mix_a', c_uint16, np.uint16, 0xffff),
+    ('ring_mix_b', c_uint16, np.uint16, 0),
+    ('filt_env_mod', c_uint16, np.uint16, 0),
+    ('filt_vel_mod', c_uint16, np.uint16, 0),
+    ('filt_kbd', c_uint16, np.uint16, 0),
+    ('filt_cutoff', c_uint16, np.uint16, 0xffff),
+    ('filt_resonance', c_uint16, np.uint16, 0),
+    ('filt_low_mix', c_uint16, np.uint16, 0xffff),
+    ('filt_band_mix', c_uint16, np.uint16, 0),
+    ('filt_high_mix', c_uint16, np.uint16, 0),
+    ('env_filt_attack', c_uint16, np.uint16, 0),
+    ('env_filt_decay', c_uint16, np.uint16, 0),
+    ('env_filt_sustain', c_uint16, np.uint16, 0xffff),
+    ('env_filt_release', c_uint16, np.uint16, 0),
+    ('env_amp_attack', c_uint16, np.uint16, 0),
+    ('env_amp_decay', c_uint16, np.uint16, 0),
+    ('env_amp_sustain', c_uint16, np.uint16, 0xffff),
+    ('env_amp_release', c_uint16, np.uint16, 0),
+    ('lfo1_freq', c_uint16, np.uint16, 0),
+    ('lfo1_depth', c_uint16, np.uint16, 0),
+    ('lfo1_opts', c_uint16, np.uint16, 0),
+    ('lfo2_freq', c_uint16, np.uint16, 0),
+    ('lfo2_depth', c_uint16, np.uint16, 0),
+    ('lfo2_opts', c_uint16, np.uint16, 0),
+    ('env1_attack', c_uint16, np.uint16, 0),
+    ('env1_decay', c_uint16, np.uint16, 0),
+    ('env1_sustain', c_uint16, np.uint16, 0xffff),
+    ('env1_release', c_uint16, np.uint16, 0),
+    ('env2_attack', c_uint16, np.uint16, 0),
+    ('env2_decay', c_uint16, np.uint16, 0),
+    ('env2_sustain', c_uint16, np.uint16, 0xffff),
+    ('env2_release', c_uint16, np.uint16, 0),
+]
+
+def _f32_field(name, ctype, dtype, default):
+    # LFO options stay packed u16 regardless of sample type
+    if name.endswith('_opts'):
+        return (name, ctype, dtype, default)
+    if name == 'filt_cutoff':
+        default = 127.0
+    else:
+        default = 1.0 if default == 0xffff else 0.0
+    return (name, c_float, np.float32, default)
+
+_VOICE_FIELDS_F32 = [_f32_field(*f) for f in _VOICE_FIELDS_U16]
+
+class _VoiceParamsU16(Structure):
+    _fields_ = [(name, POINTER(ct)) for (name, ct, _, _) in _VOICE_FIELDS_U16]
+
+class _VoiceParamsF32(Structure):
+    _fields_ = [(name, POINTER(ct)) for (name, ct, _, _) in _VOICE_FIELDS_F32]
+
+_culsynth_voice_u16_new = _lib.culsynth_voice_u16_new
+_culsynth_voice_u16_new.argtypes = []
+_culsynth_voice_u16_new.restype = c_void_p
+
+_culsynth_voice_u16_free = _lib.culsynth_voice_u16_free
+_culsynth_voice_u16_free.argtypes = [c_void_p]
+_culsynth_voice_u16_free.restype = None
+
+_culsynth_voice_u16_process_batch = _lib.culsynth_voice_u16_process_batch
+_culsynth_voice_u16_process_batch.argtypes = [
+    c_void_p,
+    c_uint32,
+    POINTER(c_uint16),
+    POINTER(c_int16),
+    POINTER(c_uint16),
+    POINTER(c_uint16),
+    POINTER(c_uint16),
+    POINTER(_VoiceParamsU16),
+    POINTER(c_uint16),
+    POINTER(c_int16),
+    POINTER(c_int16)
+]
+_culsynth_voice_u16_process_batch.restype = c_int32
+
+class VoiceFxP:
+    """A full fixed-point synthesizer voice.
+
+    Parameter buffers are passed to process() as keyword arguments named
+    after the fields of VoiceParamsU16 in the bindings crate (e.g.
+    osc1_shape, filt_cutoff, env_amp_attack).  Each may be a scalar or an
+    array of raw fixed-point bit values; unspecified parameters default to
+    a basic saw patch.  Modulated parameters are written back in place, so
+    pass copies of arrays you wish to keep.
+    """
+    def __init__(self):
+        self.ptr = _culsynth_voice_u16_new()
+    def __del__(self):
+        _culsynth_voice_u16_free(self.ptr)
+    def process(self, note, gate, velocity=0xffff, aftertouch=0, modwheel=0,
+                mod_dests=0, mod_depths=0, **params):
+        num_samples = _num_samples(note, gate, velocity, aftertouch, modwheel)
+        note = _in(note, np.uint16, num_samples)
+        gate = _in(gate, np.int16, num_samples)
+        velocity = _in(velocity, np.uint16, num_samples)
+        aftertouch = _in(aftertouch, np.uint16, num_samples)
+        modwheel = _in(modwheel, np.uint16, num_samples)
+        p = _VoiceParamsU16()
+        bufs = []
+        for (name, ctype, dtype, default) in _VOICE_FIELDS_U16:
+            a = _in(params.pop(name, default), dtype, num_samples)
+            bufs.append(a)
+            setattr(p, name, _ptr(a, ctype))
+        if params:
+            raise TypeError('unknown voice parameters: ' + ', '.join(params))
+        dests = _in(mod_dests, np.uint16, MOD_SLOTS)
+        depths = _in(mod_depths, np.int16, MOD_SLOTS)
+        out = np.empty(num_samples, dtype=np.int16)
+        _culsynth_voice_u16_process_batch(self.ptr, c_uint32(num_samples),
+            _ptr(note, c_uint16), _ptr(gate, c_int16),
+            _ptr(velocity, c_uint16), _ptr(aftertouch, c_uint16),
+            _ptr(modwheel, c_uint16), byref(p), _ptr(dests, c_uint16),
+            _ptr(depths, c_int16), _ptr(out, c_int16))
+        return out
+
+_culsynth_voice_f32_new = _lib.culsynth_voice_f32_new
+_culsynth_voice_f32_new.argtypes = []
+_culsynth_voice_f32_new.restype = c_void_p
+
+_culsynth_voice_f32_free = _lib.culsynth_voice_f32_free
+_culsynth_voice_f32_free.argtypes = [c_void_p]
+_culsynth_voice_f32_free.restype = None
+
+_culsynth_voice_f32_process_batch = _lib.culsynth_voice_f32_process_batch
+_culsynth_voice_f32_process_batch.argtypes = [
+    c_void_p,
+    c_uint32,
+    POINTER(c_float),
+    POINTER(c_float),
+    POINTER(c_float),
+    POINTER(c_float),
+    POINTER(c_float),
+    POINTER(_VoiceParamsF32),
+    POINTER(c_uint16),
+    POINTER(c_float),
+    POINTER(c_float)
+]
+_culsynth_voice_f32_process_batch.restype = c_int32
+
+class VoiceFloat:
+    """A full floating-point synthesizer voice (see VoiceFxP).
+
+    Parameters take their natural floating-point values: notes and cutoff
+    in MIDI note number, scalars in [0, 1], and tune in semitones.
+    """
+    def __init__(self):
+        self.ptr = _culsynth_voice_f32_new()
+    def __del__(self):
+        _culsynth_voice_f32_free(self.ptr)
+    def process(self, note, gate, velocity=1.0, aftertouch=0, modwheel=0,
+                mod_dests=0, mod_depths=0, **params):
+        num_samples = _num_samples(note, gate, velocity, aftertouch, modwheel)
+        note = _in(note, np.float32, num_samples)
+        gate = _in(gate, np.float32, num_samples)
+        velocity = _in(velocity, np.float32, num_samples)
+        aftertouch = _in(aftertouch, np.float32, num_samples)
+        modwheel = _in(modwheel, np.float32, num_samples)
+        p = _VoiceParamsF32()
+        bufs = []
+        for (name, ctype, dtype, default) in _VOICE_FIELDS_F32:
+            a = _in(params.pop(name, default), dtype, num_samples)
+            bufs.append(a)
+            setattr(p, name, _ptr(a, ctype))
+        if params:
+            raise TypeError('unknown voice parameters: ' + ', '.join(params))
+        dests = _in(mod_dests, np.uint16, MOD_SLOTS)
+        depths = _in(mod_depths, np.float32, MOD_SLOTS)
+        out = np.empty(num_samples, dtype=np.float32)
+        _culsynth_voice_f32_process_batch(self.ptr, c_uint32(num_samples),
+            _ptr(note, c_float), _ptr(gate, c_float),
+            _ptr(velocity, c_float), _ptr(aftertouch, c_float),
+            _ptr(modwheel, c_float), byref(p), _ptr(dests, c_uint16),
+            _ptr(depths, c_float), _ptr(out, c_float))
+        return out